@@ -66,7 +66,7 @@ adding a one to number if we need to upper round
 
 static void bankers_round_after_div10_128(uint32_t a[4], uint32_t rem){
 
-    if(rem > 5u || (a[0] & 1u)){
+    if(rem > 5u || (rem == 5u && (a[0] & 1u))){
 
         // We add 1, taking into account the transfer between digits
         uint64_t s = (uint64_t)a[0] + 1u;
@@ -103,7 +103,10 @@ static void bankers_round_after_div10_128(uint32_t a[4], uint32_t rem){
 
 // Приведение двух чисел к одинаковому масштабу
 //Увеличивает масштаб меньшего числа или уменьшает масштаб большего
-static void align_scales(uint32_t ax[3], int* sa, uint32_t bx[3], int* sb){
+//Возвращает 1, если числа поменялись местами (знаки нужно поменять так же)
+static int align_scales(uint32_t* S21_RESTRICT ax, int* sa, uint32_t* S21_RESTRICT bx, int* sb){
+
+    int swapped = 0;
 
     if(*sa != *sb){
 
@@ -119,6 +122,7 @@ static void align_scales(uint32_t ax[3], int* sa, uint32_t bx[3], int* sb){
             int ts = *sa;
             *sa = *sb;
             *sb = ts;
+            swapped = 1;
         }
 
         // Приводим к общему масштабу
@@ -137,32 +141,48 @@ static void align_scales(uint32_t ax[3], int* sa, uint32_t bx[3], int* sb){
                 // Иначе уменьшаем масштаб большего числа
                 // Делим на 10
                 uint32_t rem = u96_div10(bx);
+                S21_STAT_INC(add_align_round);
+                // отброшенный разряд - флаги контекста
+                s21_context_raise(S21_FLAG_ROUNDED | (rem ? S21_FLAG_INEXACT : 0u));
                 // округляем результат и уменьшаем масштаб
                 bankers_round_after_div10_96(bx, rem);
                 (*sb)--;
             }
         }
     }
+
+    return swapped;
 }
 
 // Сложение двух decimal чисел
 // Основная функция сложения, учитывающая знаки и масштабы чисел
+// (negate_2 - сменить знак второго числа, так считается вычитание)
+/*
+Операнды читаются целиком до первой записи в result, поэтому result
+может совпадать с value_1 и/или value_2
+*/
+int s21_add_sub_p(const s21_decimal* value_1, const s21_decimal* value_2, int negate_2, s21_decimal* result){
 
-int s21_add(s21_decimal value_1, s21_decimal value_2, s21_decimal* result ){
+    if(!value_1 || !value_2 || !result) return 1;
+    S21_STAT_INC(add_calls);
 
-    memset(result, 0, sizeof(s21_decimal));
+    int scale_a = s21_get_scale(value_1);
+    int scale_b = s21_get_scale(value_2);
 
-    int scale_a = s21_get_scale(&value_1);
-    int scale_b = s21_get_scale(&value_2);
+    int sign_a = s21_get_sign(value_1);
+    int sign_b = s21_get_sign(value_2) ^ (negate_2 != 0);
 
     uint32_t a96[3], b96[3];
-    u96_from_dec(&value_1, a96);
-    u96_from_dec(&value_2, b96);
+    u96_from_dec(value_1, a96);
+    u96_from_dec(value_2, b96);
 
-    align_scales(a96, &scale_a, b96, &scale_b);
+    memset(result, 0, sizeof(s21_decimal));
 
-    int sign_a = s21_get_sign(&value_1);
-    int sign_b = s21_get_sign(&value_2);
+    if(align_scales(a96, &scale_a, b96, &scale_b)){
+        int ts = sign_a;
+        sign_a = sign_b;
+        sign_b = ts;
+    }
 
     uint32_t res96[3] = {0};
     int sign_res = 0;
@@ -177,17 +197,26 @@ int s21_add(s21_decimal value_1, s21_decimal value_2, s21_decimal* result ){
         if(carry){
 
             // нельзя уменьшить масштаб - выход
-            if(scale_a == 0) return 1;
+            if(scale_a == 0){
+                s21_context_raise(S21_FLAG_OVERFLOW);
+                return 1;
+            }
 
             // создаем 128 бит число для устранения переполнения
             uint32_t ext[4] = {res96[0], res96[1], res96[2], (uint32_t)carry};
 
             do{
                 // если нельзя больше уменьшать масштаб - выход
-                if(scale_a == 0) return 1;
+                if(scale_a == 0){
+                    s21_context_raise(S21_FLAG_OVERFLOW);
+                    return 1;
+                }
 
                 // делим на 10 и округляем уменьшая масштаб
                 uint32_t rem = u128_div10(ext);
+                scale_a--;
+                S21_STAT_INC(add_carry_loop);
+                s21_context_raise(S21_FLAG_ROUNDED | (rem ? S21_FLAG_INEXACT : 0u));
                 bankers_round_after_div10_128(ext, rem);
             } while(ext[3] != 0); // пока есть переполнение
 
@@ -232,4 +261,12 @@ int s21_add(s21_decimal value_1, s21_decimal value_2, s21_decimal* result ){
 
     return 0;
 
-}
\ No newline at end of file
+}
+
+int s21_add_p(const s21_decimal* value_1, const s21_decimal* value_2, s21_decimal* result){
+    return s21_add_sub_p(value_1, value_2, 0, result);
+}
+
+int s21_add(s21_decimal value_1, s21_decimal value_2, s21_decimal* result ){
+    return s21_add_sub_p(&value_1, &value_2, 0, result);
+}
@@ -0,0 +1,289 @@
+#include "../s21_decimal.h"
+
+// Арифметика с контекстом и пакетные операции
+/*
+Базовые операции сами отмечают флаги в контексте потока. Здесь флаги,
+возникшие за вызов, собираются и переносятся в переданный контекст,
+результаты с ошибкой обнуляются, а результат с масштабом больше
+max_scale округляется в режиме контекста. Пакетные версии позволяют
+не проверять код возврата на каждом элементе - достаточно один раз
+посмотреть флаги после пакета.
+
+Базовые операции сами округляют к четному (деление - отбрасыванием
+после 28 знаков), и второе округление до max_scale в другом режиме
+было бы неверным. Поэтому если операция округлила результат или
+переполнилась, он пересчитывается: точная сумма или произведение (а для
+деления - частное с запасной цифрой и признаком остатка) в CTX_WIDE
+разрядах округляется один раз в режиме контекста сразу до 96 бит и
+max_scale. Точные результаты идут по быстрому пути.
+*/
+
+// 96 бит * 10^57 < 2^286: делимое с запасом цифр помещается в 9 разрядов
+#define CTX_WIDE 10
+
+typedef int (*s21_binary_op)(const s21_decimal*, const s21_decimal*, s21_decimal*);
+
+// точный результат (c, масштаб, знак) и признак ненулевого остатка
+typedef void (*s21_wide_op)(const s21_decimal*, const s21_decimal*, uint32_t c[CTX_WIDE], int* scale, int* negative,
+                            int* sticky);
+
+static int ctx_max_scale(const s21_context* ctx){
+
+  int max_scale = ctx->max_scale;
+
+  if(max_scale < 0) max_scale = 0;
+  if(max_scale > S21_SCALE_MAX) max_scale = S21_SCALE_MAX;
+
+  return max_scale;
+}
+
+// сумма или разность без округления: масштабы выравниваются умножением
+static void wide_add_sub(const s21_decimal* a, const s21_decimal* b, int negate, uint32_t c[CTX_WIDE], int* scale,
+                         int* negative, int* sticky){
+
+  uint32_t x[CTX_WIDE] = {0};
+  uint32_t y[CTX_WIDE] = {0};
+  const uint32_t* sum = x;
+  int sa = s21_get_scale(a);
+  int sb = s21_get_scale(b);
+  int sign_a = s21_get_sign(a);
+  int sign_b = s21_get_sign(b) ^ (negate != 0);
+
+  u96_from_dec(a, x);
+  u96_from_dec(b, y);
+  // 96 бит * 10^28 < 2^190
+  if(sa < sb) (void)uN_mul_pow10(x, CTX_WIDE, sb - sa);
+  else (void)uN_mul_pow10(y, CTX_WIDE, sa - sb);
+  *scale = sa > sb ? sa : sb;
+
+  if(sign_a == sign_b){
+    (void)uN_add(x, y, CTX_WIDE);
+    *negative = sign_a;
+  } else if(uN_compare(x, y, CTX_WIDE) >= 0){
+    (void)uN_sub(x, y, CTX_WIDE);
+    *negative = sign_a;
+  } else {
+    (void)uN_sub(y, x, CTX_WIDE);
+    sum = y;
+    *negative = sign_b;
+  }
+
+  for(int i = 0; i < CTX_WIDE; i++) c[i] = sum[i];
+  *sticky = 0;
+}
+
+static void wide_add(const s21_decimal* a, const s21_decimal* b, uint32_t c[CTX_WIDE], int* scale, int* negative,
+                     int* sticky){
+  wide_add_sub(a, b, 0, c, scale, negative, sticky);
+}
+
+static void wide_sub(const s21_decimal* a, const s21_decimal* b, uint32_t c[CTX_WIDE], int* scale, int* negative,
+                     int* sticky){
+  wide_add_sub(a, b, 1, c, scale, negative, sticky);
+}
+
+// произведение 192 бит, масштабы складываются
+static void wide_mul(const s21_decimal* a, const s21_decimal* b, uint32_t c[CTX_WIDE], int* scale, int* negative,
+                     int* sticky){
+
+  uint32_t x[3], y[3];
+
+  u96_from_dec(a, x);
+  u96_from_dec(b, y);
+  for(int i = 0; i < CTX_WIDE; i++) c[i] = 0u;
+
+  for(int i = 0; i < 3; i++){
+    uint64_t carry = 0u;
+
+    for(int j = 0; j < 3; j++){
+      uint64_t cur = (uint64_t)c[i + j] + (uint64_t)x[i] * y[j] + carry;
+      c[i + j] = (uint32_t)cur;
+      carry = cur >> 32;
+    }
+
+    c[i + 3] = (uint32_t)carry;
+  }
+
+  *scale = s21_get_scale(a) + s21_get_scale(b);
+  *negative = s21_get_sign(a) ^ s21_get_sign(b);
+  *sticky = 0;
+}
+
+// частное с масштабом 29 (на цифру больше любого max_scale), остаток -
+// sticky. Делитель не ноль: деление на ноль сюда не доходит
+static void wide_div(const s21_decimal* a, const s21_decimal* b, uint32_t c[CTX_WIDE], int* scale, int* negative,
+                     int* sticky){
+
+  uint32_t n[CTX_WIDE] = {0};
+  uint32_t d[3], r[3] = {0u, 0u, 0u};
+  int len_n, len_d;
+
+  u96_from_dec(a, n);
+  u96_from_dec(b, d);
+  *scale = S21_SCALE_MAX + 1;
+  (void)uN_mul_pow10(n, CTX_WIDE, *scale - s21_get_scale(a) + s21_get_scale(b));
+  len_n = uN_len(n, CTX_WIDE);
+  len_d = uN_len(d, 3);
+
+  for(int i = 0; i < CTX_WIDE; i++) c[i] = 0u;
+  if(len_n >= len_d){
+    uN_divmod(n, len_n, d, len_d, c, r);
+    *sticky = uN_len(r, len_d) > 0;
+  } else {
+    *sticky = len_n > 0;
+  }
+
+  *negative = s21_get_sign(a) ^ s21_get_sign(b);
+}
+
+// пересчет с одним округлением в режиме контекста до 96 бит и max_scale
+static int round_once(s21_wide_op wide, const s21_decimal* a, const s21_decimal* b, s21_decimal* result,
+                      const s21_context* ctx){
+
+  uint32_t c[CTX_WIDE];
+  int scale = 0;
+  int negative = 0;
+  int sticky = 0;
+  int code;
+
+  wide(a, b, c, &scale, &negative, &sticky);
+  code = uN_reduce_mode(c, CTX_WIDE, 3, &scale, ctx_max_scale(ctx), negative, sticky, ctx->round);
+
+  if(code){
+    // 2 для отрицательного, 1 для положительного
+    s21_context_raise(S21_FLAG_OVERFLOW);
+    code = negative ? 2 : 1;
+  } else {
+    s21_reset_value(result);
+    u96_to_dec(c, result);
+    s21_set_scale(result, scale);
+    s21_set_sign(result, negative);
+  }
+
+  return code;
+}
+
+// привести точный результат к max_scale контекста за одно деление на 10^k
+static void apply_max_scale(s21_decimal* result, const s21_context* ctx){
+
+  int scale = s21_get_scale(result);
+  int max_scale = ctx_max_scale(ctx);
+
+  if(scale > max_scale){
+    int k = scale - max_scale;
+    int negative = s21_get_sign(result);
+    uint32_t a[3], rem[3];
+
+    u96_from_dec(result, a);
+    u96_divmod_pow10(a, k, rem);
+
+    s21_context_raise(S21_FLAG_ROUNDED | (u96_is_zero(rem) ? 0u : S21_FLAG_INEXACT));
+
+    if(s21_round_increment(a, rem, k, negative, ctx->round)){
+      uint32_t one[3] = {1u, 0u, 0u};
+      (void)u96_add(a, one);
+    }
+
+    s21_reset_value(result);
+    u96_to_dec(a, result);
+    s21_set_scale(result, max_scale);
+    s21_set_sign(result, negative);
+  }
+}
+
+// выполнить операцию над n парами, вернуть флаги этого вызова
+static unsigned run_with_ctx(s21_binary_op op, s21_wide_op wide, const s21_decimal* a, const s21_decimal* b,
+                             s21_decimal* out, size_t n, s21_context* ctx, int* err){
+
+  s21_context* thread_ctx = s21_context_get();
+  if(ctx == NULL) ctx = thread_ctx;
+
+  // собираем флаги вызова отдельно от уже накопленных
+  unsigned saved = thread_ctx->flags;
+  thread_ctx->flags = 0u;
+
+  for(size_t i = 0; i < n; i++){
+    unsigned before = thread_ctx->flags;
+    // операнды копируются: out может совпадать с a или b
+    s21_decimal x = a[i];
+    s21_decimal y = b[i];
+    int code = op(&x, &y, &out[i]);
+
+    // операция округлила или переполнилась - одно округление в режиме
+    // контекста вместо ее собственного
+    if(code == 1 || code == 2 || (code == 0 && (thread_ctx->flags & ~before & S21_FLAG_ROUNDED))){
+      thread_ctx->flags = before;
+      code = round_once(wide, &x, &y, &out[i], ctx);
+    }
+
+    if(code != 0){
+      s21_reset_value(&out[i]);
+      if(*err == 0) *err = code;
+    } else {
+      apply_max_scale(&out[i], ctx);
+    }
+  }
+
+  unsigned raised = thread_ctx->flags;
+  thread_ctx->flags = saved;
+  ctx->flags |= raised;
+
+  return raised;
+}
+
+// одна операция с контекстом, возвращает код ошибки операции
+static int single_with_ctx(s21_binary_op op, s21_wide_op wide, s21_decimal a, s21_decimal b, s21_decimal* result, s21_context* ctx){
+
+  int err = 1;
+
+  if(result != NULL){
+    err = 0;
+    (void)run_with_ctx(op, wide, &a, &b, result, 1, ctx, &err);
+  }
+
+  return err;
+}
+
+// пакетная операция, возвращает флаги этого вызова
+static unsigned batch_with_ctx(s21_binary_op op, s21_wide_op wide, const s21_decimal* a, const s21_decimal* b,
+                               s21_decimal* out, size_t n, s21_context* ctx){
+
+  unsigned raised = 0u;
+  int err = 0;
+
+  if(a != NULL && b != NULL && out != NULL) raised = run_with_ctx(op, wide, a, b, out, n, ctx, &err);
+
+  return raised;
+}
+
+int s21_add_ctx(s21_decimal value_1, s21_decimal value_2, s21_decimal* result, s21_context* ctx){
+  return single_with_ctx(s21_add_p, wide_add, value_1, value_2, result, ctx);
+}
+
+int s21_sub_ctx(s21_decimal value_1, s21_decimal value_2, s21_decimal* result, s21_context* ctx){
+  return single_with_ctx(s21_sub_p, wide_sub, value_1, value_2, result, ctx);
+}
+
+int s21_mul_ctx(s21_decimal value_1, s21_decimal value_2, s21_decimal* result, s21_context* ctx){
+  return single_with_ctx(s21_mul_p, wide_mul, value_1, value_2, result, ctx);
+}
+
+int s21_div_ctx(s21_decimal value_1, s21_decimal value_2, s21_decimal* result, s21_context* ctx){
+  return single_with_ctx(s21_div_p, wide_div, value_1, value_2, result, ctx);
+}
+
+unsigned s21_add_batch(const s21_decimal* a, const s21_decimal* b, s21_decimal* out, size_t n, s21_context* ctx){
+  return batch_with_ctx(s21_add_p, wide_add, a, b, out, n, ctx);
+}
+
+unsigned s21_sub_batch(const s21_decimal* a, const s21_decimal* b, s21_decimal* out, size_t n, s21_context* ctx){
+  return batch_with_ctx(s21_sub_p, wide_sub, a, b, out, n, ctx);
+}
+
+unsigned s21_mul_batch(const s21_decimal* a, const s21_decimal* b, s21_decimal* out, size_t n, s21_context* ctx){
+  return batch_with_ctx(s21_mul_p, wide_mul, a, b, out, n, ctx);
+}
+
+unsigned s21_div_batch(const s21_decimal* a, const s21_decimal* b, s21_decimal* out, size_t n, s21_context* ctx){
+  return batch_with_ctx(s21_div_p, wide_div, a, b, out, n, ctx);
+}
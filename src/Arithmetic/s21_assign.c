@@ -0,0 +1,39 @@
+#include "../s21_decimal.h"
+
+// Арифметика на месте: *acc = *acc op *value
+/*
+Результат считается во временную переменную и записывается в acc только
+при успехе, поэтому ошибка не портит накопленное значение. value может
+совпадать с acc (например, удвоение acc + acc).
+*/
+
+typedef int (*s21_binary_op_p)(const s21_decimal*, const s21_decimal*, s21_decimal*);
+
+static int assign_with(s21_binary_op_p op, s21_decimal* acc, const s21_decimal* value){
+
+  int err = 1;
+
+  if(acc != NULL && value != NULL){
+    s21_decimal out;
+    err = op(acc, value, &out);
+    if(err == 0) *acc = out;
+  }
+
+  return err;
+}
+
+int s21_add_assign(s21_decimal* acc, const s21_decimal* value){
+  return assign_with(s21_add_p, acc, value);
+}
+
+int s21_sub_assign(s21_decimal* acc, const s21_decimal* value){
+  return assign_with(s21_sub_p, acc, value);
+}
+
+int s21_mul_assign(s21_decimal* acc, const s21_decimal* value){
+  return assign_with(s21_mul_p, acc, value);
+}
+
+int s21_div_assign(s21_decimal* acc, const s21_decimal* value){
+  return assign_with(s21_div_p, acc, value);
+}
@@ -0,0 +1,272 @@
+#include <string.h>
+
+#include "../s21_decimal.h"
+
+// Число произвольной длины
+/*
+s21_bigdecimal - для редких результатов, которые не помещаются даже в
+s21_decimal256 (большие суммы значений с большим масштабом). Арифметика
+точная: сумма выравнивает масштабы умножением на 10^k, произведение
+перемножает мантиссы полностью, округление одно - при переводе в
+s21_decimal (uN_reduce, как в s21_decimal256).
+
+Разряды берутся из пула потока (стек: выделение - сдвиг вершины), malloc
+не вызывается. Результат считается в новом блоке на вершине пула, затем
+копируется в разряды result, если их хватает, иначе блок остается за
+result. Поэтому накопитель (acc = acc + x) растет только при росте
+мантиссы, а временные разряды возвращаются в пул сразу. Все остальное
+возвращает s21_bigdecimal_release(mark).
+*/
+
+#define BD_CHUNK 4  // разряды выделяются блоками, кратными 4
+
+static _Thread_local uint32_t s21_bigdecimal_pool[S21_BIGDECIMAL_POOL_LIMBS];
+static _Thread_local size_t s21_bigdecimal_top = 0u;
+
+// блок из n разрядов на вершине пула (NULL - не хватает места)
+static uint32_t* bd_alloc(int n){
+
+  size_t size = ((size_t)(n > 0 ? n : 1) + BD_CHUNK - 1) / BD_CHUNK * BD_CHUNK;
+  uint32_t* block = NULL;
+
+  if(size <= S21_BIGDECIMAL_POOL_LIMBS - s21_bigdecimal_top){
+    block = s21_bigdecimal_pool + s21_bigdecimal_top;
+    s21_bigdecimal_top += size;
+  }
+
+  return block;
+}
+
+// масштаб вне диапазона приводится к границе, как в s21_set_scale
+static int bd_scale(const s21_bigdecimal* d){
+
+  int scale = d->scale;
+
+  if(scale < 0) scale = 0;
+  if(scale > S21_BIGDECIMAL_SCALE_MAX) scale = S21_BIGDECIMAL_SCALE_MAX;
+
+  return scale;
+}
+
+// разрядов на множитель 10^k (log2(10) < 3.322)
+static int bd_pow10_limbs(int k){
+  return k > 0 ? (k * 3322 / 1000 + 32) / 32 : 0;
+}
+
+// мантисса * 10^k в буфер из n разрядов (n хватает)
+static void bd_widen(const s21_bigdecimal* d, uint32_t* wide, int n, int k){
+
+  memset(wide, 0, sizeof(uint32_t) * (size_t)n);
+  if(d->len > 0) memcpy(wide, d->limbs, sizeof(uint32_t) * (size_t)d->len);
+  (void)uN_mul_pow10(wide, n, k);
+}
+
+// записать результат из блока на вершине пула (начало блока - mark)
+static void bd_store(s21_bigdecimal* result, size_t mark, int n, int scale, int sign){
+
+  uint32_t* block = s21_bigdecimal_pool + mark;
+  int len = uN_len(block, n);
+
+  if(result->cap >= len && (len == 0 || result->limbs < block)){
+    // разряды result ниже блока: копия, блок возвращается в пул
+    if(len > 0) memcpy(result->limbs, block, sizeof(uint32_t) * (size_t)len);
+    s21_bigdecimal_top = mark;
+  } else {
+    result->limbs = block;
+    result->cap = (n + BD_CHUNK - 1) / BD_CHUNK * BD_CHUNK;
+    s21_bigdecimal_top = mark + (size_t)result->cap;
+  }
+
+  result->len = len;
+  result->scale = scale;
+  result->sign = len > 0 ? sign : 0;
+}
+
+static int bd_add_sub(const s21_bigdecimal* value_1, const s21_bigdecimal* value_2, int negate_2,
+                      s21_bigdecimal* result){
+
+  int code = 1;
+
+  if(value_1 != NULL && value_2 != NULL && result != NULL){
+    size_t mark = s21_bigdecimal_top;
+    int sa = bd_scale(value_1);
+    int sb = bd_scale(value_2);
+    int scale = sa > sb ? sa : sb;
+    int na = value_1->len + bd_pow10_limbs(scale - sa);
+    int nb = value_2->len + bd_pow10_limbs(scale - sb);
+    int n = (na > nb ? na : nb) + 1;  // + перенос
+    uint32_t* a = bd_alloc(n);
+    uint32_t* b = bd_alloc(n);
+
+    if(a != NULL && b != NULL){
+      int sign_1 = value_1->sign != 0;
+      int sign_2 = (value_2->sign != 0) != (negate_2 != 0);
+      int sign = sign_1;
+
+      bd_widen(value_1, a, n, scale - sa);
+      bd_widen(value_2, b, n, scale - sb);
+
+      if(sign_1 == sign_2){
+        (void)uN_add(a, b, n);
+      } else if(uN_compare(a, b, n) >= 0){
+        (void)uN_sub(a, b, n);
+      } else {
+        (void)uN_sub(b, a, n);
+        memcpy(a, b, sizeof(uint32_t) * (size_t)n);
+        sign = sign_2;
+      }
+
+      bd_store(result, mark, n, scale, sign);
+      code = 0;
+    } else {
+      s21_bigdecimal_top = mark;
+    }
+  }
+
+  return code;
+}
+
+size_t s21_bigdecimal_mark(void){
+  return s21_bigdecimal_top;
+}
+
+void s21_bigdecimal_release(size_t mark){
+  if(mark < s21_bigdecimal_top) s21_bigdecimal_top = mark;
+}
+
+void s21_bigdecimal_init(s21_bigdecimal* d){
+  if(d != NULL) memset(d, 0, sizeof(*d));
+}
+
+int s21_bigdecimal_from_decimal(const s21_decimal* src, s21_bigdecimal* dst){
+
+  int code = 1;
+
+  if(src != NULL && dst != NULL){
+    size_t mark = s21_bigdecimal_top;
+    uint32_t* a = bd_alloc(3);
+
+    if(a != NULL){
+      s21_bigdecimal_init(dst);
+      u96_from_dec(src, a);
+      bd_store(dst, mark, 3, s21_get_scale(src), s21_get_sign(src));
+      code = 0;
+    }
+  }
+
+  return code;
+}
+
+int s21_bigdecimal_to_decimal(const s21_bigdecimal* src, s21_decimal* dst){
+
+  int code = 1;
+
+  if(src != NULL && dst != NULL){
+    size_t mark = s21_bigdecimal_top;
+    int n = src->len > 3 ? src->len : 3;
+    uint32_t* a = bd_alloc(n);
+    int scale = bd_scale(src);
+
+    if(a != NULL){
+      memset(a, 0, sizeof(uint32_t) * (size_t)n);
+      if(src->len > 0) memcpy(a, src->limbs, sizeof(uint32_t) * (size_t)src->len);
+
+      if(uN_reduce(a, n, 3, &scale, S21_SCALE_MAX)){
+        s21_context_raise(S21_FLAG_OVERFLOW);
+        code = src->sign ? 2 : 1;
+      } else {
+        s21_reset_value(dst);
+        u96_to_dec(a, dst);
+        s21_set_scale(dst, scale);
+        s21_set_sign(dst, src->sign != 0);
+        code = 0;
+      }
+    }
+
+    s21_bigdecimal_top = mark;
+  }
+
+  return code;
+}
+
+int s21_bigdecimal_add(const s21_bigdecimal* value_1, const s21_bigdecimal* value_2, s21_bigdecimal* result){
+  return bd_add_sub(value_1, value_2, 0, result);
+}
+
+int s21_bigdecimal_sub(const s21_bigdecimal* value_1, const s21_bigdecimal* value_2, s21_bigdecimal* result){
+  return bd_add_sub(value_1, value_2, 1, result);
+}
+
+int s21_bigdecimal_mul(const s21_bigdecimal* value_1, const s21_bigdecimal* value_2, s21_bigdecimal* result){
+
+  int code = 1;
+
+  if(value_1 != NULL && value_2 != NULL && result != NULL){
+    size_t mark = s21_bigdecimal_top;
+    int scale = bd_scale(value_1) + bd_scale(value_2);
+    int la = value_1->len;
+    int lb = value_2->len;
+    uint32_t* prod = scale <= S21_BIGDECIMAL_SCALE_MAX ? bd_alloc(la + lb) : NULL;
+
+    // масштаб произведения не помещается - переполнение, как в s21_mul
+    if(scale > S21_BIGDECIMAL_SCALE_MAX) s21_context_raise(S21_FLAG_OVERFLOW);
+
+    if(prod != NULL){
+      memset(prod, 0, sizeof(uint32_t) * (size_t)(la + lb));
+
+      // в столбик, как в s21_decimal256_mul
+      for(int i = 0; i < la; i++){
+        uint64_t carry = 0u;
+
+        for(int j = 0; j < lb; j++){
+          uint64_t cur = (uint64_t)prod[i + j] + (uint64_t)value_1->limbs[i] * value_2->limbs[j] + carry;
+          prod[i + j] = (uint32_t)cur;
+          carry = cur >> 32;
+        }
+
+        prod[i + lb] = (uint32_t)carry;
+      }
+
+      bd_store(result, mark, la + lb, scale, (value_1->sign != 0) != (value_2->sign != 0));
+      code = 0;
+    }
+  }
+
+  return code;
+}
+
+int s21_bigdecimal_compare(const s21_bigdecimal* value_1, const s21_bigdecimal* value_2, int* result){
+
+  int code = 1;
+
+  if(value_1 != NULL && value_2 != NULL && result != NULL){
+    int neg_1 = value_1->sign != 0 && value_1->len > 0;
+    int neg_2 = value_2->sign != 0 && value_2->len > 0;
+
+    if(neg_1 != neg_2){
+      *result = neg_1 ? -1 : 1;
+      code = 0;
+    } else {
+      size_t mark = s21_bigdecimal_top;
+      int sa = bd_scale(value_1);
+      int sb = bd_scale(value_2);
+      int scale = sa > sb ? sa : sb;
+      int na = value_1->len + bd_pow10_limbs(scale - sa);
+      int nb = value_2->len + bd_pow10_limbs(scale - sb);
+      int n = na > nb ? na : nb;
+      uint32_t* a = bd_alloc(n);
+      uint32_t* b = bd_alloc(n);
+
+      if(a != NULL && b != NULL){
+        bd_widen(value_1, a, n, scale - sa);
+        bd_widen(value_2, b, n, scale - sb);
+        *result = neg_1 ? -uN_compare(a, b, n) : uN_compare(a, b, n);
+        code = 0;
+      }
+
+      s21_bigdecimal_top = mark;
+    }
+  }
+
+  return code;
+}
@@ -0,0 +1,198 @@
+#include <string.h>
+
+#include "../s21_decimal.h"
+
+// Число с 256 бит мантиссой
+/*
+s21_decimal256 - мантисса из 8 разрядов по 32 бита, масштаб 0..76 и
+знак отдельными полями. Сложение выравнивает масштабы умножением на
+10^k, умножение перемножает мантиссы полностью - точный результат
+(до 17 разрядов) один раз сокращается uN_reduce до 256 бит и масштаба
+76 с банковским округлением, как произведение в s21_mul. Конечные нули
+не удаляются: масштаб суммы - больший из масштабов, произведения -
+сумма масштабов (если помещается).
+Перевод в s21_decimal - то же сокращение до 96 бит и масштаба 28.
+*/
+
+#define D256_N S21_DECIMAL256_LIMBS
+#define D256_WIDE (2 * S21_DECIMAL256_LIMBS + 1)  // выравнивание и произведение
+
+// масштаб вне диапазона приводится к границе, как в s21_set_scale
+static int d256_scale(const s21_decimal256* d){
+
+  int scale = d->scale;
+
+  if(scale < 0) scale = 0;
+  if(scale > S21_DECIMAL256_SCALE_MAX) scale = S21_DECIMAL256_SCALE_MAX;
+
+  return scale;
+}
+
+// мантисса в буфер из D256_WIDE разрядов
+static void d256_widen(const s21_decimal256* d, uint32_t wide[D256_WIDE]){
+  memset(wide, 0, sizeof(uint32_t) * D256_WIDE);
+  memcpy(wide, d->bits, sizeof(d->bits));
+}
+
+// сократить точный результат и записать (код ошибки как у s21_mul)
+static int d256_store(uint32_t wide[D256_WIDE], int scale, int sign, s21_decimal256* result){
+
+  int code = 0;
+
+  if(uN_reduce(wide, D256_WIDE, D256_N, &scale, S21_DECIMAL256_SCALE_MAX)){
+    s21_context_raise(S21_FLAG_OVERFLOW);
+    code = sign ? 2 : 1;
+  } else {
+    memcpy(result->bits, wide, sizeof(result->bits));
+    result->scale = scale;
+    result->sign = sign;
+  }
+
+  return code;
+}
+
+// оба числа к общему (большему) масштабу без потерь
+static int d256_align(const s21_decimal256* x, const s21_decimal256* y, uint32_t a[D256_WIDE], uint32_t b[D256_WIDE]){
+
+  int sa = d256_scale(x);
+  int sb = d256_scale(y);
+  int scale = sa > sb ? sa : sb;
+
+  // 256 бит * 10^76 < 2^509: переполнения нет
+  d256_widen(x, a);
+  d256_widen(y, b);
+  (void)uN_mul_pow10(a, D256_WIDE, scale - sa);
+  (void)uN_mul_pow10(b, D256_WIDE, scale - sb);
+
+  return scale;
+}
+
+static int d256_add_sub(const s21_decimal256* value_1, const s21_decimal256* value_2, int negate_2,
+                        s21_decimal256* result){
+
+  int code = 1;
+
+  if(value_1 != NULL && value_2 != NULL && result != NULL){
+    uint32_t a[D256_WIDE], b[D256_WIDE];
+    int scale = d256_align(value_1, value_2, a, b);
+    int sign_1 = value_1->sign != 0;
+    int sign_2 = (value_2->sign != 0) != (negate_2 != 0);
+    int sign = sign_1;
+
+    if(sign_1 == sign_2){
+      (void)uN_add(a, b, D256_WIDE);
+    } else if(uN_compare(a, b, D256_WIDE) >= 0){
+      (void)uN_sub(a, b, D256_WIDE);
+    } else {
+      (void)uN_sub(b, a, D256_WIDE);
+      memcpy(a, b, sizeof(a));
+      sign = sign_2;
+    }
+
+    if(uN_len(a, D256_WIDE) == 0) sign = 0;
+
+    code = d256_store(a, scale, sign, result);
+  }
+
+  return code;
+}
+
+int s21_decimal256_from_decimal(const s21_decimal* src, s21_decimal256* dst){
+
+  int code = 1;
+
+  if(src != NULL && dst != NULL){
+    memset(dst, 0, sizeof(*dst));
+    u96_from_dec(src, dst->bits);
+    dst->scale = s21_get_scale(src);
+    dst->sign = s21_get_sign(src);
+    code = 0;
+  }
+
+  return code;
+}
+
+int s21_decimal256_to_decimal(const s21_decimal256* src, s21_decimal* dst){
+
+  int code = 1;
+
+  if(src != NULL && dst != NULL){
+    uint32_t a[D256_N];
+    int scale = d256_scale(src);
+
+    memcpy(a, src->bits, sizeof(a));
+
+    if(uN_reduce(a, D256_N, 3, &scale, S21_SCALE_MAX)){
+      s21_context_raise(S21_FLAG_OVERFLOW);
+      code = src->sign ? 2 : 1;
+    } else {
+      s21_reset_value(dst);
+      u96_to_dec(a, dst);
+      s21_set_scale(dst, scale);
+      s21_set_sign(dst, src->sign != 0);
+      code = 0;
+    }
+  }
+
+  return code;
+}
+
+int s21_decimal256_add(const s21_decimal256* value_1, const s21_decimal256* value_2, s21_decimal256* result){
+  return d256_add_sub(value_1, value_2, 0, result);
+}
+
+int s21_decimal256_sub(const s21_decimal256* value_1, const s21_decimal256* value_2, s21_decimal256* result){
+  return d256_add_sub(value_1, value_2, 1, result);
+}
+
+int s21_decimal256_mul(const s21_decimal256* value_1, const s21_decimal256* value_2, s21_decimal256* result){
+
+  int code = 1;
+
+  if(value_1 != NULL && value_2 != NULL && result != NULL){
+    uint32_t prod[D256_WIDE] = {0};
+    int la = uN_len(value_1->bits, D256_N);
+    int lb = uN_len(value_2->bits, D256_N);
+
+    // в столбик только по значащим разрядам
+    for(int i = 0; i < la; i++){
+      uint64_t carry = 0u;
+
+      for(int j = 0; j < lb; j++){
+        uint64_t cur = (uint64_t)prod[i + j] + (uint64_t)value_1->bits[i] * value_2->bits[j] + carry;
+        prod[i + j] = (uint32_t)cur;
+        carry = cur >> 32;
+      }
+
+      prod[i + lb] = (uint32_t)carry;
+    }
+
+    code = d256_store(prod, d256_scale(value_1) + d256_scale(value_2), (value_1->sign != 0) != (value_2->sign != 0),
+                      result);
+  }
+
+  return code;
+}
+
+int s21_decimal256_compare(const s21_decimal256* value_1, const s21_decimal256* value_2){
+
+  int result = 0;
+
+  if(value_1 != NULL && value_2 != NULL){
+    uint32_t a[D256_WIDE], b[D256_WIDE];
+    int zero_1 = uN_len(value_1->bits, D256_N) == 0;
+    int zero_2 = uN_len(value_2->bits, D256_N) == 0;
+    int neg_1 = value_1->sign != 0 && !zero_1;
+    int neg_2 = value_2->sign != 0 && !zero_2;
+
+    if(neg_1 != neg_2){
+      result = neg_1 ? -1 : 1;
+    } else {
+      (void)d256_align(value_1, value_2, a, b);
+      result = uN_compare(a, b, D256_WIDE);
+      if(neg_1) result = -result;
+    }
+  }
+
+  return result;
+}
@@ -0,0 +1,303 @@
+#include <string.h>
+
+#include "../s21_decimal.h"
+
+// Компактное число 8 байт
+/*
+s21_decimal64 - мантисса 56 бит, масштаб и знак в одном uint64_t: вдвое
+меньше s21_decimal для таблиц цен и позиций, где почти все значения
+короче 16 цифр. Быстрый путь - целые 64 бита: сумма домножает мантиссу
+с меньшим масштабом на 10^k, если произведение заранее меньше 2^63
+(оценка по числу бит), произведение считается, если сумма длин мантисс
+не больше 64 бит. Результат точный; если он не помещается в 56 бит или
+масштаб больше 28, операция повторяется точно в s21_decimal256 и
+результат один раз округляется в s21_decimal (S21_DECIMAL64_PROMOTED).
+Правила масштаба и знака нуля как у s21_decimal256.
+*/
+
+// 10^0..10^19 - все степени, которые помещаются в uint64_t
+#define D64_POW10_MAX 19
+
+static const uint64_t d64_pow10[D64_POW10_MAX + 1] = {
+    UINT64_C(1),
+    UINT64_C(10),
+    UINT64_C(100),
+    UINT64_C(1000),
+    UINT64_C(10000),
+    UINT64_C(100000),
+    UINT64_C(1000000),
+    UINT64_C(10000000),
+    UINT64_C(100000000),
+    UINT64_C(1000000000),
+    UINT64_C(10000000000),
+    UINT64_C(100000000000),
+    UINT64_C(1000000000000),
+    UINT64_C(10000000000000),
+    UINT64_C(100000000000000),
+    UINT64_C(1000000000000000),
+    UINT64_C(10000000000000000),
+    UINT64_C(100000000000000000),
+    UINT64_C(1000000000000000000),
+    UINT64_C(10000000000000000000),
+};
+
+static uint64_t d64_coef(s21_decimal64 d){
+  return d.bits & S21_DECIMAL64_COEF_MAX;
+}
+
+// масштаб больше 28 считается равным 28, как в s21_set_scale
+static int d64_scale(s21_decimal64 d){
+
+  int scale = (int)((d.bits & S21_DECIMAL64_SCALE_MASK) >> S21_DECIMAL64_SCALE_SHIFT);
+
+  return scale > S21_SCALE_MAX ? S21_SCALE_MAX : scale;
+}
+
+static int d64_sign(s21_decimal64 d){
+  return (d.bits & S21_DECIMAL64_SIGN_MASK) != 0u;
+}
+
+static s21_decimal64 d64_pack(uint64_t coef, int scale, int sign){
+
+  s21_decimal64 d;
+
+  d.bits = coef | ((uint64_t)scale << S21_DECIMAL64_SCALE_SHIFT) | (sign ? S21_DECIMAL64_SIGN_MASK : 0u);
+
+  return d;
+}
+
+// количество значащих бит (0 для нуля)
+static int d64_bits(uint64_t x){
+  return x ? 64 - __builtin_clzll(x) : 0;
+}
+
+// бит в 10^k не больше k * 3.322 + 1 (log2(10) < 3.322)
+static int d64_pow10_bits(int k){
+  return k * 3322 / 1000 + 1;
+}
+
+static void d64_widen(s21_decimal64 d, s21_decimal256* w){
+
+  uint64_t coef = d64_coef(d);
+
+  memset(w, 0, sizeof(*w));
+  w->bits[0] = (uint32_t)coef;
+  w->bits[1] = (uint32_t)(coef >> 32);
+  w->scale = d64_scale(d);
+  w->sign = d64_sign(d);
+}
+
+// медленный путь: точный результат s21_decimal256 в s21_decimal64, если
+// помещается, иначе в decimal с округлением
+static int d64_finish(const s21_decimal256* exact, s21_decimal64* result, s21_decimal* promoted){
+
+  int code = 0;
+  uint64_t coef = ((uint64_t)exact->bits[1] << 32) | exact->bits[0];
+
+  if(uN_len(exact->bits + 2, S21_DECIMAL256_LIMBS - 2) == 0 && coef <= S21_DECIMAL64_COEF_MAX &&
+     exact->scale <= S21_SCALE_MAX){
+    *result = d64_pack(coef, exact->scale, exact->sign);
+  } else {
+    code = s21_decimal256_to_decimal(exact, promoted);
+    if(code == 0) code = S21_DECIMAL64_PROMOTED;
+  }
+
+  return code;
+}
+
+static int d64_add_sub(s21_decimal64 value_1, s21_decimal64 value_2, int negate_2, s21_decimal64* result,
+                       s21_decimal* promoted){
+
+  int code = 1;
+
+  if(result != NULL && promoted != NULL){
+    uint64_t a = d64_coef(value_1);
+    uint64_t b = d64_coef(value_2);
+    int sa = d64_scale(value_1);
+    int sb = d64_scale(value_2);
+    int sign_1 = d64_sign(value_1);
+    int sign_2 = d64_sign(value_2) != (negate_2 != 0);
+    int k = sa > sb ? sa - sb : sb - sa;
+    uint64_t* small = sa > sb ? &b : &a;
+    int fast = k <= D64_POW10_MAX && d64_bits(*small) + d64_pow10_bits(k) <= 63;
+
+    if(fast){
+      // обе мантиссы меньше 2^63: сумма без переноса
+      uint64_t sum;
+      int sign = sign_1;
+
+      *small *= d64_pow10[k];
+      if(sign_1 == sign_2){
+        sum = a + b;
+      } else if(a >= b){
+        sum = a - b;
+      } else {
+        sum = b - a;
+        sign = sign_2;
+      }
+
+      fast = sum <= S21_DECIMAL64_COEF_MAX;
+      if(fast){
+        *result = d64_pack(sum, sa > sb ? sa : sb, sum != 0u && sign);
+        code = 0;
+      }
+    }
+
+    if(!fast){
+      s21_decimal256 x, y, exact;
+
+      d64_widen(value_1, &x);
+      d64_widen(value_2, &y);
+      // 56 бит * 10^28 < 2^150: без округления
+      (void)(negate_2 ? s21_decimal256_sub(&x, &y, &exact) : s21_decimal256_add(&x, &y, &exact));
+      code = d64_finish(&exact, result, promoted);
+    }
+  }
+
+  return code;
+}
+
+int s21_decimal64_from_decimal(const s21_decimal* src, s21_decimal64* dst){
+
+  int code = 1;
+
+  if(src != NULL && dst != NULL){
+    uint64_t coef = ((uint64_t)(uint32_t)src->bits[1] << 32) | (uint32_t)src->bits[0];
+
+    if(src->bits[2] == 0 && coef <= S21_DECIMAL64_COEF_MAX && s21_get_scale(src) <= S21_SCALE_MAX){
+      *dst = d64_pack(coef, s21_get_scale(src), s21_get_sign(src));
+      code = 0;
+    }
+  }
+
+  return code;
+}
+
+int s21_decimal64_to_decimal(s21_decimal64 src, s21_decimal* dst){
+
+  int code = 1;
+
+  if(dst != NULL){
+    uint64_t coef = d64_coef(src);
+
+    dst->bits[0] = (int)(uint32_t)coef;
+    dst->bits[1] = (int)(uint32_t)(coef >> 32);
+    dst->bits[2] = 0;
+    dst->bits[3] = 0;
+    s21_set_scale(dst, d64_scale(src));
+    s21_set_sign(dst, d64_sign(src));
+    code = 0;
+  }
+
+  return code;
+}
+
+int s21_decimal64_from_scaled_int64(int64_t src, int scale, s21_decimal64* dst){
+
+  int code = 1;
+
+  if(dst != NULL && scale >= 0 && scale <= S21_SCALE_MAX){
+    uint64_t coef = src < 0 ? 0u - (uint64_t)src : (uint64_t)src;
+
+    if(coef <= S21_DECIMAL64_COEF_MAX){
+      *dst = d64_pack(coef, scale, src < 0);
+      code = 0;
+    }
+  }
+
+  return code;
+}
+
+int s21_decimal64_add(s21_decimal64 value_1, s21_decimal64 value_2, s21_decimal64* result, s21_decimal* promoted){
+  return d64_add_sub(value_1, value_2, 0, result, promoted);
+}
+
+int s21_decimal64_sub(s21_decimal64 value_1, s21_decimal64 value_2, s21_decimal64* result, s21_decimal* promoted){
+  return d64_add_sub(value_1, value_2, 1, result, promoted);
+}
+
+int s21_decimal64_mul(s21_decimal64 value_1, s21_decimal64 value_2, s21_decimal64* result, s21_decimal* promoted){
+
+  int code = 1;
+
+  if(result != NULL && promoted != NULL){
+    uint64_t a = d64_coef(value_1);
+    uint64_t b = d64_coef(value_2);
+    int scale = d64_scale(value_1) + d64_scale(value_2);
+    int sign = d64_sign(value_1) != d64_sign(value_2);
+
+    // иначе произведение не меньше 2^63 и в 56 бит не помещается
+    if(d64_bits(a) + d64_bits(b) <= 64 && a * b <= S21_DECIMAL64_COEF_MAX && scale <= S21_SCALE_MAX){
+      *result = d64_pack(a * b, scale, sign);
+      code = 0;
+    } else {
+      s21_decimal256 x, y, exact;
+
+      d64_widen(value_1, &x);
+      d64_widen(value_2, &y);
+      // 112 бит, масштаб до 56: без округления
+      (void)s21_decimal256_mul(&x, &y, &exact);
+      code = d64_finish(&exact, result, promoted);
+    }
+  }
+
+  return code;
+}
+
+int s21_decimal64_compare(s21_decimal64 value_1, s21_decimal64 value_2){
+
+  int result = 0;
+  uint64_t a = d64_coef(value_1);
+  uint64_t b = d64_coef(value_2);
+  int neg_1 = d64_sign(value_1) && a != 0u;
+  int neg_2 = d64_sign(value_2) && b != 0u;
+  int sa = d64_scale(value_1);
+  int sb = d64_scale(value_2);
+  int k = sa > sb ? sa - sb : sb - sa;
+  uint64_t* small = sa > sb ? &b : &a;
+
+  if(neg_1 != neg_2){
+    result = neg_1 ? -1 : 1;
+  } else if(k <= D64_POW10_MAX && d64_bits(*small) + d64_pow10_bits(k) <= 64){
+    *small *= d64_pow10[k];
+    result = (a > b) - (a < b);
+    if(neg_1) result = -result;
+  } else {
+    s21_decimal256 x, y;
+
+    d64_widen(value_1, &x);
+    d64_widen(value_2, &y);
+    result = s21_decimal256_compare(&x, &y);
+  }
+
+  return result;
+}
+
+// Пакетная конвертация decimal -> s21_decimal64, ошибочные элементы получают 0
+int s21_decimal64_from_decimal_batch(const s21_decimal* src, s21_decimal64* dst, size_t n){
+
+  int result = (src == NULL || dst == NULL);
+
+  if(!result){
+    for(size_t i = 0; i < n; i++){
+      if(s21_decimal64_from_decimal(&src[i], &dst[i]) != 0){
+        dst[i].bits = 0u;
+        result = 1;
+      }
+    }
+  }
+
+  return result;
+}
+
+// Пакетная конвертация s21_decimal64 -> decimal
+int s21_decimal64_to_decimal_batch(const s21_decimal64* src, s21_decimal* dst, size_t n){
+
+  int result = (src == NULL || dst == NULL);
+
+  if(!result){
+    for(size_t i = 0; i < n; i++) (void)s21_decimal64_to_decimal(src[i], &dst[i]);
+  }
+
+  return result;
+}
@@ -43,7 +43,7 @@ static inline void u96_or1(uint32_t a[3], uint32_t bit){
 
 // Деление 96-битного числа на 96-битное с получением частного и остатка
 // Реализует алгоритм деления "в столбик" для двоичных чисел
-static void u96_divmod(const uint32_t a_in[3], const uint32_t b_in[3], uint32_t q_out[3], uint32_t r_out[3]){
+static void u96_divmod(const uint32_t* S21_RESTRICT a_in, const uint32_t* S21_RESTRICT b_in, uint32_t* S21_RESTRICT q_out, uint32_t* S21_RESTRICT r_out){
 
     // Создаем рабочие копии входных данных
     uint32_t a[3] = {a_in[0], a_in[1], a_in[2]}; // Делимое
@@ -85,6 +85,19 @@ static void u96_divmod(const uint32_t a_in[3], const uint32_t b_in[3], uint32_t
     r_out[2] = r[2];
 }
 
+// Уменьшение масштаба результата на 1 с банковским округлением
+// Отброшенный разряд отмечается во флагах контекста
+
+static void div_scale_down(s21_decimal* out){
+
+    uint32_t tmp[3];
+    u96_from_dec(out, tmp);
+    uint32_t rem = u96_div10(tmp);
+
+    s21_context_raise(S21_FLAG_ROUNDED | (rem ? S21_FLAG_INEXACT : 0u));
+    s21_scale_down_one_banker(out);
+}
+
 // Определение необходимости банковского округления
 // Реализует правило банковского округления для деления, 1 - вверх, 0 иначе
 
@@ -114,6 +127,7 @@ static int banker_should_increment(const uint32_t R[3],const uint32_t D[3], cons
 static int handle_div_overflow_and_round(s21_decimal* out, int S, int sign, const uint32_t R[3], const uint32_t D[3]){
 
     int result = 0;
+    S21_STAT_INC(div_overflow_round);
     // смотрим нужно ли округлять вверх
     int inc = banker_should_increment( R, D, (uint32_t[]){(uint32_t)out->bits[0], (uint32_t)out->bits[1], (uint32_t)out->bits[2]});
     
@@ -125,13 +139,14 @@ static int handle_div_overflow_and_round(s21_decimal* out, int S, int sign, cons
             // если масштаб больше 0
             if(S) {
                 // округляем в нижнюю сторону
-                s21_scale_down_one_banker(out);
+                div_scale_down(out);
                 // снова добавляем единицу
                 u96_add((uint32_t*)&out->bits[0], one);
             } else {
                 // если масштаб не позволяет уменьшать число - ошибка
                 if(sign) result = 2;
                 else result = 1;
+                s21_context_raise(S21_FLAG_OVERFLOW);
             }
         }
     }
@@ -141,39 +156,42 @@ static int handle_div_overflow_and_round(s21_decimal* out, int S, int sign, cons
 
 // Деление двух decimal чисел
 // Выполняет точное деление с поддержкой до 28 знаков после запятой
-int s21_div(s21_decimal value_1, s21_decimal value_2, s21_decimal* result) {
+// (результат пишется в result только в конце - допускается совпадение с операндами)
+int s21_div_p(const s21_decimal* value_1, const s21_decimal* value_2, s21_decimal* result) {
 
     int err = 0;
 
-    // Проверка корректности указателя результата
-    if(!result) return 1;
+    // Проверка корректности указателей
+    if(!value_1 || !value_2 || !result) return 1;
+    S21_STAT_INC(div_calls);
 
     // Проверка деления на 0
-    if(value_2.bits[0] == 0 && value_2.bits[1] == 0 && value_2.bits[2] == 0){
+    if(value_2->bits[0] == 0 && value_2->bits[1] == 0 && value_2->bits[2] == 0){
         // Ошибка: деление на ноль
+        s21_context_raise(S21_FLAG_DIV_BY_ZERO);
         return 3;
     }
 
     // Если делимое равно нулю, результат тоже ноль
-    if(value_1.bits[0] == 0 && value_1.bits[1] == 0 && value_1.bits[2] == 0){
+    if(value_1->bits[0] == 0 && value_1->bits[1] == 0 && value_1->bits[2] == 0){
         s21_reset_value(result);
         return 0;
     }
 
     // Вычисляем знак результата (XOR знаков операндов)
-    int sign = s21_get_sign(&value_1) ^ s21_get_sign(&value_2);
+    int sign = s21_get_sign(value_1) ^ s21_get_sign(value_2);
 
     // Получаем масштабы чисел
-    int Sa = s21_get_scale(&value_1); 
-    int Sb = s21_get_scale(&value_2);
+    int Sa = s21_get_scale(value_1); 
+    int Sb = s21_get_scale(value_2);
     int E = Sa - Sb;
 
     // инициализация переменных
     uint32_t Q[3] = {0, 0, 0};
     uint32_t R[3] = {0, 0, 0};
     uint32_t N[3], D[3];
-    u96_from_dec(&value_1, N);
-    u96_from_dec(&value_2, D);
+    u96_from_dec(value_1, N);
+    u96_from_dec(value_2, D);
 
     // Основное деление
     u96_divmod(N, D, Q, R);
@@ -220,11 +238,15 @@ int s21_div(s21_decimal value_1, s21_decimal value_2, s21_decimal* result) {
         }
         u96_to_dec(tmp, &out);
         S++;
+        S21_STAT_INC(div_digits);
 
         // копируем в старый остаток новый остаток
         u96_copy(R,rd);
     }
 
+    // деление не завершилось точно - остаток отброшен
+    if(!u96_is_zero(R)) s21_context_raise(S21_FLAG_ROUNDED | S21_FLAG_INEXACT);
+
     // если масштаб делителя меньше делимого и нам нужно делить результат
     if( E > 0) {
 
@@ -234,7 +256,7 @@ int s21_div(s21_decimal value_1, s21_decimal value_2, s21_decimal* result) {
         // пока текущий масштаб больше 28
         while (targetS > S21_SCALE_MAX){
             // округляем и уменьшаем масштаб
-            s21_scale_down_one_banker(&out);
+            div_scale_down(&out);
             targetS--;
         }
 
@@ -257,6 +279,7 @@ int s21_div(s21_decimal value_1, s21_decimal value_2, s21_decimal* result) {
 
                 // если масштаб не уменьшить
                 if(S == 0){
+                    s21_context_raise(S21_FLAG_OVERFLOW);
                     if(sign) return 2;
                     else return 1;
                 }
@@ -265,7 +288,7 @@ int s21_div(s21_decimal value_1, s21_decimal value_2, s21_decimal* result) {
                 s21_set_scale(&out, S);
 
                 // понижаем масштаб на 1 и округляем
-                s21_scale_down_one_banker(&out);
+                div_scale_down(&out);
 
                 // получаем текущий масштаб
                 S = s21_get_scale(&out);
@@ -294,3 +317,6 @@ int s21_div(s21_decimal value_1, s21_decimal value_2, s21_decimal* result) {
 
 }
 
+int s21_div(s21_decimal value_1, s21_decimal value_2, s21_decimal* result) {
+    return s21_div_p(&value_1, &value_2, result);
+}
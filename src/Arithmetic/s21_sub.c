@@ -4,14 +4,14 @@
 
 /*
 Реализовано через сложение с противоположным числом: a - b = a + (-b)
+Знак b меняется внутри сложения, копия b не создается
 0 при успехе, 1 при переполнении, 2 при недополнении
 */
 
-int s21_sub(s21_decimal a, s21_decimal b, s21_decimal* res){
-
-    // Меняем знак второго числа: sub = a + (-b)
-    s21_set_sign(&b, !s21_get_sign(&b));
+int s21_sub_p(const s21_decimal* a, const s21_decimal* b, s21_decimal* res){
+    return s21_add_sub_p(a, b, 1, res);
+}
 
-    // Инвертируем знак числа b и вызываем функцию сложения
-    return s21_add(a, b, res);
-}
\ No newline at end of file
+int s21_sub(s21_decimal a, s21_decimal b, s21_decimal* res){
+    return s21_add_sub_p(&a, &b, 1, res);
+}
@@ -0,0 +1,260 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "../s21_decimal.h"
+
+/*
+Обмен столбцами с Apache Arrow через C Data Interface без библиотеки
+Arrow. Значение Arrow decimal128(P, S) - целое 128 бит в дополнительном
+коде, число = v * 10^-S. Элемент занимает 16 байт, как s21_decimal,
+поэтому перевод идет на месте: элемент читается целиком и записывается
+на то же место, и столбец можно отдать Arrow без буфера под данные.
+Общего представления нет (у decimal модуль и знак отдельно, масштаб в
+bits[3]), поэтому один проход перевода нужен всегда.
+Экспорт: буфер null не передается (null_count = 0), формат "d:38,S".
+*/
+
+#define ARROW_VALUE_SIZE 16
+
+// 10^38 - 1: наибольший модуль при точности 38
+static const uint32_t arrow_coef_max[4] = {0xFFFFFFFFu, 0x098A223Fu, 0x5A86C47Au, 0x4B3B4CA8u};
+
+typedef struct {
+  char format[32];
+} arrow_schema_private;
+
+typedef struct {
+  const void* buffers[2];
+  void* data;  // копия столбца (NULL - на месте)
+} arrow_array_private;
+
+// модуль 128 бит из дополнительного кода (ретюрн 1 - отрицательное)
+static int arrow_load(const unsigned char* p, uint32_t c[4]){
+
+  uint64_t w[2];
+  int negative;
+
+  memcpy(w, p, sizeof(w));
+  negative = (int)(w[1] >> 63);
+  if(negative){
+    w[0] = ~w[0] + 1u;
+    w[1] = ~w[1] + (w[0] == 0u);
+  }
+  c[0] = (uint32_t)w[0];
+  c[1] = (uint32_t)(w[0] >> 32);
+  c[2] = (uint32_t)w[1];
+  c[3] = (uint32_t)(w[1] >> 32);
+
+  return negative;
+}
+
+// модуль и знак в дополнительный код
+static void arrow_store(unsigned char* p, const uint32_t c[4], int negative){
+
+  uint64_t w[2];
+
+  w[0] = (uint64_t)c[1] << 32 | c[0];
+  w[1] = (uint64_t)c[3] << 32 | c[2];
+  if(negative){
+    w[0] = ~w[0] + 1u;
+    w[1] = ~w[1] + (w[0] == 0u);
+  }
+  memcpy(p, w, sizeof(w));
+}
+
+// один элемент decimal в Arrow с масштабом scale (1 - больше 38 цифр)
+static int arrow_from_decimal(s21_decimal d, int scale, unsigned char* p){
+
+  uint32_t c[4] = {0};
+  int s = s21_get_scale(&d);
+  int result = s > S21_SCALE_MAX;
+
+  u96_from_dec(&d, c);
+  if(!result && s < scale){
+    result = uN_mul_pow10(c, 4, scale - s) || uN_compare(c, arrow_coef_max, 4) > 0;
+  } else if(!result && s > scale){
+    (void)uN_reduce(c, 4, 4, &s, scale);
+  }
+
+  if(result) c[0] = c[1] = c[2] = c[3] = 0u;
+  arrow_store(p, c, s21_get_sign(&d) && uN_len(c, 4) > 0);
+
+  return result;
+}
+
+// перевод n значений Arrow (данные с p) в dst, valid - битовая карта null
+// или NULL, first - номер первого бита
+static int arrow_to_decimal_n(const unsigned char* p, const unsigned char* valid, int64_t first, size_t n,
+                              int scale, s21_decimal* dst){
+
+  int result = 0;
+
+  for(size_t i = 0; i < n; i++){
+    int64_t bit = first + (int64_t)i;
+    s21_decimal d = {{0, 0, 0, 0}};
+
+    if(valid == NULL || (valid[bit >> 3] >> (bit & 7) & 1u)){
+      uint32_t c[8] = {0};
+      int negative = arrow_load(p + i * ARROW_VALUE_SIZE, c);
+
+      if(s21_coef_to_decimal(c, -scale, negative, &d) != 0){
+        s21_decimal zero = {{0, 0, 0, 0}};
+        d = zero;
+        result = 1;
+      }
+    }
+
+    dst[i] = d;
+  }
+
+  return result;
+}
+
+static void arrow_release_schema(struct ArrowSchema* schema){
+  free(schema->private_data);
+  schema->private_data = NULL;
+  schema->release = NULL;
+}
+
+static void arrow_release_array(struct ArrowArray* array){
+
+  arrow_array_private* priv = array->private_data;
+
+  free(priv->data);
+  free(priv);
+  array->private_data = NULL;
+  array->release = NULL;
+}
+
+// "d:P,S" или "d:P,S,128" (1 - другой формат)
+static int arrow_parse_format(const char* format, int* scale){
+
+  int result = format == NULL || format[0] != 'd' || format[1] != ':';
+  int values[3] = {0, 0, 0};
+  int count = 0;
+
+  if(!result){
+    const char* p = format + 2;
+
+    while(!result && count < 3){
+      int negative = *p == '-';
+      int digits = 0;
+
+      if(negative) p++;
+      while(*p >= '0' && *p <= '9' && digits < 9){
+        values[count] = values[count] * 10 + (*p - '0');
+        p++;
+        digits++;
+      }
+      if(negative) values[count] = -values[count];
+      count++;
+
+      result = digits == 0;
+      if(*p == ',' && count < 3){
+        p++;
+      } else {
+        break;
+      }
+    }
+
+    // ширина по умолчанию - 128 бит
+    if(count == 2) values[2] = 128;
+    result = result || *p != '\0' || count < 2 || values[2] != 128 || values[0] < 1 ||
+             values[0] > S21_ARROW_PRECISION;
+  }
+
+  *scale = values[1];
+
+  return result;
+}
+
+int s21_to_arrow_decimal128(const s21_decimal* src, size_t n, int scale, void* dst){
+
+  int result = src == NULL || dst == NULL || scale < 0 || scale > S21_ARROW_PRECISION;
+
+  if(!result){
+    unsigned char* p = dst;
+
+    // элемент копируется до записи: dst может совпадать с src
+    for(size_t i = 0; i < n; i++) result |= arrow_from_decimal(src[i], scale, p + i * ARROW_VALUE_SIZE);
+  }
+
+  return result;
+}
+
+int s21_from_arrow_decimal128(const void* src, size_t n, int scale, s21_decimal* dst){
+
+  int result = 1;
+
+  if(src != NULL && dst != NULL) result = arrow_to_decimal_n(src, NULL, 0, n, scale, dst);
+
+  return result;
+}
+
+int s21_arrow_export_decimal128(s21_decimal* column, size_t n, int scale, int in_place,
+                                struct ArrowSchema* schema, struct ArrowArray* array){
+
+  int result = 1;
+
+  if(column != NULL && schema != NULL && array != NULL && scale <= S21_ARROW_PRECISION){
+    arrow_schema_private* schema_priv = malloc(sizeof(*schema_priv));
+    arrow_array_private* array_priv = malloc(sizeof(*array_priv));
+    // + 1: malloc(0) может вернуть NULL
+    void* data = in_place ? (void*)column : malloc(n * ARROW_VALUE_SIZE + 1u);
+
+    if(schema_priv != NULL && array_priv != NULL && data != NULL){
+      // наибольший масштаб столбца
+      if(scale < 0){
+        scale = 0;
+        for(size_t i = 0; i < n; i++){
+          if(s21_get_scale(&column[i]) > scale) scale = s21_get_scale(&column[i]);
+        }
+        if(scale > S21_SCALE_MAX) scale = S21_SCALE_MAX;
+      }
+
+      result = s21_to_arrow_decimal128(column, n, scale, data) ? 2 : 0;
+
+      memset(schema, 0, sizeof(*schema));
+      snprintf(schema_priv->format, sizeof(schema_priv->format), "d:%d,%d", S21_ARROW_PRECISION, scale);
+      schema->format = schema_priv->format;
+      schema->name = "";
+      schema->release = arrow_release_schema;
+      schema->private_data = schema_priv;
+
+      memset(array, 0, sizeof(*array));
+      array_priv->buffers[0] = NULL;
+      array_priv->buffers[1] = data;
+      array_priv->data = in_place ? NULL : data;
+      array->length = (int64_t)n;
+      array->n_buffers = 2;
+      array->buffers = array_priv->buffers;
+      array->release = arrow_release_array;
+      array->private_data = array_priv;
+    } else {
+      free(schema_priv);
+      free(array_priv);
+      if(!in_place) free(data);
+    }
+  }
+
+  return result;
+}
+
+int s21_arrow_import_decimal128(const struct ArrowSchema* schema, const struct ArrowArray* array, s21_decimal* dst){
+
+  int result = 1;
+  int scale = 0;
+
+  if(schema != NULL && array != NULL && dst != NULL && schema->release != NULL && array->release != NULL &&
+     !arrow_parse_format(schema->format, &scale) && array->n_buffers == 2 && array->buffers != NULL &&
+     array->buffers[1] != NULL && array->length >= 0 && array->offset >= 0){
+    const unsigned char* data = array->buffers[1];
+
+    result = arrow_to_decimal_n(data + array->offset * ARROW_VALUE_SIZE, array->buffers[0], array->offset,
+                                (size_t)array->length, scale, dst)
+                 ? 2
+                 : 0;
+  }
+
+  return result;
+}
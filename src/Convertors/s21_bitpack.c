@@ -0,0 +1,278 @@
+#include <string.h>
+
+#include "../s21_decimal.h"
+
+/*
+Сжатие столбца с общим масштабом: frame of reference + упаковка бит.
+Значения переводятся в масштабированные int64 (1999 при масштабе 2 -
+19.99), столбец делится на блоки по 128 или 1024 значения, в блоке
+хранится минимум и разности значение - минимум, упакованные подряд
+по width бит, где width - наименьшая ширина для максимальной разности
+блока (0 - все значения блока равны). Формат, все числа little-endian:
+  заголовок 12 байт: uint64 n, uint16 размер блока, uint8 масштаб, 0
+  блок: int64 минимум, uint8 width, ceil(count * width / 64) слов uint64
+Распаковка без ветвлений на значение: слова блока загружаются в буфер
+с нулевым словом в конце, и каждое значение собирается из двух соседних
+слов, так что цикл одинаков для любой ширины.
+*/
+
+#define BITPACK_HEADER_SIZE 12
+#define BITPACK_BLOCK_HEADER_SIZE 9
+
+static uint64_t bitpack_load64(const unsigned char* p){
+
+  uint64_t v = 0u;
+
+  for(int i = 7; i >= 0; i--) v = v << 8 | p[i];
+
+  return v;
+}
+
+static void bitpack_store64(unsigned char* p, uint64_t v){
+  for(int i = 0; i < 8; i++) p[i] = (unsigned char)(v >> (8 * i));
+}
+
+// количество значащих бит (0 для нуля)
+static int bitpack_width(uint64_t x){
+#if defined(__GNUC__)
+  return x ? 64 - __builtin_clzll(x) : 0;
+#else
+  int n = 0;
+  while(x != 0u){
+    x >>= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+static size_t bitpack_words(size_t count, int width){
+  return (count * (size_t)width + 63u) / 64u;
+}
+
+// блок из count значений в p (avail байт), ретюрн размер (0 - не помещается)
+static size_t bitpack_encode_block(const int64_t* v, size_t count, unsigned char* p, size_t avail){
+
+  uint64_t words[S21_BITPACK_BLOCK_LARGE];
+  int64_t min = v[0];
+  int64_t max = v[0];
+  int width;
+  size_t nwords;
+  size_t size = 0;
+
+  for(size_t i = 1; i < count; i++){
+    if(v[i] < min) min = v[i];
+    if(v[i] > max) max = v[i];
+  }
+  width = bitpack_width((uint64_t)max - (uint64_t)min);
+  nwords = bitpack_words(count, width);
+
+  if(avail >= BITPACK_BLOCK_HEADER_SIZE + 8 * nwords){
+    memset(words, 0, 8 * nwords);
+    for(size_t i = 0; width > 0 && i < count; i++){
+      uint64_t r = (uint64_t)v[i] - (uint64_t)min;
+      size_t bit = i * (size_t)width;
+      unsigned off = (unsigned)(bit & 63u);
+
+      words[bit >> 6] |= r << off;
+      if(off + (unsigned)width > 64u) words[(bit >> 6) + 1] |= r >> (64u - off);
+    }
+
+    bitpack_store64(p, (uint64_t)min);
+    p[8] = (unsigned char)width;
+    for(size_t k = 0; k < nwords; k++) bitpack_store64(p + BITPACK_BLOCK_HEADER_SIZE + 8 * k, words[k]);
+    size = BITPACK_BLOCK_HEADER_SIZE + 8 * nwords;
+  }
+
+  return size;
+}
+
+// блок с p (avail байт) в out, ретюрн размер блока (0 - неверный блок)
+static size_t bitpack_decode_block(const unsigned char* p, size_t avail, size_t count, int64_t* out){
+
+  size_t size = 0;
+
+  if(avail >= BITPACK_BLOCK_HEADER_SIZE && p[8] <= 64u){
+    uint64_t min = bitpack_load64(p);
+    int width = p[8];
+    size_t nwords = bitpack_words(count, width);
+
+    if(avail - BITPACK_BLOCK_HEADER_SIZE >= 8 * nwords){
+      // + 1 нулевое слово: старшая часть последнего значения читается всегда
+      uint64_t words[S21_BITPACK_BLOCK_LARGE + 1];
+      uint64_t mask = width == 64 ? ~UINT64_C(0) : (UINT64_C(1) << width) - 1u;
+
+      for(size_t k = 0; k < nwords; k++) words[k] = bitpack_load64(p + BITPACK_BLOCK_HEADER_SIZE + 8 * k);
+      words[nwords] = 0u;
+
+      // (x << 1) << (63 - off) = x << (64 - off), и 0 при off = 0
+      for(size_t i = 0; i < count; i++){
+        size_t bit = i * (size_t)width;
+        unsigned off = (unsigned)(bit & 63u);
+        uint64_t r = words[bit >> 6] >> off | words[(bit >> 6) + 1] << 1 << (63u - off);
+
+        out[i] = (int64_t)(min + (r & mask));
+      }
+
+      size = BITPACK_BLOCK_HEADER_SIZE + 8 * nwords;
+    }
+  }
+
+  return size;
+}
+
+// заголовок: 0 - успех
+static int bitpack_header(const unsigned char* src, size_t len, size_t* n, int* block, int* scale){
+
+  int result = 1;
+
+  if(src != NULL && len >= BITPACK_HEADER_SIZE){
+    uint64_t count = bitpack_load64(src);
+
+    *block = src[8] | src[9] << 8;
+    *scale = src[10];
+    *n = (size_t)count;
+    result = (*block != S21_BITPACK_BLOCK_SMALL && *block != S21_BITPACK_BLOCK_LARGE) || *scale > S21_SCALE_MAX ||
+             src[11] != 0u || (uint64_t)*n != count;
+  }
+
+  return result;
+}
+
+static int bitpack_encode_args(size_t n, int scale, int block, unsigned char* dst, size_t cap, size_t* len){
+
+  int result = dst == NULL || len == NULL || scale < 0 || scale > S21_SCALE_MAX ||
+               (block != S21_BITPACK_BLOCK_SMALL && block != S21_BITPACK_BLOCK_LARGE);
+
+  if(!result && cap < BITPACK_HEADER_SIZE){
+    result = 2;
+  } else if(!result){
+    bitpack_store64(dst, (uint64_t)n);
+    dst[8] = (unsigned char)block;
+    dst[9] = (unsigned char)(block >> 8);
+    dst[10] = (unsigned char)scale;
+    dst[11] = 0u;
+    *len = BITPACK_HEADER_SIZE;
+  }
+
+  return result;
+}
+
+size_t s21_bitpack_bound(size_t n, int block){
+
+  size_t size = 0;
+
+  if(block == S21_BITPACK_BLOCK_SMALL || block == S21_BITPACK_BLOCK_LARGE){
+    size = BITPACK_HEADER_SIZE + (n + (size_t)block - 1u) / (size_t)block * BITPACK_BLOCK_HEADER_SIZE + 8 * n;
+  }
+
+  return size;
+}
+
+int s21_bitpack_encode_int64(const int64_t* src, size_t n, int scale, int block, unsigned char* dst, size_t cap,
+                             size_t* len){
+
+  int result = src == NULL ? 1 : bitpack_encode_args(n, scale, block, dst, cap, len);
+
+  for(size_t i = 0; result == 0 && i < n; i += (size_t)block){
+    size_t count = n - i < (size_t)block ? n - i : (size_t)block;
+    size_t size = bitpack_encode_block(src + i, count, dst + *len, cap - *len);
+
+    result = size == 0u ? 2 : 0;
+    *len += size;
+  }
+
+  return result;
+}
+
+int s21_bitpack_encode(const s21_decimal* src, size_t n, int scale, int block, unsigned char* dst, size_t cap,
+                       size_t* len){
+
+  int result = src == NULL ? 1 : bitpack_encode_args(n, scale, block, dst, cap, len);
+
+  for(size_t i = 0; result == 0 && i < n; i += (size_t)block){
+    int64_t values[S21_BITPACK_BLOCK_LARGE];
+    size_t count = n - i < (size_t)block ? n - i : (size_t)block;
+
+    // без потерь: больший масштаб округлял бы значение
+    for(size_t j = 0; result == 0 && j < count; j++){
+      result = s21_get_scale(&src[i + j]) > scale || s21_from_decimal_to_scaled_int64(src[i + j], scale, &values[j]);
+    }
+
+    if(result == 0){
+      size_t size = bitpack_encode_block(values, count, dst + *len, cap - *len);
+
+      result = size == 0u ? 2 : 0;
+      *len += size;
+    }
+  }
+
+  return result;
+}
+
+int s21_bitpack_info(const unsigned char* src, size_t len, size_t* n, int* scale){
+
+  int result = 1;
+  size_t count = 0;
+  int block = 0;
+  int column_scale = 0;
+
+  if(n != NULL && scale != NULL){
+    result = bitpack_header(src, len, &count, &block, &column_scale);
+    if(result == 0){
+      *n = count;
+      *scale = column_scale;
+    }
+  }
+
+  return result;
+}
+
+int s21_bitpack_decode_int64(const unsigned char* src, size_t len, int64_t* dst){
+
+  size_t n = 0;
+  int block = 0;
+  int scale = 0;
+  int result = dst == NULL || bitpack_header(src, len, &n, &block, &scale);
+  size_t pos = BITPACK_HEADER_SIZE;
+
+  for(size_t i = 0; result == 0 && i < n; i += (size_t)block){
+    size_t count = n - i < (size_t)block ? n - i : (size_t)block;
+    size_t size = bitpack_decode_block(src + pos, len - pos, count, dst + i);
+
+    result = size == 0u;
+    pos += size;
+  }
+
+  return result;
+}
+
+int s21_bitpack_decode(const unsigned char* src, size_t len, s21_decimal* dst){
+
+  size_t n = 0;
+  int block = 0;
+  int scale = 0;
+  int result = dst == NULL || bitpack_header(src, len, &n, &block, &scale);
+  size_t pos = BITPACK_HEADER_SIZE;
+
+  for(size_t i = 0; result == 0 && i < n; i += (size_t)block){
+    int64_t values[S21_BITPACK_BLOCK_LARGE];
+    size_t count = n - i < (size_t)block ? n - i : (size_t)block;
+    size_t size = bitpack_decode_block(src + pos, len - pos, count, values);
+
+    result = size == 0u;
+    pos += size;
+
+    // модуль int64 и масштаб сразу в поля decimal
+    for(size_t j = 0; result == 0 && j < count; j++){
+      uint64_t mag = values[j] < 0 ? 0u - (uint64_t)values[j] : (uint64_t)values[j];
+
+      dst[i + j].bits[0] = (int)(uint32_t)mag;
+      dst[i + j].bits[1] = (int)(uint32_t)(mag >> 32);
+      dst[i + j].bits[2] = 0;
+      dst[i + j].bits[3] = (int)((uint32_t)scale << 16 | (values[j] < 0 ? S21_SIGN_MASK : 0u));
+    }
+  }
+
+  return result;
+}
@@ -0,0 +1,188 @@
+#include "../s21_decimal.h"
+
+/*
+Текстовое представление decimal: [-]цифры[.цифры]
+Вывод сохраняет масштаб (1.50 -> "1.50", 0 при масштабе 2 -> "0.00").
+Разбор принимает [+-]цифры[.цифры] или [+-].цифры, цифр после точки
+может быть больше 28 или больше, чем помещается в 96 бит - лишние
+отбрасываются с банковским округлением. Целая часть должна помещаться
+в 96 бит.
+s21_to_chars: 0 при успехе, 1 при некорректных аргументах или нехватке
+места (вывод без завершающего нуля, *end - конец записанного).
+s21_from_chars: 0 при успехе, 1 если нет ни одной цифры (*end = first),
+2 если целая часть не помещается в 96 бит; при ошибке dst не меняется.
+*/
+
+#define S21_CHARS_MAX_DIGITS 29  // цифр в 96 битах
+#define S21_CHARS_CHUNK 9        // цифр в одном делении на 10^9
+
+// цифры модуля в buf (старшая первой), возвращает их количество
+static int u96_to_digits(const uint32_t a_in[3], char buf[S21_CHARS_MAX_DIGITS + 1]){
+
+  uint32_t a[3];
+  char rev[S21_CHARS_MAX_DIGITS + S21_CHARS_CHUNK];
+  int n = 0;
+
+  u96_copy(a, a_in);
+
+  // по 9 цифр за одно деление, младшие первыми
+  do{
+    uint32_t rem[3];
+    u96_divmod_pow10(a, S21_CHARS_CHUNK, rem);
+
+    uint32_t chunk = rem[0];
+    int last = u96_is_zero(a);
+
+    for(int i = 0; i < S21_CHARS_CHUNK && (!last || chunk != 0u || i == 0); i++){
+      rev[n++] = (char)('0' + chunk % 10u);
+      chunk /= 10u;
+    }
+  } while(!u96_is_zero(a));
+
+  for(int i = 0; i < n; i++) buf[i] = rev[n - 1 - i];
+
+  return n;
+}
+
+int s21_to_chars(const s21_decimal* src, char* first, char* last, char** end){
+
+  int result = 1;
+
+  if(src != NULL && first != NULL && last != NULL && first <= last){
+    uint32_t a[3];
+    char digits[S21_CHARS_MAX_DIGITS + 1];
+
+    u96_from_dec(src, a);
+    int scale = s21_get_scale(src);
+    int n = u96_to_digits(a, digits);
+
+    // ведущие нули дробной части: 5 при масштабе 3 -> 0.005
+    int int_digits = n > scale ? n - scale : 1;
+    int lead_zeros = n > scale ? 0 : scale - n;
+    size_t len = (size_t)s21_get_sign(src) + (size_t)int_digits + (scale > 0 ? 1u : 0u) + (size_t)scale;
+
+    if((size_t)(last - first) >= len){
+      char* p = first;
+
+      if(s21_get_sign(src)) *p++ = '-';
+
+      if(n > scale){
+        for(int i = 0; i < n - scale; i++) *p++ = digits[i];
+      } else {
+        *p++ = '0';
+      }
+
+      if(scale > 0){
+        *p++ = '.';
+        for(int i = 0; i < lead_zeros; i++) *p++ = '0';
+        for(int i = n - scale + lead_zeros; i < n; i++) *p++ = digits[i];
+      }
+
+      if(end != NULL) *end = p;
+      result = 0;
+    }
+  }
+
+  return result;
+}
+
+// a = a * 10 + digit, 1 если не помещается (a не меняется)
+static int u96_push_digit(uint32_t a[3], uint32_t digit){
+
+  uint32_t tmp[3];
+  uint32_t add[3] = {digit, 0u, 0u};
+  int result = 1;
+
+  u96_copy(tmp, a);
+
+  if(u96_mul10(tmp) == 0u && u96_add(tmp, add) == 0){
+    u96_copy(a, tmp);
+    result = 0;
+  }
+
+  return result;
+}
+
+int s21_from_chars(const char* first, const char* last, s21_decimal* dst, const char** end){
+
+  int result = 1;
+  const char* p = first;
+
+  if(first != NULL && last != NULL && dst != NULL && first < last){
+    uint32_t a[3] = {0u, 0u, 0u};
+    int negative = 0;
+    int scale = 0;
+    int digits = 0;
+    int overflow = 0;
+    int dropped = -1;        // первая отброшенная цифра (-1 - нет)
+    int sticky = 0;          // ненулевые цифры после первой отброшенной
+
+    if(*p == '-' || *p == '+'){
+      negative = *p == '-';
+      p++;
+    }
+
+    // целая часть
+    while(p < last && *p >= '0' && *p <= '9'){
+      if(u96_push_digit(a, (uint32_t)(*p - '0'))) overflow = 1;
+      digits++;
+      p++;
+    }
+
+    // дробная часть
+    if(p < last && *p == '.' && (p + 1 < last && p[1] >= '0' && p[1] <= '9')){
+      p++;
+      while(p < last && *p >= '0' && *p <= '9'){
+        uint32_t d = (uint32_t)(*p - '0');
+
+        if(dropped < 0 && scale < S21_SCALE_MAX && u96_push_digit(a, d) == 0){
+          scale++;
+        } else if(dropped < 0){
+          dropped = (int)d;
+        } else if(d != 0u){
+          sticky = 1;
+        }
+        digits++;
+        p++;
+      }
+    }
+
+    if(digits == 0){
+      p = first;
+    } else if(overflow){
+      result = 2;
+    } else {
+      // банковское округление по отброшенным цифрам
+      if(dropped > 5 || (dropped == 5 && (sticky || (a[0] & 1u)))){
+        uint32_t one[3] = {1u, 0u, 0u};
+
+        // 2^96 - 1 + 1 не помещается: отбрасываем еще одну цифру
+        if(u96_add(a, one)){
+          if(scale == 0){
+            overflow = 1;
+          } else {
+            a[0] = a[1] = a[2] = 0xFFFFFFFFu;
+            uint32_t rem = u96_div10(a);
+            scale--;
+            if(rem > 5u || (rem == 5u && (dropped != 0 || sticky || (a[0] & 1u)))) (void)u96_add(a, one);
+          }
+        }
+      }
+
+      if(overflow){
+        result = 2;
+      } else {
+        s21_reset_value(dst);
+        u96_to_dec(a, dst);
+        s21_set_scale(dst, scale);
+        s21_set_sign(dst, negative);
+        if(dropped >= 0) s21_context_raise(S21_FLAG_ROUNDED | ((dropped || sticky) ? S21_FLAG_INEXACT : 0u));
+        result = 0;
+      }
+    }
+  }
+
+  if(end != NULL) *end = p;
+
+  return result;
+}
@@ -0,0 +1,251 @@
+#include "../s21_decimal.h"
+
+/*
+Конвертация между decimal и IEEE 754-2008 decimal128 без строк.
+Значение decimal128: (-1)^s * C * 10^(E - 6176), C до 34 цифр.
+  BID: биты 126-113 - порядок, 112-0 - C двоичным целым (если биты
+       126-125 = 11, C >= 2^113 - неканонично, считается нулем)
+  DPD: биты 126-122 - поле G (старшие биты порядка и первая цифра C),
+       121-110 - младшие 12 бит порядка, 109-0 - 11 декад по 10 бит,
+       каждая кодирует 3 цифры (densely packed decimal)
+G = 1111x - бесконечность или NaN в обеих кодировках.
+Мантисса и порядок переводятся в decimal s21_coef_to_decimal (одно
+банковское округление, флаги ROUNDED / INEXACT в контексте).
+Обратно всегда точно: 96 бит < 10^29 и масштаб 0..28.
+*/
+
+#define D128_SPECIAL 0x1Eu      // G = 1111x
+#define D128_DECLETS 11
+#define D128_CHUNK 1000000000u  // 9 цифр - 3 декады
+
+// 10^34 - 1: наибольшая каноническая мантисса
+static const uint32_t d128_coef_max[4] = {0xFFFFFFFFu, 0x378D8E63u, 0xBEAD87C0u, 0x0001ED09u};
+
+// width бит начиная с бита pos
+static uint32_t d128_field(const s21_decimal128* d, int pos, int width){
+
+  uint64_t v;
+
+  if(pos >= 64){
+    v = d->w[1] >> (pos - 64);
+  } else {
+    v = d->w[0] >> pos;
+    if(pos + width > 64) v |= d->w[1] << (64 - pos);
+  }
+
+  return (uint32_t)(v & ((UINT64_C(1) << width) - 1u));
+}
+
+// записать width бит v начиная с бита pos (поле было нулевым)
+static void d128_put(s21_decimal128* d, int pos, int width, uint64_t v){
+  if(pos >= 64){
+    d->w[1] |= v << (pos - 64);
+  } else {
+    d->w[0] |= v << pos;
+    if(pos + width > 64) d->w[1] |= v >> (64 - pos);
+  }
+}
+
+// 3 цифры (0..999) в декаду DPD
+/*
+Цифры 0..7 (малые) хранятся тремя битами, 8 и 9 (большие) - одним
+младшим битом, бит v = 1 и биты wx / st говорят, какие цифры большие.
+*/
+static unsigned dpd_encode(unsigned v){
+
+  unsigned d2 = v / 100u, d1 = v / 10u % 10u, d0 = v % 10u;
+  unsigned large = (d2 > 7u) << 2 | (d1 > 7u) << 1 | (d0 > 7u);
+  unsigned b = 0u;
+
+  if(large == 0u){
+    b = d2 << 7 | d1 << 4 | d0;
+  } else if(large == 1u){
+    b = d2 << 7 | d1 << 4 | 0x8u;
+  } else if(large == 2u){
+    b = d2 << 7 | (d0 >> 1 & 3u) << 5 | (d1 & 1u) << 4 | 0xAu;
+  } else if(large == 3u){
+    b = d2 << 7 | 0x40u | (d1 & 1u) << 4 | 0xEu;
+  } else if(large == 4u){
+    b = (d0 >> 1 & 3u) << 8 | (d2 & 1u) << 7 | d1 << 4 | 0xCu;
+  } else if(large == 5u){
+    b = (d1 >> 1 & 3u) << 8 | (d2 & 1u) << 7 | 0x20u | (d1 & 1u) << 4 | 0xEu;
+  } else if(large == 6u){
+    b = (d0 >> 1 & 3u) << 8 | (d2 & 1u) << 7 | (d1 & 1u) << 4 | 0xEu;
+  } else {
+    b = (d2 & 1u) << 7 | 0x60u | (d1 & 1u) << 4 | 0xEu;
+  }
+
+  // младший бит последней цифры хранится всегда на месте
+  return large ? b | (d0 & 1u) : b;
+}
+
+// декада DPD в 3 цифры (неканонические декады читаются как большие цифры)
+static unsigned dpd_decode(unsigned b){
+
+  unsigned d2 = b >> 7 & 7u, d1 = b >> 4 & 7u, d0 = b & 7u;
+
+  if(b & 0x8u){
+    unsigned wx = b >> 1 & 3u;
+    unsigned st = b >> 5 & 3u;
+    unsigned big_2 = 8u + (b >> 7 & 1u), big_1 = 8u + (b >> 4 & 1u), big_0 = 8u + (b & 1u);
+
+    if(wx == 0u){
+      d0 = big_0;
+    } else if(wx == 1u){
+      d1 = big_1;
+      d0 = st << 1 | (b & 1u);
+    } else if(wx == 2u){
+      d2 = big_2;
+      d0 = (b >> 8 & 3u) << 1 | (b & 1u);
+    } else if(st == 0u){
+      d2 = big_2;
+      d1 = big_1;
+      d0 = (b >> 8 & 3u) << 1 | (b & 1u);
+    } else if(st == 1u){
+      d1 = (b >> 8 & 3u) << 1 | (b >> 4 & 1u);
+      d2 = big_2;
+      d0 = big_0;
+    } else if(st == 2u){
+      d1 = big_1;
+      d0 = big_0;
+    } else {
+      d2 = big_2;
+      d1 = big_1;
+      d0 = big_0;
+    }
+  }
+
+  return d2 * 100u + d1 * 10u + d0;
+}
+
+// a = a / d (d < 2^32), ретюрн остаток
+static uint32_t d128_div_small(uint32_t* a, int n, uint32_t d){
+
+  uint64_t rem = 0u;
+
+  for(int i = n - 1; i >= 0; i--){
+    uint64_t cur = (rem << 32) | a[i];
+    a[i] = (uint32_t)(cur / d);
+    rem = cur % d;
+  }
+
+  return (uint32_t)rem;
+}
+
+int s21_from_decimal128_to_decimal(s21_decimal128 src, s21_decimal128_encoding encoding, s21_decimal* dst){
+
+  int result = 1;
+  unsigned g = d128_field(&src, 122, 5);
+
+  if(dst != NULL && (g & D128_SPECIAL) != D128_SPECIAL){
+    uint32_t c[8] = {0};
+    int sign = (int)(src.w[1] >> 63);
+    int exp;
+
+    if(encoding == S21_DECIMAL128_BID){
+      if((g >> 3) == 3u){
+        // C >= 2^113 больше 10^34 - 1: неканоническая мантисса, ноль
+        exp = (int)d128_field(&src, 111, 14);
+      } else {
+        exp = (int)d128_field(&src, 113, 14);
+        c[0] = (uint32_t)src.w[0];
+        c[1] = (uint32_t)(src.w[0] >> 32);
+        c[2] = (uint32_t)src.w[1];
+        c[3] = (uint32_t)(src.w[1] >> 32) & 0x1FFFFu;
+        if(uN_compare(c, d128_coef_max, 4) > 0) c[0] = c[1] = c[2] = c[3] = 0u;
+      }
+    } else {
+      unsigned lead = g & 7u;
+      unsigned exp_hi = g >> 3;
+
+      if(exp_hi == 3u){
+        lead = 8u + (g & 1u);
+        exp_hi = g >> 1 & 3u;
+      }
+      exp = (int)(exp_hi << 12 | d128_field(&src, 110, 12));
+
+      // старшая цифра, затем декады от старшей: C = C * 1000 + декада
+      c[0] = lead;
+      for(int i = D128_DECLETS - 1; i >= 0; i--){
+        (void)uN_mul_small(c, 4, 1000u);
+        (void)uN_add_small(c, 4, dpd_decode(d128_field(&src, 10 * i, 10)));
+      }
+    }
+
+    result = s21_coef_to_decimal(c, exp - S21_DECIMAL128_BIAS, sign, dst);
+  }
+
+  return result;
+}
+
+int s21_from_decimal_to_decimal128(const s21_decimal* src, s21_decimal128_encoding encoding, s21_decimal128* dst){
+
+  int result = 1;
+
+  if(src != NULL && dst != NULL && s21_get_scale(src) <= S21_SCALE_MAX){
+    uint32_t c[3];
+    uint64_t exp = (uint64_t)(S21_DECIMAL128_BIAS - s21_get_scale(src));
+
+    u96_from_dec(src, c);
+    dst->w[0] = 0u;
+    dst->w[1] = (uint64_t)s21_get_sign(src) << 63;
+
+    if(encoding == S21_DECIMAL128_BID){
+      dst->w[0] = (uint64_t)c[1] << 32 | c[0];
+      dst->w[1] |= exp << 49 | c[2];
+    } else {
+      // 96 бит < 10^29: старшая цифра 0, декады по 9 цифр за деление
+      d128_put(dst, 122, 5, exp >> 12 << 3);
+      d128_put(dst, 110, 12, exp & 0xFFFu);
+      for(int i = 0; i < D128_DECLETS; i += 3){
+        uint32_t chunk = d128_div_small(c, 3, D128_CHUNK);
+
+        for(int j = i; j < i + 3 && j < D128_DECLETS; j++){
+          d128_put(dst, 10 * j, 10, dpd_encode(chunk % 1000u));
+          chunk /= 1000u;
+        }
+      }
+    }
+
+    result = 0;
+  }
+
+  return result;
+}
+
+// Пакетная конвертация decimal128 -> decimal, ошибочные элементы получают 0
+int s21_from_decimal128_to_decimal_batch(const s21_decimal128* src, s21_decimal128_encoding encoding,
+                                         s21_decimal* dst, size_t n){
+
+  int result = (src == NULL || dst == NULL);
+
+  if(!result){
+    for(size_t i = 0; i < n; i++){
+      if(s21_from_decimal128_to_decimal(src[i], encoding, &dst[i]) != 0){
+        s21_decimal zero = {{0, 0, 0, 0}};
+        dst[i] = zero;
+        result = 1;
+      }
+    }
+  }
+
+  return result;
+}
+
+// Пакетная конвертация decimal -> decimal128, ошибочные элементы получают 0
+int s21_from_decimal_to_decimal128_batch(const s21_decimal* src, s21_decimal128_encoding encoding,
+                                         s21_decimal128* dst, size_t n){
+
+  int result = (src == NULL || dst == NULL);
+
+  if(!result){
+    for(size_t i = 0; i < n; i++){
+      if(s21_from_decimal_to_decimal128(&src[i], encoding, &dst[i]) != 0){
+        dst[i].w[0] = dst[i].w[1] = 0u;
+        result = 1;
+      }
+    }
+  }
+
+  return result;
+}
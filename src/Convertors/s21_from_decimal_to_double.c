@@ -0,0 +1,72 @@
+#include <string.h>  // memcpy для сборки double из битов
+
+#include "../s21_decimal.h"
+
+/*
+0 при успехе, 1 при ошибке (некорректный указатель или масштаб > 28)
+1. Мантисса < 2^53 и масштаб <= 22 - оба числа точно представимы в double,
+   одно деление дает корректно округленный результат
+2. Иначе частное мантиссы и 10^scale считается в целых числах умножением
+   на обратное (s21_decimal_to_binary, точное деление только у середины)
+   и double собирается из 53 бит мантиссы и порядка
+3. Применяет знак
+*/
+
+// число из 53 бит мантиссы и двоичного порядка (всегда нормализованное)
+static double binary64_from_parts(uint64_t mant, int exp2){
+
+  uint64_t biased = (uint64_t)(exp2 + 52 + 1023);
+  uint64_t bits = (biased << 52) | (mant & 0x000FFFFFFFFFFFFFull);
+
+  double result;
+  memcpy(&result, &bits, sizeof(result));
+
+  return result;
+}
+
+// перевод одного значения без проверок указателя
+static int decimal_to_double(const s21_decimal* src, double* dst){
+
+  int result = 0;
+  int scale = s21_get_scale(src);
+  uint64_t lo = ((uint64_t)(uint32_t)src->bits[1] << 32) | (uint32_t)src->bits[0];
+
+  if(scale > S21_SCALE_MAX){
+    *dst = 0.0;
+    result = 1;
+  } else if(s21_is_zero(src)){
+    *dst = 0.0;
+  } else if(src->bits[2] == 0 && lo < (1ull << 53) && scale <= S21_POW10_F64_MAX){
+    *dst = (double)lo / s21_pow10_f64[scale];
+  } else {
+    uint64_t mant;
+    int exp2;
+    s21_decimal_to_binary(src, 53, &mant, &exp2);
+    *dst = binary64_from_parts(mant, exp2);
+  }
+
+  if(s21_get_sign(src)) *dst = -*dst;
+
+  return result;
+}
+
+int s21_from_decimal_to_double(s21_decimal src, double* dst){
+
+  int result = 1;
+
+  if(dst != NULL) result = decimal_to_double(&src, dst);
+
+  return result;
+}
+
+// перевод массива значений, 1 если хотя бы одно значение некорректно
+int s21_from_decimal_to_double_batch(const s21_decimal* src, double* dst, size_t n){
+
+  int result = (src == NULL || dst == NULL);
+
+  if(!result){
+    for(size_t i = 0; i < n; i++) result |= decimal_to_double(&src[i], &dst[i]);
+  }
+
+  return result;
+}
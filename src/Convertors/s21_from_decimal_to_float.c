@@ -1,42 +1,72 @@
+#include <string.h>  // memcpy для сборки float из битов
 
 #include "../s21_decimal.h"
 
-#include <math.h>  // Математические функции (pow)
-
 /*
-0 при успехе, 1 при ошибке (некорректный указатель)
-1. Собирает 96-битную мантиссу в double
-2. Применяет масштаб (деление на 10^scale)
+0 при успехе, 1 при ошибке (некорректный указатель или масштаб > 28)
+1. Мантисса < 2^24 и масштаб <= 10 - оба числа точно представимы во float,
+   одно деление дает корректно округленный результат
+2. Иначе частное мантиссы и 10^scale считается в целых числах умножением
+   на обратное (s21_decimal_to_binary, точное деление только у середины)
+   и float собирается из 24 бит мантиссы и порядка
 3. Применяет знак
-4. Приводит к float (возможна потеря точности)
 */
 
-int s21_from_decimal_to_float(s21_decimal src, float* dst){
-
-  if(dst != NULL){
+// число из 24 бит мантиссы и двоичного порядка (всегда нормализованное)
+static float binary32_from_parts(uint64_t mant, int exp2){
 
-    double mantissa = 0.0;
+  uint32_t biased = (uint32_t)(exp2 + 23 + 127);
+  uint32_t bits = (biased << 23) | ((uint32_t)mant & 0x007FFFFFu);
 
-    // вначале приводим к типу беззнаковому, и это число в дабл
-    /*
-    В двоичном: 1111 0000 0000 0000 0000 0000 0000 0000
-    Как unsigned: 4,026,531,840
-    Как signed: -268,435,456 (из-за знакового бита)
-    */
-    mantissa += (double)(uint32_t)(src.bits[0]);
-    mantissa += (double)(uint32_t)(src.bits[1]) * pow(2,32);
-    mantissa += (double)(uint32_t)(src.bits[2]) * pow(2,64);
+  float result;
+  memcpy(&result, &bits, sizeof(result));
 
-    int scale = s21_get_scale(&src);
+  return result;
+}
 
-    if(scale > 0) mantissa /= pow(10. ,scale);
+// перевод одного значения без проверок указателя
+static int decimal_to_float(const s21_decimal* src, float* dst){
 
-    if(s21_get_sign(&src)) mantissa = -mantissa;
+  int result = 0;
+  int scale = s21_get_scale(src);
+  uint32_t lo = (uint32_t)src->bits[0];
 
-    *dst = (float)mantissa;
+  if(scale > S21_SCALE_MAX){
+    *dst = 0.0f;
+    result = 1;
+  } else if(s21_is_zero(src)){
+    *dst = 0.0f;
+  } else if(src->bits[1] == 0 && src->bits[2] == 0 && lo < (1u << 24) && scale <= 10){
+    *dst = (float)lo / (float)s21_pow10_f64[scale];
+  } else {
+    uint64_t mant;
+    int exp2;
+    s21_decimal_to_binary(src, 24, &mant, &exp2);
+    *dst = binary32_from_parts(mant, exp2);
   }
 
-  return (dst == NULL);
+  if(s21_get_sign(src)) *dst = -*dst;
 
+  return result;
 }
 
+int s21_from_decimal_to_float(s21_decimal src, float* dst){
+
+  int result = 1;
+
+  if(dst != NULL) result = decimal_to_float(&src, dst);
+
+  return result;
+}
+
+// перевод массива значений, 1 если хотя бы одно значение некорректно
+int s21_from_decimal_to_float_batch(const s21_decimal* src, float* dst, size_t n){
+
+  int result = (src == NULL || dst == NULL);
+
+  if(!result){
+    for(size_t i = 0; i < n; i++) result |= decimal_to_float(&src[i], &dst[i]);
+  }
+
+  return result;
+}
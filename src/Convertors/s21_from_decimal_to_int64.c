@@ -0,0 +1,263 @@
+#include "../s21_decimal.h"
+
+/*
+Конвертация decimal в 64 и 128 бит целые без вызова s21_truncate.
+0 при успехе, 1 при ошибке (некорректный указатель, масштаб > 28
+или выход за пределы типа)
+Мантисса делится на 10^scale за один шаг (u96_divmod_pow10),
+дробная часть отбрасывается (округление к нулю), как в s21_from_decimal_to_int.
+*/
+
+// целая часть модуля decimal (округление к нулю), 1 - некорректный масштаб
+static int decimal_trunc_u96(const s21_decimal* src, uint32_t a[3]){
+
+  int result = 0;
+  int scale = s21_get_scale(src);
+
+  u96_from_dec(src, a);
+
+  if(scale > S21_SCALE_MAX){
+    result = 1;
+  } else {
+    uint32_t rem[3];
+    u96_divmod_pow10(a, scale, rem);
+  }
+
+  return result;
+}
+
+// модуль и знак в int64 с проверкой диапазона
+static int magnitude_to_int64(const uint32_t a[3], int negative, int64_t* dst){
+
+  int result = 1;
+  uint64_t mag = ((uint64_t)a[1] << 32) | a[0];
+
+  if(a[2] == 0u){
+    if(!negative && mag <= (uint64_t)INT64_MAX){
+      *dst = (int64_t)mag;
+      result = 0;
+    } else if(negative && mag <= (uint64_t)INT64_MAX + 1u){
+      // -(2^63) получаем через беззнаковую арифметику
+      *dst = (int64_t)(0u - mag);
+      result = 0;
+    }
+  }
+
+  return result;
+}
+
+int s21_from_decimal_to_int64(s21_decimal src, int64_t* dst){
+
+  int result = 1;
+
+  if(dst != NULL){
+    uint32_t a[3];
+
+    if(decimal_trunc_u96(&src, a) == 0)
+      result = magnitude_to_int64(a, s21_get_sign(&src), dst);
+  }
+
+  return result;
+}
+
+int s21_from_decimal_to_uint64(s21_decimal src, uint64_t* dst){
+
+  int result = 1;
+
+  if(dst != NULL){
+    uint32_t a[3];
+
+    if(decimal_trunc_u96(&src, a) == 0 && a[2] == 0u){
+      uint64_t mag = ((uint64_t)a[1] << 32) | a[0];
+
+      // отрицательное допустимо только если целая часть равна 0 (-0.5 -> 0)
+      if(!s21_get_sign(&src) || mag == 0u){
+        *dst = mag;
+        result = 0;
+      }
+    }
+  }
+
+  return result;
+}
+
+// Конвертация в масштабированное целое: value * 10^scale
+/*
+Например, 19.99 при scale = 2 дает 1999 (центы).
+Лишние знаки округляются банковским округлением,
+недостающие дописываются нулями (умножение на 10^k).
+*/
+int s21_from_decimal_to_scaled_int64(s21_decimal src, int scale, int64_t* dst){
+
+  int result = 1;
+  int src_scale = s21_get_scale(&src);
+
+  if(dst != NULL && scale >= 0 && scale <= S21_SCALE_MAX && src_scale <= S21_SCALE_MAX){
+    uint32_t a[3];
+    u96_from_dec(&src, a);
+    result = 0;
+
+    if(src_scale > scale){
+      int k = src_scale - scale;
+      uint32_t rem[3];
+      u96_divmod_pow10(a, k, rem);
+
+      // банковское округление: сравниваем 2 * остаток с 10^k
+      (void)u96_add(rem, rem);
+      int cmp = u96_compare(rem, s21_pow10_u96[k]);
+
+      if(cmp > 0 || (cmp == 0 && (a[0] & 1u))){
+        uint32_t one[3] = {1u, 0u, 0u};
+        (void)u96_add(a, one);
+      }
+    } else if(src_scale < scale){
+      result = u96_mul_pow10(a, scale - src_scale);
+    }
+
+    if(result == 0) result = magnitude_to_int64(a, s21_get_sign(&src), dst);
+  }
+
+  return result;
+}
+
+#ifdef __SIZEOF_INT128__
+int s21_from_decimal_to_int128(s21_decimal src, __int128* dst){
+
+  int result = 1;
+
+  if(dst != NULL){
+    uint32_t a[3];
+
+    if(decimal_trunc_u96(&src, a) == 0){
+      // 96 бит модуля всегда помещаются в __int128
+      unsigned __int128 mag = ((unsigned __int128)a[2] << 64) |
+                              ((unsigned __int128)a[1] << 32) | a[0];
+
+      if(s21_get_sign(&src)) *dst = -(__int128)mag;
+      else *dst = (__int128)mag;
+
+      result = 0;
+    }
+  }
+
+  return result;
+}
+#endif
+
+// Пакетная конвертация в int64 для общего целевого масштаба
+/*
+Первый проход без ветвлений обрабатывает значения, у которых масштаб уже
+равен целевому, а мантисса < 2^63 (векторизуется компилятором). Остальные
+значения досчитываются вторым проходом через поэлементную функцию:
+с отбрасыванием дробной части (rounding = 0) или с банковским округлением.
+Ошибочные элементы получают 0, функция возвращает 1.
+*/
+static int int64_batch(const s21_decimal* src, int scale, int64_t* dst, size_t n, int rounding){
+
+  int result = 0;
+  uint32_t scale_bits = (uint32_t)scale << S21_SCALE_SHIFT;
+  uint32_t slow = 0u;
+
+  for(size_t i = 0; i < n; i++){
+    uint32_t meta = (uint32_t)src[i].bits[3];
+    uint64_t mag = ((uint64_t)(uint32_t)src[i].bits[1] << 32) | (uint32_t)src[i].bits[0];
+    uint64_t neg = meta >> 31;
+
+    dst[i] = (int64_t)((mag ^ (0u - neg)) + neg);
+    slow |= (uint32_t)src[i].bits[2] | ((meta & S21_SCALE_MASK) ^ scale_bits) | (uint32_t)(mag >> 63);
+  }
+
+  for(size_t i = 0; slow != 0u && i < n; i++){
+    uint32_t meta = (uint32_t)src[i].bits[3];
+
+    if(src[i].bits[2] != 0 || (meta & S21_SCALE_MASK) != scale_bits || src[i].bits[1] < 0){
+      int err;
+      if(rounding) err = s21_from_decimal_to_scaled_int64(src[i], scale, &dst[i]);
+      else err = s21_from_decimal_to_int64(src[i], &dst[i]);
+
+      if(err){
+        dst[i] = 0;
+        result = 1;
+      }
+    }
+  }
+
+  return result;
+}
+
+// Пакетная конвертация decimal -> int64 (дробная часть отбрасывается)
+int s21_from_decimal_to_int64_batch(const s21_decimal* src, int64_t* dst, size_t n){
+
+  int result = 1;
+
+  if(src != NULL && dst != NULL) result = int64_batch(src, 0, dst, n, 0);
+
+  return result;
+}
+
+// Пакетная конвертация в масштабированные int64 (банковское округление)
+int s21_from_decimal_to_scaled_int64_batch(const s21_decimal* src, int scale, int64_t* dst, size_t n){
+
+  int result = 1;
+
+  if(src != NULL && dst != NULL && scale >= 0 && scale <= S21_SCALE_MAX)
+    result = int64_batch(src, scale, dst, n, 1);
+
+  return result;
+}
+
+// Пакетная конвертация decimal -> uint64, ошибочные элементы получают 0
+int s21_from_decimal_to_uint64_batch(const s21_decimal* src, uint64_t* dst, size_t n){
+
+  int result = (src == NULL || dst == NULL);
+
+  if(!result){
+    uint32_t slow = 0u;
+
+    for(size_t i = 0; i < n; i++){
+      dst[i] = ((uint64_t)(uint32_t)src[i].bits[1] << 32) | (uint32_t)src[i].bits[0];
+      slow |= (uint32_t)src[i].bits[2] | (uint32_t)src[i].bits[3];
+    }
+
+    for(size_t i = 0; slow != 0u && i < n; i++){
+      if((src[i].bits[2] != 0 || src[i].bits[3] != 0) && s21_from_decimal_to_uint64(src[i], &dst[i])){
+        dst[i] = 0;
+        result = 1;
+      }
+    }
+  }
+
+  return result;
+}
+
+#ifdef __SIZEOF_INT128__
+// Пакетная конвертация decimal -> __int128 (дробная часть отбрасывается)
+int s21_from_decimal_to_int128_batch(const s21_decimal* src, __int128* dst, size_t n){
+
+  int result = (src == NULL || dst == NULL);
+
+  if(!result){
+    uint32_t slow = 0u;
+
+    for(size_t i = 0; i < n; i++){
+      uint32_t meta = (uint32_t)src[i].bits[3];
+      unsigned __int128 mag = ((unsigned __int128)(uint32_t)src[i].bits[2] << 64) |
+                              ((unsigned __int128)(uint32_t)src[i].bits[1] << 32) |
+                              (uint32_t)src[i].bits[0];
+      unsigned __int128 neg = meta >> 31;
+
+      dst[i] = (__int128)((mag ^ (0u - neg)) + neg);
+      slow |= meta & S21_SCALE_MASK;
+    }
+
+    for(size_t i = 0; slow != 0u && i < n; i++){
+      if(((uint32_t)src[i].bits[3] & S21_SCALE_MASK) != 0u && s21_from_decimal_to_int128(src[i], &dst[i])){
+        dst[i] = 0;
+        result = 1;
+      }
+    }
+  }
+
+  return result;
+}
+#endif
@@ -26,22 +26,6 @@ static uint32_t u96_add_small(uint32_t a[3], uint32_t add){
   return (uint32_t)carry;
 }
 
-// умножить на 10
-static uint32_t u96_mul_small(uint32_t a[3], uint32_t k){
-
-  uint64_t carry = 0u;
-  uint64_t c;
-
-  for(int i = 0; i < 3; i++){
-    // умножаем каждый разряд на К
-    c = (uint64_t)a[i] * (uint64_t)k + carry;
-    a[i] = (uint32_t)(c & 0xFFFFFFFF);
-    carry = c >> 32;
-  }
-
-  return (uint32_t)carry;
-}
-
 // деление с округлением по правилам банковского округления
 static void u96_round_div10(uint32_t a[3]){
 
@@ -54,21 +38,6 @@ static void u96_round_div10(uint32_t a[3]){
   }
 }
 
-// используется для увеличения масштаба числа
-static int u96_mul_pow10(uint32_t a[3], int k){
-
-  uint32_t result = 0;;
-  for(int i = 0; i < k; i++){
-    result = u96_mul_small(a, 10u);
-    if(result != 0u){
-      result = 1;
-      break;
-    }
-  }
-
-  return result;
-}
-
 //
 static uint64_t round_ties_to_even(double x){
 
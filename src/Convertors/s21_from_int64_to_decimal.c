@@ -0,0 +1,156 @@
+#include "../s21_decimal.h"
+
+/*
+Конвертация 64 и 128 бит целых в decimal.
+0 при успехе, 1 при ошибке (некорректный указатель, масштаб вне 0..28
+или значение больше 96 бит)
+Модуль считается без ветвлений: mag = (v ^ mask) - mask, где mask - знак,
+что позволяет компилятору векторизовать пакетные версии.
+*/
+
+// записать 64 бит модуль, знак и масштаб в decimal
+static inline void decimal_from_u64(uint64_t mag, uint32_t negative, int scale, s21_decimal* dst){
+  dst->bits[0] = (int)(uint32_t)mag;
+  dst->bits[1] = (int)(uint32_t)(mag >> 32);
+  dst->bits[2] = 0;
+  dst->bits[3] = (int)((negative << 31) | ((uint32_t)scale << S21_SCALE_SHIFT));
+}
+
+// модуль int64 без ветвлений (INT64_MIN дает 2^63)
+static inline uint64_t abs_i64(int64_t v, uint32_t* negative){
+  uint64_t mask = 0u - ((uint64_t)v >> 63);
+  *negative = (uint32_t)(mask & 1u);
+  return ((uint64_t)v ^ mask) - mask;
+}
+
+int s21_from_int64_to_decimal(int64_t src, s21_decimal* dst){
+
+  int result = 1;
+
+  if(dst != NULL){
+    uint32_t negative;
+    uint64_t mag = abs_i64(src, &negative);
+    decimal_from_u64(mag, negative, 0, dst);
+    result = 0;
+  }
+
+  return result;
+}
+
+int s21_from_uint64_to_decimal(uint64_t src, s21_decimal* dst){
+
+  int result = 1;
+
+  if(dst != NULL){
+    decimal_from_u64(src, 0u, 0, dst);
+    result = 0;
+  }
+
+  return result;
+}
+
+// Масштабированное целое в decimal: 1999 при scale = 2 -> 19.99
+int s21_from_scaled_int64_to_decimal(int64_t src, int scale, s21_decimal* dst){
+
+  int result = 1;
+
+  if(dst != NULL && scale >= 0 && scale <= S21_SCALE_MAX){
+    uint32_t negative;
+    uint64_t mag = abs_i64(src, &negative);
+    decimal_from_u64(mag, negative, scale, dst);
+    result = 0;
+  }
+
+  return result;
+}
+
+#ifdef __SIZEOF_INT128__
+int s21_from_int128_to_decimal(__int128 src, s21_decimal* dst){
+
+  int result = 1;
+
+  if(dst != NULL){
+    unsigned __int128 mag = (unsigned __int128)src;
+    uint32_t negative = 0u;
+
+    if(src < 0){
+      mag = 0u - mag;
+      negative = 1u;
+    }
+
+    // в мантиссу помещается только 96 бит
+    if((mag >> 96) == 0u){
+      dst->bits[0] = (int)(uint32_t)mag;
+      dst->bits[1] = (int)(uint32_t)(mag >> 32);
+      dst->bits[2] = (int)(uint32_t)(mag >> 64);
+      dst->bits[3] = (int)(negative << 31);
+      result = 0;
+    }
+  }
+
+  return result;
+}
+#endif
+
+// Пакетная конвертация int64 -> decimal
+int s21_from_int64_to_decimal_batch(const int64_t* src, s21_decimal* dst, size_t n){
+
+  int result = (src == NULL || dst == NULL);
+
+  if(!result){
+    for(size_t i = 0; i < n; i++){
+      uint32_t negative;
+      uint64_t mag = abs_i64(src[i], &negative);
+      decimal_from_u64(mag, negative, 0, &dst[i]);
+    }
+  }
+
+  return result;
+}
+
+// Пакетная конвертация uint64 -> decimal
+int s21_from_uint64_to_decimal_batch(const uint64_t* src, s21_decimal* dst, size_t n){
+
+  int result = (src == NULL || dst == NULL);
+
+  if(!result){
+    for(size_t i = 0; i < n; i++) decimal_from_u64(src[i], 0u, 0, &dst[i]);
+  }
+
+  return result;
+}
+
+// Пакетная конвертация масштабированных int64 с общим масштабом -> decimal
+int s21_from_scaled_int64_to_decimal_batch(const int64_t* src, int scale, s21_decimal* dst, size_t n){
+
+  int result = (src == NULL || dst == NULL || scale < 0 || scale > S21_SCALE_MAX);
+
+  if(!result){
+    for(size_t i = 0; i < n; i++){
+      uint32_t negative;
+      uint64_t mag = abs_i64(src[i], &negative);
+      decimal_from_u64(mag, negative, scale, &dst[i]);
+    }
+  }
+
+  return result;
+}
+
+#ifdef __SIZEOF_INT128__
+// Пакетная конвертация __int128 -> decimal, значения больше 96 бит получают 0
+int s21_from_int128_to_decimal_batch(const __int128* src, s21_decimal* dst, size_t n){
+
+  int result = (src == NULL || dst == NULL);
+
+  if(!result){
+    for(size_t i = 0; i < n; i++){
+      if(s21_from_int128_to_decimal(src[i], &dst[i])){
+        s21_reset_value(&dst[i]);
+        result = 1;
+      }
+    }
+  }
+
+  return result;
+}
+#endif
@@ -0,0 +1,279 @@
+#include <string.h>
+
+#include "../s21_decimal.h"
+
+/*
+Двоичный формат PostgreSQL NUMERIC (numeric_send / numeric_recv), все
+поля big-endian:
+  int16 ndigits, int16 weight, uint16 sign, int16 dscale,
+  ndigits цифр int16 по основанию 10000 (NBASE), от старшей.
+Значение = sum(digit[i] * 10000^(weight - i)), dscale - цифр после
+запятой в тексте. Группы выровнены по запятой, поэтому мантисса
+домножается до масштаба, кратного 4. Перевод идет порциями по 10^8 (две
+цифры NBASE): деление и умножение на 10^8 и 10^4 - умножением на
+обратное, без деления по одной цифре.
+*/
+
+#define PG_HEADER_SIZE 8
+#define PG_NBASE 10000u
+#define PG_CHUNK 100000000u  // 10^8 - две цифры NBASE
+#define PG_DSCALE_MASK 0x3FFF
+#define PG_FIELD_NULL (-1)   // длина поля NULL в COPY BINARY
+
+// в мантиссе из 4 разрядов помещаются 9 цифр NBASE (36 знаков < 2^120)
+#define PG_DIGITS_MAX 9
+
+// знаков в мантиссе: 9 цифр NBASE и цифра sticky
+#define PG_COEF_DIGITS (4 * PG_DIGITS_MAX + 1)
+
+// x / 10^8 = x * PG_RECIP_CHUNK >> 90 точно для x < 10^8 * 2^32
+#define PG_RECIP_CHUNK UINT64_C(0xABCC77118461CEFD)
+#define PG_RECIP_CHUNK_SHIFT 90
+
+// x / 10^4 = x * PG_RECIP_NBASE >> 45 точно для x < 2^32
+#define PG_RECIP_NBASE UINT64_C(0xD1B71759)
+#define PG_RECIP_NBASE_SHIFT 45
+
+static void pg_put16(unsigned char* p, unsigned v){
+  p[0] = (unsigned char)(v >> 8);
+  p[1] = (unsigned char)v;
+}
+
+static unsigned pg_get16(const unsigned char* p){
+  return (unsigned)p[0] << 8 | p[1];
+}
+
+// int16 со знаком
+static int pg_get_int16(const unsigned char* p){
+
+  int v = (int)pg_get16(p);
+
+  return v >= 0x8000 ? v - 0x10000 : v;
+}
+
+// a = a / 10^8 (4 разряда), ретюрн остаток
+static uint32_t pg_div_chunk(uint32_t a[4]){
+
+  uint64_t rem = 0u;
+
+  for(int i = 3; i >= 0; i--){
+    uint64_t cur = rem << 32 | a[i];
+#ifdef __SIZEOF_INT128__
+    uint64_t q = (uint64_t)(((unsigned __int128)cur * PG_RECIP_CHUNK) >> PG_RECIP_CHUNK_SHIFT);
+#else
+    uint64_t q = cur / PG_CHUNK;
+#endif
+
+    a[i] = (uint32_t)q;
+    rem = cur - q * PG_CHUNK;
+  }
+
+  return (uint32_t)rem;
+}
+
+// мантисса из цифр NBASE digits[0..n) (от старшей, n <= PG_DIGITS_MAX)
+static void pg_load_digits(const unsigned char* digits, int n, uint32_t c[4]){
+
+  int i = 0;
+
+  // пары цифр - одно умножение на 10^8
+  for(; i + 1 < n; i += 2){
+    (void)uN_mul_small(c, 4, PG_CHUNK);
+    (void)uN_add_small(c, 4, pg_get16(digits + 2 * i) * PG_NBASE + pg_get16(digits + 2 * i + 2));
+  }
+  if(i < n){
+    (void)uN_mul_small(c, 4, PG_NBASE);
+    (void)uN_add_small(c, 4, pg_get16(digits + 2 * i));
+  }
+}
+
+int s21_to_pg_numeric(const s21_decimal* src, unsigned char* dst, size_t cap, size_t* len){
+
+  int result = 1;
+
+  if(src != NULL && dst != NULL && len != NULL && s21_get_scale(src) <= S21_SCALE_MAX){
+    uint32_t c[4] = {0};
+    unsigned groups[2 * 4];
+    int scale = s21_get_scale(src);
+    int pad = (4 - scale % 4) % 4;
+    int count = 0;
+    int first = 0;
+    int weight = 0;
+
+    // 96 бит * 10^3 < 2^106: без переполнения, не больше 8 цифр NBASE
+    u96_from_dec(src, c);
+    (void)uN_mul_pow10(c, 4, pad);
+    while(uN_len(c, 4) > 0){
+      uint32_t chunk = pg_div_chunk(c);
+      uint32_t hi = (uint32_t)(chunk * PG_RECIP_NBASE >> PG_RECIP_NBASE_SHIFT);
+
+      groups[count++] = chunk - hi * PG_NBASE;
+      groups[count++] = hi;
+    }
+
+    // нули по краям не передаются (как make_result в PostgreSQL)
+    while(count > 0 && groups[count - 1] == 0u) count--;
+    while(first < count && groups[first] == 0u) first++;
+    if(count > 0) weight = count - 1 - (scale + pad) / 4;
+
+    *len = PG_HEADER_SIZE + 2u * (size_t)(count - first);
+    if(*len <= cap){
+      pg_put16(dst, (unsigned)(count - first));
+      pg_put16(dst + 2, (unsigned)weight & 0xFFFFu);
+      pg_put16(dst + 4, count > 0 && s21_get_sign(src) ? S21_PG_NUMERIC_NEG : S21_PG_NUMERIC_POS);
+      pg_put16(dst + 6, (unsigned)scale);
+      for(int i = count - 1, j = 0; i >= first; i--, j++) pg_put16(dst + PG_HEADER_SIZE + 2 * j, groups[i]);
+      result = 0;
+    }
+  }
+
+  return result;
+}
+
+int s21_from_pg_numeric(const unsigned char* src, size_t len, s21_decimal* dst){
+
+  int result = 1;
+
+  if(src != NULL && dst != NULL && len >= PG_HEADER_SIZE){
+    int ndigits = pg_get_int16(src);
+    int weight = pg_get_int16(src + 2);
+    unsigned sign = pg_get16(src + 4);
+    int dscale = pg_get_int16(src + 6);
+    const unsigned char* digits = src + PG_HEADER_SIZE;
+
+    result = ndigits < 0 || len != PG_HEADER_SIZE + 2u * (size_t)ndigits ||
+             (sign != S21_PG_NUMERIC_POS && sign != S21_PG_NUMERIC_NEG) || dscale < 0 || dscale > PG_DSCALE_MASK;
+    for(int i = 0; !result && i < ndigits; i++) result = pg_get16(digits + 2 * i) >= PG_NBASE;
+
+    if(!result){
+      uint32_t c[8] = {0};
+      uint32_t tmp[4];
+      int lead = 0;
+      int take;
+      int sticky = 0;
+      int q;
+      int max_scale = dscale < S21_SCALE_MAX ? dscale : S21_SCALE_MAX;
+
+      while(lead < ndigits && pg_get16(digits + 2 * lead) == 0u) lead++;
+      take = ndigits - lead < PG_DIGITS_MAX ? ndigits - lead : PG_DIGITS_MAX;
+      pg_load_digits(digits + 2 * lead, take, c);
+      q = 4 * (weight - (lead + take - 1));
+
+      // отброшенные цифры - одна ненулевая цифра ниже последней, чтобы
+      // s21_coef_to_decimal округлил к четному один раз
+      for(int i = lead + take; i < ndigits; i++) sticky |= pg_get16(digits + 2 * i) != 0u;
+      if(sticky){
+        (void)uN_mul_small(c, 4, 10u);
+        (void)uN_add_small(c, 4, 1u);
+        q--;
+      }
+
+      if(uN_len(c, 4) == 0){
+        q = -max_scale;
+      } else {
+        // нули за dscale убираются
+        while(-q > dscale){
+          memcpy(tmp, c, sizeof(tmp));
+          if(uN_div10(tmp, 4) != 0u) break;
+          memcpy(c, tmp, sizeof(tmp));
+          q++;
+        }
+        // нули до dscale дописываются, пока мантисса помещается в 96 бит
+        // (10^29 > 2^96: больше 28 нулей не помещается)
+        for(int k = max_scale + q < S21_SCALE_MAX ? max_scale + q : S21_SCALE_MAX; k > 0; k--){
+          memcpy(tmp, c, sizeof(tmp));
+          if(!uN_mul_pow10(tmp, 4, k) && uN_len(tmp, 4) <= 3){
+            memcpy(c, tmp, sizeof(tmp));
+            q -= k;
+            break;
+          }
+        }
+
+        if(-q > max_scale + PG_COEF_DIGITS){
+          // c < 10^37: все цифры ниже половины младшей - ноль
+          s21_context_raise(S21_FLAG_ROUNDED | S21_FLAG_INEXACT);
+          c[0] = c[1] = c[2] = c[3] = 0u;
+          q = -max_scale;
+        } else if(-q > max_scale){
+          // цифры за dscale (не от PostgreSQL): одно округление до dscale
+          // и 96 бит сразу
+          int scale = -q;
+
+          result = uN_reduce(c, 4, 3, &scale, max_scale);
+          q = -scale;
+        }
+      }
+
+      if(!result) result = s21_coef_to_decimal(c, q, sign == S21_PG_NUMERIC_NEG && uN_len(c, 4) > 0, dst);
+    }
+  }
+
+  return result;
+}
+
+// Пакетная запись полей COPY BINARY, ошибочные элементы записываются как 0
+int s21_to_pg_numeric_batch(const s21_decimal* src, size_t n, unsigned char* dst, size_t cap, size_t* written){
+
+  int result = (src == NULL || dst == NULL);
+  int full = result;
+  size_t pos = 0;
+
+  for(size_t i = 0; !full && i < n; i++){
+    size_t len = 0;
+    s21_decimal value = src[i];
+
+    if(s21_get_scale(&value) > S21_SCALE_MAX){
+      s21_decimal zero = {{0, 0, 0, 0}};
+      value = zero;
+      result = 1;
+    }
+
+    // места не хватает: записаны только целые поля до i
+    full = cap - pos < 4u || s21_to_pg_numeric(&value, dst + pos + 4, cap - pos - 4, &len) != 0;
+    if(!full){
+      pg_put16(dst + pos, (unsigned)(len >> 16));
+      pg_put16(dst + pos + 2, (unsigned)len & 0xFFFFu);
+      pos += 4 + len;
+    }
+  }
+
+  if(written != NULL) *written = pos;
+
+  return result || full;
+}
+
+// Пакетное чтение полей COPY BINARY, NULL и ошибочные элементы получают 0
+int s21_from_pg_numeric_batch(const unsigned char* src, size_t len, s21_decimal* dst, size_t n, size_t* consumed){
+
+  int result = (src == NULL || dst == NULL);
+  int truncated = result;
+  size_t pos = 0;
+
+  for(size_t i = 0; dst != NULL && i < n; i++){
+    s21_decimal zero = {{0, 0, 0, 0}};
+    int32_t field = PG_FIELD_NULL;
+
+    dst[i] = zero;
+    // буфер кончился: остальные элементы - 0
+    truncated = truncated || len - pos < 4u;
+    if(!truncated){
+      field = (int32_t)((uint32_t)pg_get16(src + pos) << 16 | pg_get16(src + pos + 2));
+      truncated = field < PG_FIELD_NULL || (field > 0 && len - pos - 4u < (size_t)field);
+    }
+
+    if(!truncated){
+      pos += 4;
+      if(field != PG_FIELD_NULL){
+        if(s21_from_pg_numeric(src + pos, (size_t)field, &dst[i]) != 0){
+          dst[i] = zero;
+          result = 1;
+        }
+        pos += (size_t)field;
+      }
+    }
+  }
+
+  if(consumed != NULL) *consumed = pos;
+
+  return result || truncated;
+}
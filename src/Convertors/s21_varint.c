@@ -0,0 +1,163 @@
+#include <string.h>
+
+#include "../s21_decimal.h"
+
+/*
+Компактная запись децималь переменной длины для журналов и сообщений:
+  байт заголовка: биты 0-4 - масштаб, 5-6 - ноль (резерв), 7 - знак,
+  модуль 96 бит - LEB128: по 7 бит от младших, бит 7 байта - есть еще.
+Суммы вида 19.99 занимают 3 байта, до 2^35 - не больше 6, наибольшее
+значение - S21_VARINT_MAX_SIZE (15) байт вместо 16. Знак нуля сохраняется.
+*/
+
+#define VARINT_SCALE_MASK 0x1Fu
+#define VARINT_RESERVED_MASK 0x60u
+#define VARINT_SIGN 0x80u
+#define VARINT_MORE 0x80u
+#define VARINT_PAYLOAD 0x7Fu
+
+// ретюрн размер записи (не больше S21_VARINT_MAX_SIZE)
+static size_t varint_pack(const s21_decimal* src, unsigned char* out){
+
+  uint64_t lo = (uint64_t)(uint32_t)src->bits[1] << 32 | (uint32_t)src->bits[0];
+  uint32_t hi = (uint32_t)src->bits[2];
+  size_t n = 1;
+  int more = 1;
+
+  out[0] = (unsigned char)(s21_get_scale(src) | (s21_get_sign(src) ? VARINT_SIGN : 0u));
+  while(more){
+    unsigned byte = (unsigned)lo & VARINT_PAYLOAD;
+
+    lo = lo >> 7 | (uint64_t)hi << 57;
+    hi >>= 7;
+    more = lo != 0u || hi != 0u;
+    out[n++] = (unsigned char)(byte | (more ? VARINT_MORE : 0u));
+  }
+
+  return n;
+}
+
+int s21_encode_varint(const s21_decimal* src, unsigned char* dst, size_t cap, size_t* len){
+
+  int result = 1;
+
+  if(src != NULL && dst != NULL && len != NULL && s21_get_scale(src) <= S21_SCALE_MAX){
+    unsigned char buf[S21_VARINT_MAX_SIZE];
+
+    *len = varint_pack(src, buf);
+    if(*len <= cap){
+      memcpy(dst, buf, *len);
+      result = 0;
+    }
+  }
+
+  return result;
+}
+
+int s21_decode_varint(const unsigned char* src, size_t len, s21_decimal* dst, size_t* used){
+
+  int result = 1;
+
+  if(src != NULL && dst != NULL && len == 0u){
+    result = 2;
+  } else if(src != NULL && dst != NULL){
+    unsigned header = src[0];
+    uint32_t c[4] = {0};
+    size_t n = 1;
+    int more = 1;
+
+    result = (header & VARINT_RESERVED_MASK) != 0u || (header & VARINT_SCALE_MASK) > S21_SCALE_MAX;
+    // 14 байт по 7 бит - 98 бит: старший разряд c[3] ловит лишние
+    while(!result && more){
+      if(n == len){
+        result = 2;
+      } else if(n == S21_VARINT_MAX_SIZE){
+        result = 1;
+      } else {
+        uint32_t payload = src[n] & VARINT_PAYLOAD;
+        int pos = 7 * (int)(n - 1);
+        int limb = pos / 32;
+        int off = pos % 32;
+
+        c[limb] |= payload << off;
+        if(off > 25) c[limb + 1] |= payload >> (32 - off);
+        more = (src[n] & VARINT_MORE) != 0u;
+        n++;
+      }
+    }
+
+    if(!result && c[3] != 0u) result = 1;
+    if(!result){
+      dst->bits[0] = (int)c[0];
+      dst->bits[1] = (int)c[1];
+      dst->bits[2] = (int)c[2];
+      dst->bits[3] = 0;
+      s21_set_scale(dst, (int)(header & VARINT_SCALE_MASK));
+      s21_set_sign(dst, (header & VARINT_SIGN) != 0u);
+      if(used != NULL) *used = n;
+    }
+  }
+
+  return result;
+}
+
+// Пакетная запись подряд, ошибочные элементы записываются как 0
+int s21_encode_varint_batch(const s21_decimal* src, size_t n, unsigned char* dst, size_t cap, size_t* count,
+                            size_t* written){
+
+  int result = (src == NULL || dst == NULL);
+  int full = 0;
+  size_t pos = 0;
+  size_t i = 0;
+
+  while(src != NULL && dst != NULL && !full && i < n){
+    unsigned char buf[S21_VARINT_MAX_SIZE];
+    s21_decimal value = src[i];
+    size_t len;
+    int bad = s21_get_scale(&value) > S21_SCALE_MAX;
+
+    if(bad){
+      s21_decimal zero = {{0, 0, 0, 0}};
+      value = zero;
+    }
+
+    len = varint_pack(&value, buf);
+    // места нет: следующий вызов продолжит с элемента i
+    full = len > cap - pos;
+    if(!full){
+      memcpy(dst + pos, buf, len);
+      pos += len;
+      result |= bad;
+      i++;
+    }
+  }
+
+  if(count != NULL) *count = i;
+  if(written != NULL) *written = pos;
+
+  return full ? 2 : result;
+}
+
+// Пакетное чтение подряд до n значений или конца буфера
+int s21_decode_varint_batch(const unsigned char* src, size_t len, s21_decimal* dst, size_t n, size_t* count,
+                            size_t* consumed){
+
+  int result = (src == NULL || dst == NULL);
+  size_t pos = 0;
+  size_t i = 0;
+
+  while(!result && i < n){
+    size_t used = 0;
+
+    result = s21_decode_varint(src + pos, len - pos, &dst[i], &used);
+    if(!result){
+      pos += used;
+      i++;
+    }
+  }
+
+  if(count != NULL) *count = i;
+  if(consumed != NULL) *consumed = pos;
+
+  return result;
+}
@@ -0,0 +1,32 @@
+#include "../s21_decimal.h"
+
+// Контекст вычислений
+/*
+Хранит режим округления, максимальный масштаб результата и накопленные
+("липкие") флаги состояния, как контекст в IEEE 754 / libmpdec.
+У каждого потока свой контекст, поэтому синхронизация не нужна.
+Арифметика отмечает флаги только на медленных путях (округление,
+переполнение, деление на ноль), быстрый путь контекст не трогает.
+*/
+
+static _Thread_local s21_context s21_thread_context = {S21_ROUND_HALF_EVEN, S21_SCALE_MAX, 0u};
+
+// получить контекст текущего потока
+s21_context* s21_context_get(void){
+  return &s21_thread_context;
+}
+
+// значения по умолчанию: банковское округление, масштаб до 28, флаги сброшены
+void s21_context_init(s21_context* ctx){
+
+  if(ctx != NULL){
+    ctx->round = S21_ROUND_HALF_EVEN;
+    ctx->max_scale = S21_SCALE_MAX;
+    ctx->flags = 0u;
+  }
+}
+
+// добавить флаги в контекст потока
+void s21_context_raise(unsigned flags){
+  s21_thread_context.flags |= flags;
+}
@@ -0,0 +1,398 @@
+#include <string.h>
+
+#include "../s21_decimal.h"
+
+// Формулы над столбцами decimal
+/*
+s21_formula_compile разбирает текст один раз рекурсивным спуском и
+записывает регистровый байткод: каждый узел - инструкция dst = a op b,
+операнды - регистр, переменная (столбец) или константа. Регистры
+выделяются стеком, поэтому их число равно глубине выражения, а
+результат всегда в регистре 0. Подвыражения из одних констант
+вычисляются при компиляции, в таблице остаются только константы,
+на которые ссылается байткод.
+s21_formula_eval идет по строкам блоками S21_FORMULA_BLOCK: для блока
+каждая инструкция выполняется пакетной операцией s21_*_batch над
+столбцами блока (регистры - столбцы на стеке, константы размножаются
+в столбец один раз на вызов), затем регистр 0 копируется в out.
+*/
+
+#define S21_FORMULA_MAX_DEPTH 64  // вложенность скобок и унарных минусов
+
+typedef struct {
+  const char* text;
+  const char* end;
+  const char* p;
+  s21_formula* f;
+  int top;    // первый свободный регистр
+  int depth;
+  int err;    // 0, 1 - синтаксис, 2 - лимиты
+  const char* err_pos;
+} formula_parser;
+
+typedef unsigned (*formula_batch_op)(const s21_decimal*, const s21_decimal*, s21_decimal*, size_t, s21_context*);
+
+static unsigned char formula_parse_expr(formula_parser* ps);
+
+// запомнить первую ошибку
+static unsigned char formula_fail(formula_parser* ps, int code){
+
+  if(ps->err == 0){
+    ps->err = code;
+    ps->err_pos = ps->p;
+  }
+
+  return 0u;
+}
+
+static void formula_skip_spaces(formula_parser* ps){
+  while(ps->p < ps->end && (*ps->p == ' ' || *ps->p == '\t' || *ps->p == '\n' || *ps->p == '\r')) ps->p++;
+}
+
+static int formula_is_alpha(char c){
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+static int formula_is_digit(char c){
+  return c >= '0' && c <= '9';
+}
+
+static int formula_is_const(unsigned char arg){
+  return (arg & S21_FORMULA_ARG_KIND) == S21_FORMULA_ARG_CONST;
+}
+
+static int formula_is_reg(unsigned char arg){
+  return (arg & S21_FORMULA_ARG_KIND) == S21_FORMULA_ARG_REG;
+}
+
+// константа в таблицу (одинаковые значения хранятся один раз)
+static unsigned char formula_add_const(formula_parser* ps, const s21_decimal* d){
+
+  s21_formula* f = ps->f;
+  int index = -1;
+
+  for(int i = 0; i < f->n_consts && index < 0; i++){
+    if(memcmp(&f->consts[i], d, sizeof(*d)) == 0) index = i;
+  }
+
+  if(index < 0 && f->n_consts < S21_FORMULA_MAX_CONSTS){
+    index = f->n_consts++;
+    f->consts[index] = *d;
+  }
+
+  return index < 0 ? formula_fail(ps, 2) : (unsigned char)(S21_FORMULA_ARG_CONST | (unsigned)index);
+}
+
+static unsigned char formula_add_var(formula_parser* ps, const char* name, size_t len){
+
+  s21_formula* f = ps->f;
+  int index = -1;
+
+  if(len >= S21_FORMULA_NAME_MAX) return formula_fail(ps, 2);
+
+  for(int i = 0; i < f->n_vars && index < 0; i++){
+    if(strncmp(f->vars[i], name, len) == 0 && f->vars[i][len] == '\0') index = i;
+  }
+
+  if(index < 0 && f->n_vars < S21_FORMULA_MAX_VARS){
+    index = f->n_vars++;
+    memcpy(f->vars[index], name, len);
+    f->vars[index][len] = '\0';
+  }
+
+  return index < 0 ? formula_fail(ps, 2) : (unsigned char)(S21_FORMULA_ARG_VAR | (unsigned)index);
+}
+
+// вычислить операцию над константами при компиляции
+static unsigned char formula_fold(formula_parser* ps, s21_formula_op op, unsigned char a, unsigned char b){
+
+  const s21_decimal* x = &ps->f->consts[a & S21_FORMULA_ARG_INDEX];
+  const s21_decimal* y = &ps->f->consts[b & S21_FORMULA_ARG_INDEX];
+  s21_decimal r;
+  int code = 0;
+
+  if(op == S21_FORMULA_ADD) code = s21_add_p(x, y, &r);
+  if(op == S21_FORMULA_SUB) code = s21_sub_p(x, y, &r);
+  if(op == S21_FORMULA_MUL) code = s21_mul_p(x, y, &r);
+  if(op == S21_FORMULA_DIV) code = s21_div_p(x, y, &r);
+  if(op == S21_FORMULA_NEG) code = s21_negate(*x, &r);
+
+  return code != 0 ? formula_fail(ps, 2) : formula_add_const(ps, &r);
+}
+
+// инструкция dst = a op b (для NEG b не используется), возвращает dst
+static unsigned char formula_emit(formula_parser* ps, s21_formula_op op, unsigned char a, unsigned char b){
+
+  s21_formula* f = ps->f;
+  unsigned char result = 0u;
+
+  if(ps->err != 0){
+    result = 0u;
+  } else if(formula_is_const(a) && (op == S21_FORMULA_NEG || formula_is_const(b))){
+    result = formula_fold(ps, op, a, b);
+  } else if(f->n_code >= S21_FORMULA_MAX_CODE){
+    result = formula_fail(ps, 2);
+  } else {
+    // регистры операндов лежат на вершине стека и освобождаются
+    if(op != S21_FORMULA_NEG && formula_is_reg(b)) ps->top--;
+    if(formula_is_reg(a)) ps->top--;
+
+    if(ps->top >= S21_FORMULA_MAX_REGS){
+      result = formula_fail(ps, 2);
+    } else {
+      int dst = ps->top++;
+      if(ps->top > f->n_regs) f->n_regs = ps->top;
+
+      s21_formula_insn* insn = &f->code[f->n_code++];
+      insn->op = (unsigned char)op;
+      insn->dst = (unsigned char)dst;
+      insn->a = a;
+      insn->b = op == S21_FORMULA_NEG ? 0u : b;
+      result = (unsigned char)(S21_FORMULA_ARG_REG | (unsigned)dst);
+    }
+  }
+
+  return result;
+}
+
+// число, переменная или выражение в скобках
+static unsigned char formula_parse_primary(formula_parser* ps){
+
+  unsigned char result = 0u;
+
+  formula_skip_spaces(ps);
+
+  if(ps->p < ps->end && (formula_is_digit(*ps->p) || *ps->p == '.')){
+    s21_decimal d;
+    const char* end = ps->p;
+    int code = s21_from_chars(ps->p, ps->end, &d, &end);
+
+    if(code != 0){
+      result = formula_fail(ps, code);
+    } else if(end < ps->end && (formula_is_alpha(*end) || formula_is_digit(*end) || *end == '.')){
+      ps->p = end;
+      result = formula_fail(ps, 1);
+    } else {
+      ps->p = end;
+      result = formula_add_const(ps, &d);
+    }
+  } else if(ps->p < ps->end && formula_is_alpha(*ps->p)){
+    const char* name = ps->p;
+    while(ps->p < ps->end && (formula_is_alpha(*ps->p) || formula_is_digit(*ps->p))) ps->p++;
+    result = formula_add_var(ps, name, (size_t)(ps->p - name));
+  } else if(ps->p < ps->end && *ps->p == '('){
+    ps->p++;
+    result = formula_parse_expr(ps);
+    formula_skip_spaces(ps);
+
+    if(ps->p < ps->end && *ps->p == ')'){
+      ps->p++;
+    } else {
+      result = formula_fail(ps, 1);
+    }
+  } else {
+    result = formula_fail(ps, 1);
+  }
+
+  return result;
+}
+
+// [+-]* первичное выражение
+static unsigned char formula_parse_unary(formula_parser* ps){
+
+  unsigned char result = 0u;
+
+  formula_skip_spaces(ps);
+
+  if(++ps->depth > S21_FORMULA_MAX_DEPTH){
+    result = formula_fail(ps, 2);
+  } else if(ps->p < ps->end && (*ps->p == '-' || *ps->p == '+')){
+    int negate = *ps->p == '-';
+    ps->p++;
+    result = formula_parse_unary(ps);
+    if(negate) result = formula_emit(ps, S21_FORMULA_NEG, result, 0u);
+  } else {
+    result = formula_parse_primary(ps);
+  }
+
+  ps->depth--;
+
+  return result;
+}
+
+// произведения и частные
+static unsigned char formula_parse_term(formula_parser* ps){
+
+  unsigned char result = formula_parse_unary(ps);
+
+  formula_skip_spaces(ps);
+
+  while(ps->err == 0 && ps->p < ps->end && (*ps->p == '*' || *ps->p == '/')){
+    s21_formula_op op = *ps->p == '*' ? S21_FORMULA_MUL : S21_FORMULA_DIV;
+    ps->p++;
+    unsigned char rhs = formula_parse_unary(ps);
+    result = formula_emit(ps, op, result, rhs);
+    formula_skip_spaces(ps);
+  }
+
+  return result;
+}
+
+// суммы и разности
+static unsigned char formula_parse_expr(formula_parser* ps){
+
+  unsigned char result = formula_parse_term(ps);
+
+  formula_skip_spaces(ps);
+
+  while(ps->err == 0 && ps->p < ps->end && (*ps->p == '+' || *ps->p == '-')){
+    s21_formula_op op = *ps->p == '+' ? S21_FORMULA_ADD : S21_FORMULA_SUB;
+    ps->p++;
+    unsigned char rhs = formula_parse_term(ps);
+    result = formula_emit(ps, op, result, rhs);
+    formula_skip_spaces(ps);
+  }
+
+  return result;
+}
+
+// убрать константы, оставшиеся только от свертки
+static void formula_compact_consts(s21_formula* f){
+
+  int map[S21_FORMULA_MAX_CONSTS];
+  int used[S21_FORMULA_MAX_CONSTS] = {0};
+  int n = 0;
+
+  for(int k = 0; k < f->n_code; k++){
+    if(formula_is_const(f->code[k].a)) used[f->code[k].a & S21_FORMULA_ARG_INDEX] = 1;
+    if(f->code[k].op != S21_FORMULA_NEG && f->code[k].op != S21_FORMULA_MOV && formula_is_const(f->code[k].b))
+      used[f->code[k].b & S21_FORMULA_ARG_INDEX] = 1;
+  }
+
+  for(int c = 0; c < f->n_consts; c++){
+    map[c] = n;
+    if(used[c]) f->consts[n++] = f->consts[c];
+  }
+
+  for(int k = 0; k < f->n_code; k++){
+    s21_formula_insn* insn = &f->code[k];
+    if(formula_is_const(insn->a)) insn->a = (unsigned char)(S21_FORMULA_ARG_CONST | (unsigned)map[insn->a & S21_FORMULA_ARG_INDEX]);
+    if(insn->op != S21_FORMULA_NEG && insn->op != S21_FORMULA_MOV && formula_is_const(insn->b))
+      insn->b = (unsigned char)(S21_FORMULA_ARG_CONST | (unsigned)map[insn->b & S21_FORMULA_ARG_INDEX]);
+  }
+
+  for(int c = n; c < f->n_consts; c++) memset(&f->consts[c], 0, sizeof(f->consts[c]));
+  f->n_consts = n;
+}
+
+int s21_formula_compile(const char* text, s21_formula* formula, size_t* error_pos){
+
+  int result = 1;
+
+  if(text != NULL && formula != NULL){
+    formula_parser ps = {text, text + strlen(text), text, formula, 0, 0, 0, text};
+
+    memset(formula, 0, sizeof(*formula));
+
+    unsigned char arg = formula_parse_expr(&ps);
+    formula_skip_spaces(&ps);
+
+    if(ps.err == 0 && ps.p != ps.end) formula_fail(&ps, 1);
+
+    // результат - переменная или константа: скопировать в регистр 0
+    if(ps.err == 0 && !formula_is_reg(arg)){
+      if(formula->n_code >= S21_FORMULA_MAX_CODE){
+        formula_fail(&ps, 2);
+      } else {
+        s21_formula_insn* insn = &formula->code[formula->n_code++];
+        insn->op = (unsigned char)S21_FORMULA_MOV;
+        insn->dst = 0u;
+        insn->a = arg;
+        insn->b = 0u;
+        formula->n_regs = 1;
+      }
+    }
+
+    if(ps.err == 0) formula_compact_consts(formula);
+
+    result = ps.err;
+    if(error_pos != NULL) *error_pos = result == 0 ? 0u : (size_t)(ps.err_pos - text);
+    if(result != 0) memset(formula, 0, sizeof(*formula));
+  }
+
+  return result;
+}
+
+int s21_formula_var(const s21_formula* formula, const char* name){
+
+  int index = -1;
+
+  if(formula != NULL && name != NULL){
+    for(int i = 0; i < formula->n_vars && index < 0; i++){
+      if(strcmp(formula->vars[i], name) == 0) index = i;
+    }
+  }
+
+  return index;
+}
+
+// столбец операнда для блока, начинающегося со строки row
+static const s21_decimal* formula_operand(unsigned char arg, const s21_decimal* const* columns, size_t row,
+                                          s21_decimal regs[][S21_FORMULA_BLOCK],
+                                          s21_decimal consts[][S21_FORMULA_BLOCK]){
+
+  unsigned index = arg & S21_FORMULA_ARG_INDEX;
+  const s21_decimal* column = regs[index];
+
+  if((arg & S21_FORMULA_ARG_KIND) == S21_FORMULA_ARG_VAR) column = columns[index] + row;
+  if((arg & S21_FORMULA_ARG_KIND) == S21_FORMULA_ARG_CONST) column = consts[index];
+
+  return column;
+}
+
+unsigned s21_formula_eval(const s21_formula* formula, const s21_decimal* const* columns, s21_decimal* out,
+                          size_t n, s21_context* ctx){
+
+  static const formula_batch_op kernels[] = {s21_add_batch, s21_sub_batch, s21_mul_batch, s21_div_batch};
+
+  unsigned raised = 0u;
+  int valid = formula != NULL && out != NULL && formula->n_code > 0 && (formula->n_vars == 0 || columns != NULL);
+
+  for(int v = 0; valid && v < formula->n_vars; v++) valid = columns[v] != NULL;
+
+  if(valid){
+    s21_decimal regs[S21_FORMULA_MAX_REGS][S21_FORMULA_BLOCK];
+    s21_decimal consts[S21_FORMULA_MAX_CONSTS][S21_FORMULA_BLOCK];
+
+    // константы размножаются один раз на весь вызов
+    for(int c = 0; c < formula->n_consts; c++){
+      for(int i = 0; i < S21_FORMULA_BLOCK; i++) consts[c][i] = formula->consts[c];
+    }
+
+    for(size_t row = 0; row < n; row += S21_FORMULA_BLOCK){
+      size_t len = n - row < S21_FORMULA_BLOCK ? n - row : S21_FORMULA_BLOCK;
+
+      for(int k = 0; k < formula->n_code; k++){
+        const s21_formula_insn* insn = &formula->code[k];
+        const s21_decimal* a = formula_operand(insn->a, columns, row, regs, consts);
+        s21_decimal* dst = regs[insn->dst];
+
+        if(insn->op == S21_FORMULA_NEG){
+          for(size_t i = 0; i < len; i++){
+            dst[i] = a[i];
+            dst[i].bits[3] = (int)((uint32_t)dst[i].bits[3] ^ S21_SIGN_MASK);
+          }
+        } else if(insn->op == S21_FORMULA_MOV){
+          if(dst != a) memcpy(dst, a, sizeof(*dst) * len);
+        } else {
+          const s21_decimal* b = formula_operand(insn->b, columns, row, regs, consts);
+          raised |= kernels[insn->op](a, b, dst, len, ctx);
+        }
+      }
+
+      memcpy(out + row, regs[0], sizeof(*out) * len);
+    }
+  }
+
+  return raised;
+}
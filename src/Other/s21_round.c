@@ -1,27 +1,15 @@
 #include "../s21_decimal.h"
 
 //Округляет число до ближайшего целого с применением банковского округления
-//0 при успехе, 1 при ошибке (некорректный указатель)
-// 123.456 - 123.46 - 123.5 - 124??
+//0 при успехе, 1 при ошибке (некорректный указатель или масштаб > 28)
 
-int s21_round(s21_decimal value, s21_decimal* result) {
-
-  if(result != NULL){
-
-    *result = value;
-
-    int scale = s21_get_scale(result);
+/*
+Одно деление мантиссы на 10^scale (s21_round_to_scale), решение об
+округлении принимается один раз по всему остатку. Поразрядное округление
+давало двойное округление: 3.46 → 3.5 → 4 вместо 3.
+Примеры: 2.5 → 2, 3.5 → 4, 3.46 → 3, 2.45 → 2, -2.7 → -3
+*/
 
-    if(scale > 0){
-        
-        //идем поразрядно по дробной части и округляем с конца
-        for(int i = 0; i < scale; i++){
-            s21_scale_down_one_banker(result);
-        }
-
-        s21_set_scale(result, 0);
-    }
-  }
-
-  return (int)(result == NULL);
-}
\ No newline at end of file
+int s21_round(s21_decimal value, s21_decimal* result) {
+  return s21_round_to_scale(value, 0, S21_ROUND_HALF_EVEN, result);
+}
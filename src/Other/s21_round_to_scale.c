@@ -0,0 +1,47 @@
+#include "../s21_decimal.h"
+
+// Округление до заданного количества знаков после запятой
+/*
+0 при успехе, 1 при ошибке (некорректный указатель, масштаб вне 0..28
+или неизвестный режим)
+Мантисса делится на 10^(текущий масштаб - scale) один раз, решение об
+округлении принимает s21_round_increment по частному и остатку.
+Если знаков и так не больше scale - число возвращается без изменений.
+Пример: 19.995 до 2 знаков -> 20.00 (HALF_EVEN), 19.99 (DOWN)
+*/
+
+int s21_round_to_scale(s21_decimal value, int scale, s21_rounding_mode mode, s21_decimal* result){
+
+  int response = 1;
+  int current = s21_get_scale(&value);
+
+  if(result != NULL && scale >= 0 && scale <= S21_SCALE_MAX && current <= S21_SCALE_MAX &&
+     mode >= S21_ROUND_HALF_EVEN && mode <= S21_ROUND_UP){
+
+    if(current <= scale){
+      *result = value;
+    } else {
+      int negative = s21_get_sign(&value);
+      int k = current - scale;
+
+      uint32_t a[3], rem[3];
+      u96_from_dec(&value, a);
+      u96_divmod_pow10(a, k, rem);
+
+      if(s21_round_increment(a, rem, k, negative, mode)){
+        // частное <= мантисса / 10, переполнения нет
+        uint32_t one[3] = {1u, 0u, 0u};
+        (void)u96_add(a, one);
+      }
+
+      s21_reset_value(result);
+      u96_to_dec(a, result);
+      s21_set_scale(result, scale);
+      s21_set_sign(result, negative);
+    }
+
+    response = 0;
+  }
+
+  return response;
+}
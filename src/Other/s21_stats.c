@@ -0,0 +1,42 @@
+#include <string.h>
+
+#include "../s21_decimal.h"
+
+// Счетчики медленных путей
+/*
+Включаются при сборке с -DS21_STATS (make STATS=1). У каждого потока
+свои счетчики, поэтому инкремент - обычное сложение без атомарных
+операций. Без флага макросы S21_STAT_* пустые, функции ниже остаются,
+чтобы код, читающий счетчики, собирался с любой сборкой библиотеки.
+*/
+
+#ifdef S21_STATS
+_Thread_local s21_stats s21_thread_stats;
+#endif
+
+int s21_stats_enabled(void){
+#ifdef S21_STATS
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+// копия счетчиков потока (нули без S21_STATS)
+void s21_stats_snapshot(s21_stats* out){
+
+  if(out != NULL){
+#ifdef S21_STATS
+    *out = s21_thread_stats;
+#else
+    memset(out, 0, sizeof(*out));
+#endif
+  }
+}
+
+// обнулить счетчики потока
+void s21_stats_reset(void){
+#ifdef S21_STATS
+  memset(&s21_thread_stats, 0, sizeof(s21_thread_stats));
+#endif
+}
@@ -0,0 +1,442 @@
+/**
+ * @file bench.c
+ * @brief Запуск микробенчмарков всех публичных функций s21_decimal
+ * @details Для каждой операции и каждого класса входных данных измеряется
+ *          пропускная способность (операций в секунду) и распределение
+ *          задержки одного вызова (p50/p90/p99/p999/max). Результат
+ *          выводится построчно в JSON (JSON Lines) или CSV.
+ *
+ *          Использование:
+ *            bench_runner [--seed N] [--samples N] [--batch N]
+ *                         [--format json|csv] [--filter подстрока]
+ *                         [--replay файл]
+ *            bench_runner --generate вид [--count N] [--seed N] --out файл
+ *            bench_runner --help
+ *
+ *          --generate записывает реалистичный набор (bench_workload.h):
+ *          prices, quantities, fx_rates, notionals или ledger.
+ *          --replay добавляет класс "replay" со значениями из файла.
+ *          Если библиотека собрана с make STATS=1, в JSON добавляется
+ *          поле "stats" - счетчики медленных путей на один вызов.
+ *
+ *          Кроме задержки серий (clock_gettime) каждый вызов отдельно
+ *          измеряется счетчиком тактов (rdtsc/rdtscp на x86, см.
+ *          bench_cycles.h): перцентили cyc_* и логарифмическая гистограмма
+ *          "hist" ([нижняя граница, число вызовов]) за вычетом накладных
+ *          расходов замера. Если доступен perf_event_open, поле "perf"
+ *          содержит instructions, branch_misses и cache_misses на вызов.
+ *          --calls задает число одиночных замеров, --no-hist отключает
+ *          вывод гистограммы.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.h"
+#include "bench_cycles.h"
+#include "bench_workload.h"
+
+#define BENCH_DEFAULT_SAMPLES 2000  // Число замеров задержки
+#define BENCH_DEFAULT_BATCH 32      // Вызовов в одном замере
+#define BENCH_WARMUP_ROUNDS 4       // Проходов прогрева по набору
+#define BENCH_DEFAULT_COUNT 1000000 // Размер генерируемого набора
+#define BENCH_DEFAULT_CALLS 20000   // Одиночных замеров тактов
+#define BENCH_OVERHEAD_ROUNDS 10000 // Замеров пустой операции
+
+typedef struct {
+  uint64_t seed;
+  size_t samples;
+  size_t batch;
+  int csv;
+  const char *filter;
+  const char *replay;    // файл набора для класса replay
+  int generate;          // вид генерируемого набора или -1
+  size_t count;          // размер генерируемого набора
+  const char *out;       // файл генерируемого набора
+  size_t calls;          // одиночных замеров тактов
+  int hist;              // выводить гистограмму
+  int help;              // вывести справку и выйти
+} bench_options;
+
+// Буферы и состояние измерений, общие для всех операций
+typedef struct {
+  double *samples;    // задержка серии, нс на вызов
+  uint64_t *cycles;   // задержка одиночного вызова, такты
+  uint64_t overhead;  // такты пустого замера
+  bench_perf perf;
+} bench_state;
+
+typedef struct {
+  double mean_ns;
+  double mops;
+  double p50, p90, p99, p999, max;
+  uint64_t cyc_p50, cyc_p90, cyc_p99, cyc_p999, cyc_max;
+  bench_hist hist;  // такты одиночного вызова
+  double instructions, branch_misses, cache_misses;  // на вызов
+  s21_stats stats;  // счетчики медленных путей за один проход по набору
+} bench_result;
+
+// Результат операций копится здесь, чтобы вызовы не были выброшены
+static volatile int bench_sink;
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static int cmp_double(const void *a, const void *b) {
+  double x = *(const double *)a;
+  double y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+static int cmp_u64(const void *a, const void *b) {
+  uint64_t x = *(const uint64_t *)a;
+  uint64_t y = *(const uint64_t *)b;
+  return (x > y) - (x < y);
+}
+
+static double percentile(const double *sorted, size_t n, double p) {
+  size_t idx = (size_t)(p * (double)(n - 1) + 0.5);
+  return sorted[idx];
+}
+
+static uint64_t percentile_u64(const uint64_t *sorted, size_t n, double p) {
+  size_t idx = (size_t)(p * (double)(n - 1) + 0.5);
+  return sorted[idx];
+}
+
+static int op_noop(bench_set *set, size_t start, size_t count) {
+  (void)set;
+  return (int)(start + count);
+}
+
+// Накладные расходы одиночного замера: минимум для пустой операции
+static uint64_t measure_overhead(bench_set *set) {
+  uint64_t best = UINT64_MAX;
+  int acc = 0;
+
+  for (int i = 0; i < BENCH_OVERHEAD_ROUNDS; i++) {
+    uint64_t t0 = bench_cycles_begin();
+    acc += op_noop(set, (size_t)i % BENCH_SET_SIZE, 1);
+    uint64_t t1 = bench_cycles_end();
+    if (t1 - t0 < best) best = t1 - t0;
+  }
+  bench_sink += acc;
+  return best;
+}
+
+// Такты одиночных вызовов: перцентили и гистограмма
+static int measure_cycles(const bench_op *op, bench_set *set,
+                          const bench_options *opt, bench_state *st,
+                          bench_result *res) {
+  int acc = 0;
+
+  bench_hist_reset(&res->hist);
+  for (size_t i = 0; i < opt->calls; i++) {
+    size_t idx = i % BENCH_SET_SIZE;
+    uint64_t t0 = bench_cycles_begin();
+    acc += op->fn(set, idx, 1);
+    uint64_t t1 = bench_cycles_end();
+    uint64_t d = t1 - t0;
+    d = d > st->overhead ? d - st->overhead : 0;
+    st->cycles[i] = d;
+    bench_hist_add(&res->hist, d);
+  }
+  qsort(st->cycles, opt->calls, sizeof(uint64_t), cmp_u64);
+
+  res->cyc_p50 = percentile_u64(st->cycles, opt->calls, 0.50);
+  res->cyc_p90 = percentile_u64(st->cycles, opt->calls, 0.90);
+  res->cyc_p99 = percentile_u64(st->cycles, opt->calls, 0.99);
+  res->cyc_p999 = percentile_u64(st->cycles, opt->calls, 0.999);
+  res->cyc_max = st->cycles[opt->calls - 1];
+  return acc;
+}
+
+// Замер одной операции на одном классе входных данных
+static void bench_measure(const bench_op *op, bench_set *set,
+                          const bench_options *opt, bench_state *st,
+                          bench_result *res) {
+  double *samples = st->samples;
+  size_t batch = opt->batch;
+  int acc = 0;
+
+  for (int w = 0; w < BENCH_WARMUP_ROUNDS; w++)
+    acc += op->fn(set, 0, BENCH_SET_SIZE);
+
+  // Счетчики (make STATS=1) снимаются с одного прохода, вне замеров
+  s21_stats_reset();
+  acc += op->fn(set, 0, BENCH_SET_SIZE);
+  s21_stats_snapshot(&res->stats);
+
+  // Пропускная способность: проходы по всему набору
+  // (аппаратные счетчики, если доступны, считают только этот цикл)
+  uint64_t total_ns = 0;
+  size_t total_ops = 0;
+  bench_perf_start(&st->perf);
+  while (total_ns < 20000000ull) {
+    uint64_t t0 = now_ns();
+    acc += op->fn(set, 0, BENCH_SET_SIZE);
+    total_ns += now_ns() - t0;
+    total_ops += BENCH_SET_SIZE;
+  }
+  bench_perf_stop(&st->perf);
+  res->instructions = (double)st->perf.instructions / (double)total_ops;
+  res->branch_misses = (double)st->perf.branch_misses / (double)total_ops;
+  res->cache_misses = (double)st->perf.cache_misses / (double)total_ops;
+
+  // Задержка: короткие серии по batch вызовов
+  size_t start = 0;
+  for (size_t i = 0; i < opt->samples; i++) {
+    if (start + batch > BENCH_SET_SIZE) start = 0;
+    uint64_t t0 = now_ns();
+    acc += op->fn(set, start, batch);
+    uint64_t t1 = now_ns();
+    samples[i] = (double)(t1 - t0) / (double)batch;
+    start += batch;
+  }
+  qsort(samples, opt->samples, sizeof(double), cmp_double);
+
+  acc += measure_cycles(op, set, opt, st, res);
+
+  bench_sink += acc;
+  res->mean_ns = (double)total_ns / (double)total_ops;
+  res->mops = (double)total_ops * 1e3 / (double)total_ns;
+  res->p50 = percentile(samples, opt->samples, 0.50);
+  res->p90 = percentile(samples, opt->samples, 0.90);
+  res->p99 = percentile(samples, opt->samples, 0.99);
+  res->p999 = percentile(samples, opt->samples, 0.999);
+  res->max = samples[opt->samples - 1];
+}
+
+// Счетчики медленных путей в среднем на один вызов
+static void print_stats(const s21_stats *st) {
+  const double n = (double)BENCH_SET_SIZE;
+  printf(
+      ",\"stats\":{\"add_calls\":%.4f,\"add_align_round\":%.4f,"
+      "\"add_carry_loop\":%.4f,\"mul_calls\":%.4f,"
+      "\"mul_round_div10\":%.4f,\"div_calls\":%.4f,"
+      "\"div_overflow_round\":%.4f,\"div_digits\":%.4f}",
+      (double)st->add_calls / n, (double)st->add_align_round / n,
+      (double)st->add_carry_loop / n, (double)st->mul_calls / n,
+      (double)st->mul_round_div10 / n, (double)st->div_calls / n,
+      (double)st->div_overflow_round / n, (double)st->div_digits / n);
+}
+
+// Непустые интервалы гистограммы: [нижняя граница, число вызовов]
+static void print_hist(const bench_hist *h) {
+  int first = 1;
+
+  printf(",\"hist\":[");
+  for (int b = 0; b < BENCH_HIST_BUCKETS; b++) {
+    if (h->counts[b]) {
+      printf("%s[%" PRIu64 ",%" PRIu64 "]", first ? "" : ",",
+             bench_hist_lower(b), h->counts[b]);
+      first = 0;
+    }
+  }
+  printf("]");
+}
+
+static void print_result(const bench_options *opt, const bench_state *st,
+                         const char *op, const char *cls,
+                         const bench_result *r) {
+  if (opt->csv) {
+    printf("%s,%s,%.3f,%.3f,%.2f,%.2f,%.2f,%.2f,%.2f", op, cls, r->mean_ns,
+           r->mops, r->p50, r->p90, r->p99, r->p999, r->max);
+    printf(",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64,
+           r->cyc_p50, r->cyc_p90, r->cyc_p99, r->cyc_p999, r->cyc_max);
+    if (st->perf.available)
+      printf(",%.2f,%.4f,%.4f\n", r->instructions, r->branch_misses,
+             r->cache_misses);
+    else
+      printf(",,,\n");
+  } else {
+    printf(
+        "{\"op\":\"%s\",\"class\":\"%s\",\"ns_per_op\":%.3f,"
+        "\"mops\":%.3f,\"p50_ns\":%.2f,\"p90_ns\":%.2f,\"p99_ns\":%.2f,"
+        "\"p999_ns\":%.2f,\"max_ns\":%.2f",
+        op, cls, r->mean_ns, r->mops, r->p50, r->p90, r->p99, r->p999,
+        r->max);
+    printf(",\"cycles_unit\":\"%s\",\"ghz\":%.3f,\"cyc_p50\":%" PRIu64
+           ",\"cyc_p90\":%" PRIu64 ",\"cyc_p99\":%" PRIu64
+           ",\"cyc_p999\":%" PRIu64 ",\"cyc_max\":%" PRIu64,
+           bench_cycles_unit(), bench_cycles_ghz(), r->cyc_p50, r->cyc_p90,
+           r->cyc_p99, r->cyc_p999, r->cyc_max);
+    if (opt->hist) print_hist(&r->hist);
+    if (st->perf.available)
+      printf(",\"perf\":{\"instructions\":%.2f,\"branch_misses\":%.4f,"
+             "\"cache_misses\":%.4f}",
+             r->instructions, r->branch_misses, r->cache_misses);
+    else
+      printf(",\"perf\":null");
+    if (s21_stats_enabled()) print_stats(&r->stats);
+    printf("}\n");
+  }
+}
+
+static int parse_options(int argc, char **argv, bench_options *opt) {
+  int err = 0;
+
+  for (int i = 1; i < argc && !err; i++) {
+    const char *arg = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+    if (!strcmp(arg, "--no-hist")) {
+      opt->hist = 0;
+      continue;
+    }
+    if (!strcmp(arg, "--help")) {
+      opt->help = 1;
+      continue;
+    }
+
+    if (!val) {
+      err = 1;
+    } else if (!strcmp(arg, "--seed")) {
+      opt->seed = strtoull(val, NULL, 0);
+    } else if (!strcmp(arg, "--samples")) {
+      opt->samples = strtoul(val, NULL, 0);
+    } else if (!strcmp(arg, "--batch")) {
+      opt->batch = strtoul(val, NULL, 0);
+    } else if (!strcmp(arg, "--format")) {
+      opt->csv = !strcmp(val, "csv");
+    } else if (!strcmp(arg, "--filter")) {
+      opt->filter = val;
+    } else if (!strcmp(arg, "--replay")) {
+      opt->replay = val;
+    } else if (!strcmp(arg, "--generate")) {
+      opt->generate = bench_workload_parse(val);
+      err = opt->generate < 0;
+    } else if (!strcmp(arg, "--count")) {
+      opt->count = strtoul(val, NULL, 0);
+    } else if (!strcmp(arg, "--out")) {
+      opt->out = val;
+    } else if (!strcmp(arg, "--calls")) {
+      opt->calls = strtoul(val, NULL, 0);
+    } else {
+      err = 1;
+    }
+    i++;
+  }
+
+  if (opt->samples == 0 || opt->batch == 0 || opt->batch > BENCH_SET_SIZE ||
+      opt->calls == 0)
+    err = 1;
+  if (opt->generate >= 0 && (!opt->out || opt->count == 0)) err = 1;
+  return err;
+}
+
+static void print_usage(FILE *out, const char *prog) {
+  fprintf(out,
+          "usage: %s [--seed N] [--samples N] [--batch N] "
+          "[--format json|csv] [--filter name] [--replay file] "
+          "[--calls N] [--no-hist]\n"
+          "       %s --generate prices|quantities|fx_rates|notionals|ledger"
+          " [--count N] [--seed N] --out file\n"
+          "       %s --help\n",
+          prog, prog, prog);
+}
+
+// Запись реалистичного набора в файл для повторных прогонов
+static int generate_workload(const bench_options *opt) {
+  bench_workload_kind kind = (bench_workload_kind)opt->generate;
+  s21_decimal *values = malloc(sizeof(s21_decimal) * opt->count);
+  int err = values == NULL;
+
+  if (!err) err = bench_workload_generate(kind, opt->seed, values, opt->count);
+  if (!err)
+    err = bench_workload_write(opt->out, kind, opt->seed, values, opt->count);
+  if (err) fprintf(stderr, "cannot write workload %s\n", opt->out);
+
+  free(values);
+  return err;
+}
+
+// Набор класса replay из файла
+static int load_replay(const bench_options *opt, bench_set *set) {
+  s21_decimal *values = NULL;
+  size_t n = 0;
+  int err = bench_workload_read(opt->replay, NULL, NULL, &values, &n) ||
+            n == 0;
+
+  if (err)
+    fprintf(stderr, "cannot read workload %s\n", opt->replay);
+  else
+    bench_fill_values(set, values, n, opt->seed);
+
+  free(values);
+  return err;
+}
+
+int main(int argc, char **argv) {
+  bench_options opt = {0x5EED5EEDull, BENCH_DEFAULT_SAMPLES,
+                       BENCH_DEFAULT_BATCH, 0, NULL, NULL, -1,
+                       BENCH_DEFAULT_COUNT, NULL, BENCH_DEFAULT_CALLS, 1,
+                       0};
+  int bad = parse_options(argc, argv, &opt);
+
+  if (opt.help) {
+    print_usage(stdout, argv[0]);
+    return 0;
+  }
+  if (bad) {
+    print_usage(stderr, argv[0]);
+    return 1;
+  }
+
+  if (opt.generate >= 0) return generate_workload(&opt);
+
+  // Последний набор - класс replay, если задан файл
+  int classes = BENCH_CLASS_COUNT + (opt.replay != NULL);
+  bench_set *sets = malloc(sizeof(bench_set) * (size_t)classes);
+  bench_state st;
+  st.samples = malloc(sizeof(double) * opt.samples);
+  st.cycles = malloc(sizeof(uint64_t) * opt.calls);
+  int err = !sets || !st.samples || !st.cycles;
+  if (!err && opt.replay) err = load_replay(&opt, &sets[classes - 1]);
+  if (err) {
+    free(sets);
+    free(st.samples);
+    free(st.cycles);
+    return 1;
+  }
+
+  for (int c = 0; c < BENCH_CLASS_COUNT; c++)
+    bench_fill(&sets[c], (bench_class)c, opt.seed);
+
+  bench_perf_open(&st.perf);
+  st.overhead = measure_overhead(&sets[0]);
+
+  if (opt.csv)
+    printf(
+        "op,class,ns_per_op,mops,p50_ns,p90_ns,p99_ns,p999_ns,max_ns,"
+        "cyc_p50,cyc_p90,cyc_p99,cyc_p999,cyc_max,instructions,"
+        "branch_misses,cache_misses\n");
+
+  for (size_t i = 0; i < bench_ops_count; i++) {
+    const bench_op *op = &bench_ops[i];
+    if (opt.filter && !strstr(op->name, opt.filter)) continue;
+
+    for (int c = 0; c < classes; c++) {
+      const char *cls =
+          c < BENCH_CLASS_COUNT ? bench_class_name((bench_class)c) : "replay";
+      bench_result res;
+      bench_measure(op, &sets[c], &opt, &st, &res);
+      print_result(&opt, &st, op->name, cls, &res);
+      fflush(stdout);
+    }
+  }
+
+  bench_perf_close(&st.perf);
+  free(sets);
+  free(st.samples);
+  free(st.cycles);
+  return 0;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file bench.h
+ * @brief Общие определения микробенчмарков библиотеки s21_decimal
+ * @details Набор входных данных одного класса, таблица операций и
+ *          генератор псевдослучайных чисел с фиксированным зерном
+ */
+
+#ifndef S21_BENCH_H
+#define S21_BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../s21_decimal.h"
+
+#define BENCH_SET_SIZE 1024  // Количество наборов входных данных в классе
+#define BENCH_TEXT_SIZE 32   // Знак, 29 цифр и точка
+
+// Поле COPY BINARY: длина int32 и значение NUMERIC
+#define BENCH_PG_FIELD_SIZE (4 + S21_PG_NUMERIC_MAX_SIZE)
+// Блок сжатия столбца и s21_bitpack_bound(BENCH_PACK_BLOCK, BENCH_PACK_BLOCK)
+#define BENCH_PACK_BLOCK S21_BITPACK_BLOCK_SMALL
+#define BENCH_PACK_SIZE (12 + 9 + 8 * BENCH_PACK_BLOCK)
+
+// Классы входных данных
+typedef enum {
+  BENCH_SAME_SMALL = 0,  // одинаковый масштаб, мантиссы < 2^24
+  BENCH_MIXED_SMALL,     // разные масштабы, мантиссы < 2^24
+  BENCH_SAME_FULL,       // одинаковый масштаб, полные 96 бит
+  BENCH_MIXED_FULL,      // разные масштабы, полные 96 бит
+  BENCH_OVERFLOW,        // результат переполняется или округляется
+  BENCH_PRICE_QTY,       // цена и количество (bench_workload.h)
+  BENCH_LEDGER,          // пары проводок с разными знаками
+  BENCH_NOTIONAL_FX,     // сумма сделки и курс валюты
+  BENCH_CLASS_COUNT
+} bench_class;
+
+// Входные данные и буферы результатов для одного класса
+typedef struct {
+  s21_decimal a[BENCH_SET_SIZE];
+  s21_decimal b[BENCH_SET_SIZE];
+  int ints[BENCH_SET_SIZE];
+  float floats[BENCH_SET_SIZE];
+  double doubles[BENCH_SET_SIZE];
+  int64_t i64[BENCH_SET_SIZE];
+  s21_decimal out[BENCH_SET_SIZE];
+  int out_int[BENCH_SET_SIZE];
+  float out_float[BENCH_SET_SIZE];
+  double out_double[BENCH_SET_SIZE];
+  int64_t out_i64[BENCH_SET_SIZE];
+#ifdef __SIZEOF_INT128__
+  __int128 i128[BENCH_SET_SIZE];  // i64 * 1000003
+  __int128 out_i128[BENCH_SET_SIZE];
+#endif
+
+  // a и b в других форматах (входы кодеков и чисел других размеров),
+  // fixed и packed - i64 с масштабом 2
+  s21_decimal64 d64_a[BENCH_SET_SIZE];
+  s21_decimal64 d64_b[BENCH_SET_SIZE];
+  s21_decimal256 d256_a[BENCH_SET_SIZE];
+  s21_decimal256 d256_b[BENCH_SET_SIZE];
+  s21_decimal128 d128[BENCH_SET_SIZE];   // BID
+  s21_decimal128 arrow[BENCH_SET_SIZE];  // Arrow decimal128 с масштабом 10
+  char text[BENCH_SET_SIZE][BENCH_TEXT_SIZE];
+  size_t text_len[BENCH_SET_SIZE];
+  unsigned char pg[BENCH_SET_SIZE * BENCH_PG_FIELD_SIZE];  // поля подряд
+  size_t pg_pos[BENCH_SET_SIZE + 1];                       // начало поля i
+  unsigned char varint[BENCH_SET_SIZE * S21_VARINT_MAX_SIZE];  // подряд
+  size_t varint_pos[BENCH_SET_SIZE + 1];  // начало записи i
+  s21_decimal fixed[BENCH_SET_SIZE];
+  // каждый блок - отдельный столбец, чтобы распаковывать его части
+  unsigned char packed[BENCH_SET_SIZE / BENCH_PACK_BLOCK][BENCH_PACK_SIZE];
+  size_t packed_len[BENCH_SET_SIZE / BENCH_PACK_BLOCK];
+
+  s21_decimal64 out_d64[BENCH_SET_SIZE];
+  s21_decimal256 out_d256[BENCH_SET_SIZE];
+  s21_decimal128 out_d128[BENCH_SET_SIZE];
+  char out_text[BENCH_SET_SIZE][BENCH_TEXT_SIZE];
+  unsigned char out_bytes[BENCH_SET_SIZE * BENCH_PG_FIELD_SIZE];
+} bench_set;
+
+// Операция: обработать элементы [start, start + count), вернуть сумму
+// кодов возврата (используется, чтобы компилятор не выбросил вызовы)
+typedef int (*bench_fn)(bench_set *set, size_t start, size_t count);
+
+typedef struct {
+  const char *name;  // имя функции библиотеки
+  bench_fn fn;       // адаптер
+} bench_op;
+
+// Таблица всех публичных операций
+extern const bench_op bench_ops[];
+extern const size_t bench_ops_count;
+
+// Генератор splitmix64
+uint64_t bench_rand(uint64_t *state);
+
+// Имя класса входных данных
+const char *bench_class_name(bench_class cls);
+
+// Заполнить набор данными заданного класса
+void bench_fill(bench_set *set, bench_class cls, uint64_t seed);
+
+// Заполнить набор значениями из файла: a[i] = v[2i], b[i] = v[2i + 1]
+// (по кругу, если значений меньше 2 * BENCH_SET_SIZE)
+void bench_fill_values(bench_set *set, const s21_decimal *values, size_t n,
+                       uint64_t seed);
+
+#endif
@@ -0,0 +1,181 @@
+/**
+ * @file bench_cycles.c
+ * @brief rdtsc/rdtscp, гистограмма задержек и perf_event_open
+ */
+
+#define _GNU_SOURCE
+
+#include "bench_cycles.h"
+
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#endif
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+static uint64_t clock_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+#ifdef BENCH_HAVE_TSC
+
+// lfence не дает rdtsc выполниться раньше предыдущих инструкций
+uint64_t bench_cycles_begin(void) {
+  _mm_lfence();
+  uint64_t t = __rdtsc();
+  _mm_lfence();
+  return t;
+}
+
+// rdtscp ждет завершения измеряемого кода, lfence - чтения счетчика
+uint64_t bench_cycles_end(void) {
+  unsigned aux;
+  uint64_t t = __rdtscp(&aux);
+  _mm_lfence();
+  return t;
+}
+
+const char *bench_cycles_unit(void) { return "tsc"; }
+
+double bench_cycles_ghz(void) {
+  static double ghz = 0.0;
+
+  if (ghz == 0.0) {
+    uint64_t n0 = clock_ns();
+    uint64_t c0 = bench_cycles_begin();
+    while (clock_ns() - n0 < 20000000ull) {
+    }
+    uint64_t c1 = bench_cycles_end();
+    uint64_t n1 = clock_ns();
+    ghz = (double)(c1 - c0) / (double)(n1 - n0);
+  }
+  return ghz;
+}
+
+#else
+
+uint64_t bench_cycles_begin(void) { return clock_ns(); }
+
+uint64_t bench_cycles_end(void) { return clock_ns(); }
+
+const char *bench_cycles_unit(void) { return "ns"; }
+
+double bench_cycles_ghz(void) { return 1.0; }
+
+#endif
+
+void bench_hist_reset(bench_hist *h) { memset(h, 0, sizeof(*h)); }
+
+// Интервал: старший бит значения и следующие BENCH_HIST_SUB_BITS бит
+static int hist_bucket(uint64_t v) {
+  int bucket = (int)v;
+
+  if (v >= (1u << BENCH_HIST_SUB_BITS)) {
+    int msb = 63 - __builtin_clzll(v);
+    int sub = (int)((v >> (msb - BENCH_HIST_SUB_BITS)) &
+                    ((1u << BENCH_HIST_SUB_BITS) - 1u));
+    bucket = (msb << BENCH_HIST_SUB_BITS) | sub;
+  }
+  return bucket;
+}
+
+void bench_hist_add(bench_hist *h, uint64_t value) {
+  h->counts[hist_bucket(value)]++;
+  h->total++;
+}
+
+uint64_t bench_hist_lower(int bucket) {
+  uint64_t lower = (uint64_t)bucket;
+
+  if (bucket >= (2 << BENCH_HIST_SUB_BITS)) {
+    int msb = bucket >> BENCH_HIST_SUB_BITS;
+    uint64_t sub = (uint64_t)(bucket & ((1 << BENCH_HIST_SUB_BITS) - 1));
+    lower = ((1ull << BENCH_HIST_SUB_BITS) | sub)
+            << (msb - BENCH_HIST_SUB_BITS);
+  }
+  return lower;
+}
+
+#ifdef __linux__
+
+static int perf_open_one(uint64_t config, int group) {
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.disabled = group < 0;  // группа управляется через лидера
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP;
+  return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+}
+
+void bench_perf_open(bench_perf *p) {
+  static const uint64_t configs[3] = {PERF_COUNT_HW_INSTRUCTIONS,
+                                      PERF_COUNT_HW_BRANCH_MISSES,
+                                      PERF_COUNT_HW_CACHE_MISSES};
+  memset(p, 0, sizeof(*p));
+  p->available = 1;
+
+  for (int i = 0; i < 3; i++) {
+    p->fd[i] = p->available ? perf_open_one(configs[i], i ? p->fd[0] : -1)
+                            : -1;
+    if (p->fd[i] < 0) p->available = 0;
+  }
+  if (!p->available) bench_perf_close(p);
+}
+
+void bench_perf_start(bench_perf *p) {
+  if (p->available) {
+    ioctl(p->fd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(p->fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+}
+
+void bench_perf_stop(bench_perf *p) {
+  if (p->available) {
+    // формат группы: число счетчиков, затем значения по порядку
+    uint64_t buf[4] = {0, 0, 0, 0};
+    ioctl(p->fd[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    if (read(p->fd[0], buf, sizeof(buf)) == (ssize_t)sizeof(buf)) {
+      p->instructions = buf[1];
+      p->branch_misses = buf[2];
+      p->cache_misses = buf[3];
+    }
+  }
+}
+
+void bench_perf_close(bench_perf *p) {
+  for (int i = 0; i < 3; i++) {
+    if (p->fd[i] >= 0) close(p->fd[i]);
+    p->fd[i] = -1;
+  }
+  p->available = 0;
+}
+
+#else
+
+void bench_perf_open(bench_perf *p) {
+  memset(p, 0, sizeof(*p));
+  for (int i = 0; i < 3; i++) p->fd[i] = -1;
+}
+
+void bench_perf_start(bench_perf *p) { (void)p; }
+
+void bench_perf_stop(bench_perf *p) { (void)p; }
+
+void bench_perf_close(bench_perf *p) { (void)p; }
+
+#endif
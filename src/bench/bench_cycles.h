@@ -0,0 +1,60 @@
+/**
+ * @file bench_cycles.h
+ * @brief Счетчик тактов, гистограмма задержек и аппаратные счетчики
+ * @details На x86 задержка одного вызова измеряется через rdtsc/rdtscp
+ *          (единица "tsc"), на остальных платформах - через
+ *          clock_gettime (единица "ns"). Аппаратные счетчики читаются
+ *          через perf_event_open только на Linux и только если ядро
+ *          разрешает доступ, иначе bench_perf.available = 0.
+ */
+
+#ifndef S21_BENCH_CYCLES_H
+#define S21_BENCH_CYCLES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define BENCH_HIST_SUB_BITS 2  // Линейных подинтервалов на степень 2: 4
+#define BENCH_HIST_BUCKETS (64 << BENCH_HIST_SUB_BITS)
+
+// Логарифмическая гистограмма задержек
+typedef struct {
+  uint64_t counts[BENCH_HIST_BUCKETS];
+  uint64_t total;
+} bench_hist;
+
+// Группа аппаратных счетчиков
+typedef struct {
+  int available;  // 1 если счетчики открыты
+  int fd[3];      // instructions (лидер), branch-misses, cache-misses
+  uint64_t instructions;
+  uint64_t branch_misses;
+  uint64_t cache_misses;
+} bench_perf;
+
+// Отметка времени до и после измеряемого кода
+uint64_t bench_cycles_begin(void);
+uint64_t bench_cycles_end(void);
+
+// Единица измерения отметок: "tsc" или "ns"
+const char *bench_cycles_unit(void);
+
+// Частота счетчика в ГГц (оценка по clock_gettime, 1.0 для "ns")
+double bench_cycles_ghz(void);
+
+void bench_hist_reset(bench_hist *h);
+void bench_hist_add(bench_hist *h, uint64_t value);
+
+// Нижняя граница интервала гистограммы
+uint64_t bench_hist_lower(int bucket);
+
+// Открыть счетчики для текущего потока
+void bench_perf_open(bench_perf *p);
+
+// Обнулить и запустить / остановить и прочитать счетчики
+void bench_perf_start(bench_perf *p);
+void bench_perf_stop(bench_perf *p);
+
+void bench_perf_close(bench_perf *p);
+
+#endif
@@ -0,0 +1,171 @@
+/**
+ * @file bench_inputs.c
+ * @brief Генерация входных данных микробенчмарков по классам
+ */
+
+#include "bench.h"
+
+#include "bench_workload.h"
+
+static const char *const class_names[BENCH_CLASS_COUNT] = {
+    "same_scale_small", "mixed_scale_small", "same_scale_full",
+    "mixed_scale_full", "overflow_round",    "price_qty",
+    "ledger",           "notional_fx"};
+
+uint64_t bench_rand(uint64_t *state) {
+  uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+const char *bench_class_name(bench_class cls) { return class_names[cls]; }
+
+// Случайное decimal: мантисса заданной ширины, масштаб, случайный знак
+static s21_decimal random_decimal(uint64_t *state, int full, int top_bit,
+                                  int scale) {
+  s21_decimal d = {{0, 0, 0, 0}};
+  uint64_t r = bench_rand(state);
+
+  if (full) {
+    d.bits[0] = (int)(uint32_t)r;
+    d.bits[1] = (int)(uint32_t)(r >> 32);
+    d.bits[2] = (int)((uint32_t)bench_rand(state) | 1u);
+    if (top_bit) d.bits[2] = (int)((uint32_t)d.bits[2] | 0x80000000u);
+  } else {
+    d.bits[0] = (int)((uint32_t)r & 0x00FFFFFFu) | 1;
+  }
+
+  s21_set_scale(&d, scale);
+  s21_set_sign(&d, (int)((r >> 40) & 1u));
+  return d;
+}
+
+// Поля, не зависящие от класса: целые и двоичные представления a
+static void fill_scalars(bench_set *set, uint64_t *state, int full) {
+  for (size_t i = 0; i < BENCH_SET_SIZE; i++) {
+    set->ints[i] = (int)(uint32_t)bench_rand(state);
+    set->i64[i] = (int64_t)bench_rand(state);
+    if (!full) set->i64[i] >>= 40;
+#ifdef __SIZEOF_INT128__
+    set->i128[i] = (__int128)set->i64[i] * 1000003;
+#endif
+
+    s21_from_decimal_to_float(set->a[i], &set->floats[i]);
+    s21_from_decimal_to_double(set->a[i], &set->doubles[i]);
+  }
+}
+
+// Число s21_decimal64 из d, если мантисса шире 56 бит - из младших 32 бит
+static s21_decimal64 to_decimal64(const s21_decimal *d) {
+  s21_decimal64 r;
+  if (s21_decimal64_from_decimal(d, &r) != 0)
+    s21_decimal64_from_scaled_int64(d->bits[0], s21_get_scale(d), &r);
+  return r;
+}
+
+// Входы кодеков и операций над числами других размеров
+static void fill_encoded(bench_set *set) {
+  size_t pos = 0;
+  size_t varint_pos = 0;
+
+  for (size_t i = 0; i < BENCH_SET_SIZE; i++) {
+    char *end = set->text[i];
+    size_t len = 0;
+
+    set->d64_a[i] = to_decimal64(&set->a[i]);
+    set->d64_b[i] = to_decimal64(&set->b[i]);
+    s21_decimal256_from_decimal(&set->a[i], &set->d256_a[i]);
+    s21_decimal256_from_decimal(&set->b[i], &set->d256_b[i]);
+    s21_from_decimal_to_decimal128(&set->a[i], S21_DECIMAL128_BID,
+                                   &set->d128[i]);
+    s21_to_arrow_decimal128(&set->a[i], 1, 10, &set->arrow[i]);
+    s21_to_chars(&set->a[i], set->text[i], set->text[i] + BENCH_TEXT_SIZE,
+                 &end);
+    set->text_len[i] = (size_t)(end - set->text[i]);
+
+    s21_from_scaled_int64_to_decimal(set->i64[i], 2, &set->fixed[i]);
+
+    set->varint_pos[i] = varint_pos;
+    s21_encode_varint(&set->a[i], set->varint + varint_pos,
+                      sizeof(set->varint) - varint_pos, &len);
+    varint_pos += len;
+
+    set->pg_pos[i] = pos;
+    s21_to_pg_numeric_batch(&set->a[i], 1, set->pg + pos,
+                            sizeof(set->pg) - pos, &len);
+    pos += len;
+  }
+  set->pg_pos[BENCH_SET_SIZE] = pos;
+  set->varint_pos[BENCH_SET_SIZE] = varint_pos;
+
+  for (size_t k = 0; k < BENCH_SET_SIZE / BENCH_PACK_BLOCK; k++) {
+    s21_bitpack_encode_int64(&set->i64[k * BENCH_PACK_BLOCK], BENCH_PACK_BLOCK,
+                             2, BENCH_PACK_BLOCK, set->packed[k],
+                             BENCH_PACK_SIZE, &set->packed_len[k]);
+  }
+}
+
+// Классы на реалистичных наборах: a и b из разных видов данных
+static void fill_workload(bench_set *set, bench_class cls, uint64_t seed) {
+  bench_workload_kind ka = BENCH_WL_LEDGER;
+  bench_workload_kind kb = BENCH_WL_LEDGER;
+
+  if (cls == BENCH_PRICE_QTY) {
+    ka = BENCH_WL_PRICES;
+    kb = BENCH_WL_QUANTITIES;
+  } else if (cls == BENCH_NOTIONAL_FX) {
+    ka = BENCH_WL_NOTIONALS;
+    kb = BENCH_WL_FX_RATES;
+  }
+
+  bench_workload_generate(ka, seed, set->a, BENCH_SET_SIZE);
+  bench_workload_generate(kb, seed + 1, set->b, BENCH_SET_SIZE);
+}
+
+void bench_fill_values(bench_set *set, const s21_decimal *values, size_t n,
+                       uint64_t seed) {
+  uint64_t state = seed;
+
+  for (size_t i = 0; i < BENCH_SET_SIZE; i++) {
+    set->a[i] = values[(2 * i) % n];
+    set->b[i] = values[(2 * i + 1) % n];
+  }
+  fill_scalars(set, &state, 1);
+  fill_encoded(set);
+}
+
+// Синтетические классы: случайные мантиссы заданной ширины и масштабы
+static void fill_synthetic(bench_set *set, bench_class cls, int full,
+                           uint64_t *state) {
+  for (size_t i = 0; i < BENCH_SET_SIZE; i++) {
+    int scale_a = (int)(bench_rand(state) % (S21_SCALE_MAX + 1));
+    int scale_b = scale_a;
+
+    if (cls == BENCH_MIXED_SMALL || cls == BENCH_MIXED_FULL) {
+      scale_b = (scale_a + 1 + (int)(bench_rand(state) % S21_SCALE_MAX)) %
+                (S21_SCALE_MAX + 1);
+    } else if (cls == BENCH_OVERFLOW) {
+      // большие мантиссы с малым масштабом: переполнение и округление
+      scale_a = (int)(bench_rand(state) % 3);
+      scale_b = (int)(bench_rand(state) % 3);
+    }
+
+    set->a[i] = random_decimal(state, full, cls == BENCH_OVERFLOW, scale_a);
+    set->b[i] = random_decimal(state, full, cls == BENCH_OVERFLOW, scale_b);
+  }
+}
+
+void bench_fill(bench_set *set, bench_class cls, uint64_t seed) {
+  uint64_t state = seed ^ ((uint64_t)cls * 0x2545F4914F6CDD1Dull);
+  int full = (cls == BENCH_SAME_FULL || cls == BENCH_MIXED_FULL ||
+              cls == BENCH_OVERFLOW);
+
+  if (cls >= BENCH_PRICE_QTY)
+    fill_workload(set, cls, seed);
+  else
+    fill_synthetic(set, cls, full, &state);
+
+  fill_scalars(set, &state, full);
+  fill_encoded(set);
+}
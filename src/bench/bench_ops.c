@@ -0,0 +1,941 @@
+/**
+ * @file bench_ops.c
+ * @brief Таблица публичных функций s21_* для микробенчмарков
+ * @details Каждый адаптер вызывает функцию библиотеки напрямую в цикле,
+ *          поэтому косвенный вызов приходится на серию, а не на операцию
+ */
+
+#include "bench.h"
+
+// a op b -> out
+#define BENCH_BINARY(name, fn)                                      \
+  static int name(bench_set *s, size_t start, size_t count) {       \
+    int acc = 0;                                                    \
+    for (size_t i = start; i < start + count; i++)                  \
+      acc += fn(s->a[i], s->b[i], &s->out[i]);                      \
+    return acc;                                                     \
+  }
+
+// &a op &b -> out (варианты по указателям)
+#define BENCH_POINTER(name, fn)                                     \
+  static int name(bench_set *s, size_t start, size_t count) {       \
+    int acc = 0;                                                    \
+    for (size_t i = start; i < start + count; i++)                  \
+      acc += fn(&s->a[i], &s->b[i], &s->out[i]);                    \
+    return acc;                                                     \
+  }
+
+// out = a; out op= b (варианты на месте)
+#define BENCH_ASSIGN(name, fn)                                      \
+  static int name(bench_set *s, size_t start, size_t count) {       \
+    int acc = 0;                                                    \
+    for (size_t i = start; i < start + count; i++) {                \
+      s->out[i] = s->a[i];                                          \
+      acc += fn(&s->out[i], &s->b[i]);                              \
+    }                                                               \
+    return acc;                                                     \
+  }
+
+// a op b -> int
+#define BENCH_COMPARE(name, fn)                                     \
+  static int name(bench_set *s, size_t start, size_t count) {       \
+    int acc = 0;                                                    \
+    for (size_t i = start; i < start + count; i++)                  \
+      acc += fn(s->a[i], s->b[i]);                                  \
+    return acc;                                                     \
+  }
+
+// src -> dst, src и dst - поля набора
+#define BENCH_CONVERT(name, fn, src, dst)                           \
+  static int name(bench_set *s, size_t start, size_t count) {       \
+    int acc = 0;                                                    \
+    for (size_t i = start; i < start + count; i++)                  \
+      acc += fn(s->src[i], &s->dst[i]);                             \
+    return acc;                                                     \
+  }
+
+// src -> dst с масштабом 2
+#define BENCH_SCALED(name, fn, src, dst)                            \
+  static int name(bench_set *s, size_t start, size_t count) {       \
+    int acc = 0;                                                    \
+    for (size_t i = start; i < start + count; i++)                  \
+      acc += fn(s->src[i], 2, &s->dst[i]);                          \
+    return acc;                                                     \
+  }
+
+// пакетная конвертация src[start..] -> dst[start..]
+#define BENCH_BATCH(name, fn, src, dst)                             \
+  static int name(bench_set *s, size_t start, size_t count) {       \
+    return fn(&s->src[start], &s->dst[start], count);               \
+  }
+
+// пакетная арифметика с контекстом потока
+#define BENCH_BATCH_ARITH(name, fn)                                 \
+  static int name(bench_set *s, size_t start, size_t count) {       \
+    return (int)fn(&s->a[start], &s->b[start], &s->out[start], count, \
+                   NULL);                                           \
+  }
+
+// арифметика с контекстом потока
+#define BENCH_CTX(name, fn)                                         \
+  static int name(bench_set *s, size_t start, size_t count) {       \
+    int acc = 0;                                                    \
+    for (size_t i = start; i < start + count; i++)                  \
+      acc += fn(s->a[i], s->b[i], &s->out[i], NULL);                \
+    return acc;                                                     \
+  }
+
+// s21_bigdecimal: разряды берутся из пула потока, поэтому операнды
+// переводятся из a и b на каждой итерации (время перевода входит в замер),
+// а после нее разряды возвращаются в пул
+#define BENCH_BIGDECIMAL(name, fn)                                  \
+  static int name(bench_set *s, size_t start, size_t count) {       \
+    int acc = 0;                                                    \
+    for (size_t i = start; i < start + count; i++) {                \
+      size_t mark = s21_bigdecimal_mark();                          \
+      s21_bigdecimal x, y, r;                                       \
+      s21_bigdecimal_init(&x);                                      \
+      s21_bigdecimal_init(&y);                                      \
+      s21_bigdecimal_init(&r);                                      \
+      acc += s21_bigdecimal_from_decimal(&s->a[i], &x);             \
+      acc += s21_bigdecimal_from_decimal(&s->b[i], &y);             \
+      acc += fn(&x, &y, &r);                                        \
+      acc += s21_bigdecimal_to_decimal(&r, &s->out[i]);             \
+      s21_bigdecimal_release(mark);                                 \
+    }                                                               \
+    return acc;                                                     \
+  }
+
+BENCH_BINARY(op_add, s21_add)
+BENCH_BINARY(op_sub, s21_sub)
+BENCH_BINARY(op_mul, s21_mul)
+BENCH_BINARY(op_div, s21_div)
+
+BENCH_POINTER(op_add_p, s21_add_p)
+BENCH_POINTER(op_sub_p, s21_sub_p)
+BENCH_POINTER(op_mul_p, s21_mul_p)
+BENCH_POINTER(op_div_p, s21_div_p)
+
+BENCH_ASSIGN(op_add_assign, s21_add_assign)
+BENCH_ASSIGN(op_sub_assign, s21_sub_assign)
+BENCH_ASSIGN(op_mul_assign, s21_mul_assign)
+BENCH_ASSIGN(op_div_assign, s21_div_assign)
+
+BENCH_COMPARE(op_is_less, s21_is_less)
+BENCH_COMPARE(op_is_less_or_equal, s21_is_less_or_equal)
+BENCH_COMPARE(op_is_greater, s21_is_greater)
+BENCH_COMPARE(op_is_greater_or_equal, s21_is_greater_or_equal)
+BENCH_COMPARE(op_is_equal, s21_is_equal)
+BENCH_COMPARE(op_is_not_equal, s21_is_not_equal)
+
+BENCH_CONVERT(op_floor, s21_floor, a, out)
+BENCH_CONVERT(op_round, s21_round, a, out)
+BENCH_CONVERT(op_truncate, s21_truncate, a, out)
+BENCH_CONVERT(op_negate, s21_negate, a, out)
+
+BENCH_CONVERT(op_from_int, s21_from_int_to_decimal, ints, out)
+BENCH_CONVERT(op_from_float, s21_from_float_to_decimal, floats, out)
+BENCH_CONVERT(op_to_int, s21_from_decimal_to_int, a, out_int)
+BENCH_CONVERT(op_to_float, s21_from_decimal_to_float, a, out_float)
+BENCH_CONVERT(op_to_double, s21_from_decimal_to_double, a, out_double)
+BENCH_CONVERT(op_from_int64, s21_from_int64_to_decimal, i64, out)
+BENCH_CONVERT(op_to_int64, s21_from_decimal_to_int64, a, out_i64)
+BENCH_SCALED(op_from_scaled, s21_from_scaled_int64_to_decimal, i64, out)
+BENCH_SCALED(op_to_scaled, s21_from_decimal_to_scaled_int64, a, out_i64)
+
+BENCH_BATCH(op_to_float_batch, s21_from_decimal_to_float_batch, a,
+            out_float)
+BENCH_BATCH(op_to_double_batch, s21_from_decimal_to_double_batch, a,
+            out_double)
+BENCH_BATCH(op_from_int64_batch, s21_from_int64_to_decimal_batch, i64, out)
+BENCH_BATCH(op_to_int64_batch, s21_from_decimal_to_int64_batch, a, out_i64)
+
+BENCH_CTX(op_add_ctx, s21_add_ctx)
+BENCH_CTX(op_sub_ctx, s21_sub_ctx)
+BENCH_CTX(op_mul_ctx, s21_mul_ctx)
+BENCH_CTX(op_div_ctx, s21_div_ctx)
+
+BENCH_BATCH_ARITH(op_add_batch, s21_add_batch)
+BENCH_BATCH_ARITH(op_sub_batch, s21_sub_batch)
+BENCH_BATCH_ARITH(op_mul_batch, s21_mul_batch)
+BENCH_BATCH_ARITH(op_div_batch, s21_div_batch)
+
+// Функции, не подходящие под общие шаблоны
+
+// сложение и вычитание через одну пару
+static int op_add_sub_p(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_add_sub_p(&s->a[i], &s->b[i], (int)(i & 1u), &s->out[i]);
+  return acc;
+}
+
+static int op_from_uint64(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_from_uint64_to_decimal((uint64_t)s->i64[i], &s->out[i]);
+  return acc;
+}
+
+static int op_to_uint64(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_from_decimal_to_uint64(s->a[i], (uint64_t *)&s->out_i64[i]);
+  return acc;
+}
+
+static int op_round_to_scale(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_round_to_scale(s->a[i], 2, S21_ROUND_HALF_EVEN, &s->out[i]);
+  return acc;
+}
+
+static int op_from_scaled_batch(bench_set *s, size_t start, size_t count) {
+  return s21_from_scaled_int64_to_decimal_batch(&s->i64[start], 2,
+                                                &s->out[start], count);
+}
+
+static int op_to_scaled_batch(bench_set *s, size_t start, size_t count) {
+  return s21_from_decimal_to_scaled_int64_batch(&s->a[start], 2,
+                                                &s->out_i64[start], count);
+}
+
+static int op_from_uint64_batch(bench_set *s, size_t start, size_t count) {
+  return s21_from_uint64_to_decimal_batch((const uint64_t *)&s->i64[start],
+                                          &s->out[start], count);
+}
+
+static int op_to_uint64_batch(bench_set *s, size_t start, size_t count) {
+  return s21_from_decimal_to_uint64_batch(
+      &s->a[start], (uint64_t *)&s->out_i64[start], count);
+}
+
+// a * b + a - b по столбцам (формула компилируется при первом вызове)
+static int op_formula_eval(bench_set *s, size_t start, size_t count) {
+  static s21_formula f;
+  static int compiled = 0;
+  if (!compiled) compiled = s21_formula_compile("a * b + a - b", &f, NULL) == 0;
+  const s21_decimal *columns[] = {&s->a[start], &s->b[start]};
+  return (int)s21_formula_eval(&f, columns, &s->out[start], count, NULL);
+}
+
+static int op_formula_compile(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  (void)s;
+  for (size_t i = start; i < start + count; i++) {
+    s21_formula f;
+    acc += s21_formula_compile("a * b + a - b", &f, NULL);
+  }
+  return acc;
+}
+
+// номер переменной b в a * b + a - b
+static int op_formula_var(bench_set *s, size_t start, size_t count) {
+  static s21_formula f;
+  static int compiled = 0;
+  int acc = 0;
+  (void)s;
+  if (!compiled) compiled = s21_formula_compile("a * b + a - b", &f, NULL) == 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_formula_var(&f, "b");
+  return acc;
+}
+
+#ifdef __SIZEOF_INT128__
+BENCH_CONVERT(op_from_int128, s21_from_int128_to_decimal, i128, out)
+BENCH_CONVERT(op_to_int128, s21_from_decimal_to_int128, a, out_i128)
+BENCH_BATCH(op_from_int128_batch, s21_from_int128_to_decimal_batch, i128, out)
+BENCH_BATCH(op_to_int128_batch, s21_from_decimal_to_int128_batch, a,
+            out_i128)
+#endif
+
+// Контекст потока
+
+static int op_context_get(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  (void)s;
+  for (size_t i = start; i < start + count; i++)
+    acc += (int)s21_context_get()->flags;
+  return acc;
+}
+
+// локальный контекст, чтобы не сбрасывать флаги потока
+static int op_context_init(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  (void)s;
+  for (size_t i = start; i < start + count; i++) {
+    s21_context ctx;
+    s21_context_init(&ctx);
+    acc += ctx.max_scale;
+  }
+  return acc;
+}
+
+static int op_context_raise(bench_set *s, size_t start, size_t count) {
+  for (size_t i = start; i < start + count; i++)
+    s21_context_raise((unsigned)s21_get_sign(&s->a[i]) * S21_FLAG_INEXACT);
+  return 0;
+}
+
+// Счетчики медленных путей
+
+static int op_stats_enabled(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  (void)s;
+  for (size_t i = start; i < start + count; i++) acc += s21_stats_enabled();
+  return acc;
+}
+
+static int op_stats_snapshot(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  (void)s;
+  for (size_t i = start; i < start + count; i++) {
+    s21_stats st;
+    s21_stats_snapshot(&st);
+    acc += (int)st.add_calls;
+  }
+  return acc;
+}
+
+static int op_stats_reset(bench_set *s, size_t start, size_t count) {
+  (void)s;
+  for (size_t i = start; i < start + count; i++) s21_stats_reset();
+  return 0;
+}
+
+// Числа других размеров
+
+static int op_decimal64_from_decimal(bench_set *s, size_t start,
+                                     size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_decimal64_from_decimal(&s->a[i], &s->out_d64[i]);
+  return acc;
+}
+
+static int op_decimal64_add(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_decimal64_add(s->d64_a[i], s->d64_b[i], &s->out_d64[i],
+                             &s->out[i]);
+  return acc;
+}
+
+static int op_decimal64_mul(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_decimal64_mul(s->d64_a[i], s->d64_b[i], &s->out_d64[i],
+                             &s->out[i]);
+  return acc;
+}
+
+static int op_decimal64_sub(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_decimal64_sub(s->d64_a[i], s->d64_b[i], &s->out_d64[i],
+                             &s->out[i]);
+  return acc;
+}
+
+static int op_decimal64_compare(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_decimal64_compare(s->d64_a[i], s->d64_b[i]);
+  return acc;
+}
+
+// i64 сдвигается до 56 бит, иначе значение не помещается
+static int op_decimal64_from_scaled_int64(bench_set *s, size_t start,
+                                          size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_decimal64_from_scaled_int64(s->i64[i] >> 8, 2, &s->out_d64[i]);
+  return acc;
+}
+
+BENCH_CONVERT(op_decimal64_to_decimal, s21_decimal64_to_decimal, d64_a, out)
+BENCH_BATCH(op_decimal64_from_decimal_batch, s21_decimal64_from_decimal_batch,
+            a, out_d64)
+BENCH_BATCH(op_decimal64_to_decimal_batch, s21_decimal64_to_decimal_batch,
+            d64_a, out)
+
+static int op_decimal256_add(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_decimal256_add(&s->d256_a[i], &s->d256_b[i], &s->out_d256[i]);
+  return acc;
+}
+
+static int op_decimal256_mul(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_decimal256_mul(&s->d256_a[i], &s->d256_b[i], &s->out_d256[i]);
+  return acc;
+}
+
+static int op_decimal256_sub(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_decimal256_sub(&s->d256_a[i], &s->d256_b[i], &s->out_d256[i]);
+  return acc;
+}
+
+static int op_decimal256_compare(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_decimal256_compare(&s->d256_a[i], &s->d256_b[i]);
+  return acc;
+}
+
+static int op_decimal256_from_decimal(bench_set *s, size_t start,
+                                      size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_decimal256_from_decimal(&s->a[i], &s->out_d256[i]);
+  return acc;
+}
+
+static int op_decimal256_to_decimal(bench_set *s, size_t start,
+                                    size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_decimal256_to_decimal(&s->d256_a[i], &s->out[i]);
+  return acc;
+}
+
+// Числа произвольной длины
+
+BENCH_BIGDECIMAL(op_bigdecimal_add, s21_bigdecimal_add)
+BENCH_BIGDECIMAL(op_bigdecimal_sub, s21_bigdecimal_sub)
+BENCH_BIGDECIMAL(op_bigdecimal_mul, s21_bigdecimal_mul)
+
+static int op_bigdecimal_compare(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++) {
+    size_t mark = s21_bigdecimal_mark();
+    s21_bigdecimal x, y;
+    int cmp = 0;
+    s21_bigdecimal_init(&x);
+    s21_bigdecimal_init(&y);
+    acc += s21_bigdecimal_from_decimal(&s->a[i], &x);
+    acc += s21_bigdecimal_from_decimal(&s->b[i], &y);
+    acc += s21_bigdecimal_compare(&x, &y, &cmp) + cmp;
+    s21_bigdecimal_release(mark);
+  }
+  return acc;
+}
+
+static int op_bigdecimal_from_decimal(bench_set *s, size_t start,
+                                      size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++) {
+    size_t mark = s21_bigdecimal_mark();
+    s21_bigdecimal x;
+    s21_bigdecimal_init(&x);
+    acc += s21_bigdecimal_from_decimal(&s->a[i], &x) + x.len;
+    s21_bigdecimal_release(mark);
+  }
+  return acc;
+}
+
+// перевод a туда и обратно: s21_bigdecimal_to_decimal - разность с
+// замером s21_bigdecimal_from_decimal
+static int op_bigdecimal_to_decimal(bench_set *s, size_t start,
+                                    size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++) {
+    size_t mark = s21_bigdecimal_mark();
+    s21_bigdecimal x;
+    s21_bigdecimal_init(&x);
+    acc += s21_bigdecimal_from_decimal(&s->a[i], &x);
+    acc += s21_bigdecimal_to_decimal(&x, &s->out[i]);
+    s21_bigdecimal_release(mark);
+  }
+  return acc;
+}
+
+static int op_bigdecimal_init(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  (void)s;
+  for (size_t i = start; i < start + count; i++) {
+    s21_bigdecimal x;
+    s21_bigdecimal_init(&x);
+    acc += x.len;
+  }
+  return acc;
+}
+
+static int op_bigdecimal_mark(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  (void)s;
+  for (size_t i = start; i < start + count; i++)
+    acc += (int)s21_bigdecimal_mark();
+  return acc;
+}
+
+// возврат в пул без выделенных разрядов (стоимость самого вызова)
+static int op_bigdecimal_release(bench_set *s, size_t start, size_t count) {
+  size_t mark = s21_bigdecimal_mark();
+  (void)s;
+  for (size_t i = start; i < start + count; i++) s21_bigdecimal_release(mark);
+  return 0;
+}
+
+// Текст и форматы обмена
+
+static int op_to_chars(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++) {
+    char *end = NULL;
+    acc += s21_to_chars(&s->a[i], s->out_text[i],
+                        s->out_text[i] + BENCH_TEXT_SIZE, &end);
+  }
+  return acc;
+}
+
+static int op_from_chars(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++) {
+    const char *end = NULL;
+    acc += s21_from_chars(s->text[i], s->text[i] + s->text_len[i], &s->out[i],
+                          &end);
+  }
+  return acc;
+}
+
+static int op_to_decimal128(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_from_decimal_to_decimal128(&s->a[i], S21_DECIMAL128_BID,
+                                          &s->out_d128[i]);
+  return acc;
+}
+
+static int op_from_decimal128(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_from_decimal128_to_decimal(s->d128[i], S21_DECIMAL128_BID,
+                                          &s->out[i]);
+  return acc;
+}
+
+static int op_to_decimal128_batch(bench_set *s, size_t start, size_t count) {
+  return s21_from_decimal_to_decimal128_batch(
+      &s->a[start], S21_DECIMAL128_BID, &s->out_d128[start], count);
+}
+
+static int op_from_decimal128_batch(bench_set *s, size_t start,
+                                    size_t count) {
+  return s21_from_decimal128_to_decimal_batch(
+      &s->d128[start], S21_DECIMAL128_BID, &s->out[start], count);
+}
+
+static int op_to_arrow(bench_set *s, size_t start, size_t count) {
+  return s21_to_arrow_decimal128(&s->a[start], count, 10, &s->out_d128[start]);
+}
+
+static int op_from_arrow(bench_set *s, size_t start, size_t count) {
+  return s21_from_arrow_decimal128(&s->arrow[start], count, 10,
+                                   &s->out[start]);
+}
+
+// экспорт копии [start, start + count) с масштабом 10 и release
+static int op_arrow_export(bench_set *s, size_t start, size_t count) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  int result = s21_arrow_export_decimal128(&s->a[start], count, 10, 0,
+                                           &schema, &array);
+  if (result != 1) {
+    array.release(&array);
+    schema.release(&schema);
+  }
+  return result;
+}
+
+// массив ссылается на набор, освобождать нечего
+static void arrow_release_schema(struct ArrowSchema *schema) {
+  schema->release = NULL;
+}
+
+static void arrow_release_array(struct ArrowArray *array) {
+  array->release = NULL;
+}
+
+static int op_arrow_import(bench_set *s, size_t start, size_t count) {
+  const void *buffers[2] = {NULL, s->arrow};
+  struct ArrowSchema schema = {.format = "d:38,10",
+                               .release = arrow_release_schema};
+  struct ArrowArray array = {.length = (int64_t)count,
+                             .offset = (int64_t)start,
+                             .n_buffers = 2,
+                             .buffers = buffers,
+                             .release = arrow_release_array};
+  return s21_arrow_import_decimal128(&schema, &array, &s->out[start]);
+}
+
+// мантисса a и порядок -масштаб (как при импорте Arrow)
+static int op_coef_to_decimal(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++) {
+    uint32_t c[8] = {0};
+    u96_from_dec(&s->a[i], c);
+    acc += s21_coef_to_decimal(c, -s21_get_scale(&s->a[i]),
+                               s21_get_sign(&s->a[i]), &s->out[i]);
+  }
+  return acc;
+}
+
+static int op_to_pg_numeric(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++) {
+    size_t len = 0;
+    acc += s21_to_pg_numeric(&s->a[i], &s->out_bytes[i * BENCH_PG_FIELD_SIZE],
+                             S21_PG_NUMERIC_MAX_SIZE, &len);
+  }
+  return acc;
+}
+
+// значение поля COPY BINARY без 4 байт длины
+static int op_from_pg_numeric(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_from_pg_numeric(s->pg + s->pg_pos[i] + 4,
+                               s->pg_pos[i + 1] - s->pg_pos[i] - 4,
+                               &s->out[i]);
+  return acc;
+}
+
+static int op_to_pg_numeric_batch(bench_set *s, size_t start, size_t count) {
+  size_t written = 0;
+  return s21_to_pg_numeric_batch(&s->a[start], count, s->out_bytes,
+                                 sizeof(s->out_bytes), &written);
+}
+
+static int op_from_pg_numeric_batch(bench_set *s, size_t start,
+                                    size_t count) {
+  const unsigned char *src = s->pg + s->pg_pos[start];
+  size_t len = s->pg_pos[start + count] - s->pg_pos[start];
+  return s21_from_pg_numeric_batch(src, len, &s->out[start], count, NULL);
+}
+
+static int op_encode_varint(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++) {
+    size_t len = 0;
+    acc += s21_encode_varint(&s->a[i], &s->out_bytes[i * S21_VARINT_MAX_SIZE],
+                             S21_VARINT_MAX_SIZE, &len);
+  }
+  return acc;
+}
+
+static int op_decode_varint(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++)
+    acc += s21_decode_varint(s->varint + s->varint_pos[i],
+                             s->varint_pos[i + 1] - s->varint_pos[i],
+                             &s->out[i], NULL);
+  return acc;
+}
+
+static int op_encode_varint_batch(bench_set *s, size_t start, size_t count) {
+  size_t done = 0;
+  return s21_encode_varint_batch(&s->a[start], count, s->out_bytes,
+                                 sizeof(s->out_bytes), &done, NULL);
+}
+
+static int op_decode_varint_batch(bench_set *s, size_t start, size_t count) {
+  size_t done = 0;
+  return s21_decode_varint_batch(
+      s->varint + s->varint_pos[start],
+      s->varint_pos[start + count] - s->varint_pos[start], &s->out[start],
+      count, &done, NULL);
+}
+
+static int op_bitpack_encode(bench_set *s, size_t start, size_t count) {
+  size_t len = 0;
+  return s21_bitpack_encode(&s->fixed[start], count, 2, BENCH_PACK_BLOCK,
+                            s->out_bytes, sizeof(s->out_bytes), &len);
+}
+
+static int op_bitpack_encode_int64(bench_set *s, size_t start, size_t count) {
+  size_t len = 0;
+  return s21_bitpack_encode_int64(&s->i64[start], count, 2, BENCH_PACK_BLOCK,
+                                  s->out_bytes, sizeof(s->out_bytes), &len);
+}
+
+// Распаковываются целые блоки, в которые попадает [start, start + count):
+// одиночный вызов стоит как распаковка BENCH_PACK_BLOCK значений
+static int op_bitpack_decode(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t k = start / BENCH_PACK_BLOCK;
+       k * BENCH_PACK_BLOCK < start + count; k++)
+    acc += s21_bitpack_decode(s->packed[k], s->packed_len[k],
+                              &s->out[k * BENCH_PACK_BLOCK]);
+  return acc;
+}
+
+static int op_bitpack_decode_int64(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t k = start / BENCH_PACK_BLOCK;
+       k * BENCH_PACK_BLOCK < start + count; k++)
+    acc += s21_bitpack_decode_int64(s->packed[k], s->packed_len[k],
+                                    &s->out_i64[k * BENCH_PACK_BLOCK]);
+  return acc;
+}
+
+// заголовок блока, в который попадает элемент i
+static int op_bitpack_info(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++) {
+    size_t n = 0;
+    int scale = 0;
+    size_t k = i / BENCH_PACK_BLOCK;
+    acc += s21_bitpack_info(s->packed[k], s->packed_len[k], &n, &scale);
+    acc += (int)n + scale;
+  }
+  return acc;
+}
+
+static int op_bitpack_bound(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  (void)s;
+  for (size_t i = start; i < start + count; i++)
+    acc += (int)s21_bitpack_bound(i + 1, BENCH_PACK_BLOCK);
+  return acc;
+}
+
+// Вспомогательные функции масштаба и знака
+
+// мантисса double и порядок (мантисса не должна быть нулем)
+static int op_decimal_to_binary(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++) {
+    int exp2 = 0;
+    if (!s21_is_zero(&s->a[i]))
+      s21_decimal_to_binary(&s->a[i], 53, (uint64_t *)&s->out_i64[i], &exp2);
+    acc += exp2;
+  }
+  return acc;
+}
+
+// частное - мантисса a, остаток - младшие 64 бита мантиссы b < 10^20
+static int op_round_increment(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++) {
+    uint32_t q[3], rem[3];
+    u96_from_dec(&s->a[i], q);
+    u96_from_dec(&s->b[i], rem);
+    rem[2] = 0u;
+    acc += s21_round_increment(q, rem, 20, s21_get_sign(&s->a[i]),
+                               S21_ROUND_HALF_EVEN);
+  }
+  return acc;
+}
+
+static int op_get_scale(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++) acc += s21_get_scale(&s->a[i]);
+  return acc;
+}
+
+static int op_set_scale(bench_set *s, size_t start, size_t count) {
+  for (size_t i = start; i < start + count; i++) {
+    s->out[i] = s->a[i];
+    s21_set_scale(&s->out[i], s21_get_scale(&s->b[i]));
+  }
+  return 0;
+}
+
+static int op_get_sign(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++) acc += s21_get_sign(&s->a[i]);
+  return acc;
+}
+
+static int op_set_sign(bench_set *s, size_t start, size_t count) {
+  for (size_t i = start; i < start + count; i++) {
+    s->out[i] = s->a[i];
+    s21_set_sign(&s->out[i], s21_get_sign(&s->b[i]));
+  }
+  return 0;
+}
+
+static int op_is_zero(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++) acc += s21_is_zero(&s->a[i]);
+  return acc;
+}
+
+static int op_reset_value(bench_set *s, size_t start, size_t count) {
+  for (size_t i = start; i < start + count; i++) s21_reset_value(&s->out[i]);
+  return 0;
+}
+
+static int op_strip_trailing_zeros(bench_set *s, size_t start, size_t count) {
+  for (size_t i = start; i < start + count; i++) {
+    s->out[i] = s->a[i];
+    s21_strip_trailing_zeros(&s->out[i]);
+  }
+  return 0;
+}
+
+static int op_to_common_scale(bench_set *s, size_t start, size_t count) {
+  for (size_t i = start; i < start + count; i++) {
+    s21_decimal a = s->a[i];
+    s21_decimal b = s->b[i];
+    s21_to_common_scale(&a, &b);
+    s->out[i] = a;
+  }
+  return 0;
+}
+
+static int op_scale_down_one_banker(bench_set *s, size_t start,
+                                    size_t count) {
+  for (size_t i = start; i < start + count; i++) {
+    s->out[i] = s->a[i];
+    if (s21_get_scale(&s->out[i]) > 0) s21_scale_down_one_banker(&s->out[i]);
+  }
+  return 0;
+}
+
+static int op_scale_up_one(bench_set *s, size_t start, size_t count) {
+  int acc = 0;
+  for (size_t i = start; i < start + count; i++) {
+    s->out[i] = s->a[i];
+    acc += s21_scale_up_one(&s->out[i]);
+  }
+  return acc;
+}
+
+const bench_op bench_ops[] = {
+    {"s21_add", op_add},
+    {"s21_sub", op_sub},
+    {"s21_mul", op_mul},
+    {"s21_div", op_div},
+    {"s21_add_p", op_add_p},
+    {"s21_sub_p", op_sub_p},
+    {"s21_mul_p", op_mul_p},
+    {"s21_div_p", op_div_p},
+    {"s21_add_sub_p", op_add_sub_p},
+    {"s21_add_assign", op_add_assign},
+    {"s21_sub_assign", op_sub_assign},
+    {"s21_mul_assign", op_mul_assign},
+    {"s21_div_assign", op_div_assign},
+    {"s21_is_less", op_is_less},
+    {"s21_is_less_or_equal", op_is_less_or_equal},
+    {"s21_is_greater", op_is_greater},
+    {"s21_is_greater_or_equal", op_is_greater_or_equal},
+    {"s21_is_equal", op_is_equal},
+    {"s21_is_not_equal", op_is_not_equal},
+    {"s21_floor", op_floor},
+    {"s21_round", op_round},
+    {"s21_truncate", op_truncate},
+    {"s21_negate", op_negate},
+    {"s21_round_to_scale", op_round_to_scale},
+    {"s21_from_int_to_decimal", op_from_int},
+    {"s21_from_float_to_decimal", op_from_float},
+    {"s21_from_decimal_to_int", op_to_int},
+    {"s21_from_decimal_to_float", op_to_float},
+    {"s21_from_decimal_to_double", op_to_double},
+    {"s21_from_decimal_to_float_batch", op_to_float_batch},
+    {"s21_from_decimal_to_double_batch", op_to_double_batch},
+    {"s21_from_int64_to_decimal", op_from_int64},
+    {"s21_from_uint64_to_decimal", op_from_uint64},
+    {"s21_from_scaled_int64_to_decimal", op_from_scaled},
+    {"s21_from_decimal_to_int64", op_to_int64},
+    {"s21_from_decimal_to_uint64", op_to_uint64},
+    {"s21_from_decimal_to_scaled_int64", op_to_scaled},
+    {"s21_from_int64_to_decimal_batch", op_from_int64_batch},
+    {"s21_from_uint64_to_decimal_batch", op_from_uint64_batch},
+    {"s21_from_scaled_int64_to_decimal_batch", op_from_scaled_batch},
+    {"s21_from_decimal_to_int64_batch", op_to_int64_batch},
+    {"s21_from_decimal_to_uint64_batch", op_to_uint64_batch},
+    {"s21_from_decimal_to_scaled_int64_batch", op_to_scaled_batch},
+#ifdef __SIZEOF_INT128__
+    {"s21_from_int128_to_decimal", op_from_int128},
+    {"s21_from_decimal_to_int128", op_to_int128},
+    {"s21_from_int128_to_decimal_batch", op_from_int128_batch},
+    {"s21_from_decimal_to_int128_batch", op_to_int128_batch},
+#endif
+    {"s21_context_get", op_context_get},
+    {"s21_context_init", op_context_init},
+    {"s21_context_raise", op_context_raise},
+    {"s21_stats_enabled", op_stats_enabled},
+    {"s21_stats_snapshot", op_stats_snapshot},
+    {"s21_stats_reset", op_stats_reset},
+    {"s21_add_ctx", op_add_ctx},
+    {"s21_sub_ctx", op_sub_ctx},
+    {"s21_mul_ctx", op_mul_ctx},
+    {"s21_div_ctx", op_div_ctx},
+    {"s21_add_batch", op_add_batch},
+    {"s21_sub_batch", op_sub_batch},
+    {"s21_mul_batch", op_mul_batch},
+    {"s21_div_batch", op_div_batch},
+    {"s21_formula_compile", op_formula_compile},
+    {"s21_formula_var", op_formula_var},
+    {"s21_formula_eval", op_formula_eval},
+    {"s21_decimal64_from_decimal", op_decimal64_from_decimal},
+    {"s21_decimal64_add", op_decimal64_add},
+    {"s21_decimal64_mul", op_decimal64_mul},
+    {"s21_decimal64_sub", op_decimal64_sub},
+    {"s21_decimal64_compare", op_decimal64_compare},
+    {"s21_decimal64_from_scaled_int64", op_decimal64_from_scaled_int64},
+    {"s21_decimal64_to_decimal", op_decimal64_to_decimal},
+    {"s21_decimal64_from_decimal_batch", op_decimal64_from_decimal_batch},
+    {"s21_decimal64_to_decimal_batch", op_decimal64_to_decimal_batch},
+    {"s21_decimal256_from_decimal", op_decimal256_from_decimal},
+    {"s21_decimal256_to_decimal", op_decimal256_to_decimal},
+    {"s21_decimal256_add", op_decimal256_add},
+    {"s21_decimal256_sub", op_decimal256_sub},
+    {"s21_decimal256_mul", op_decimal256_mul},
+    {"s21_decimal256_compare", op_decimal256_compare},
+    {"s21_bigdecimal_init", op_bigdecimal_init},
+    {"s21_bigdecimal_mark", op_bigdecimal_mark},
+    {"s21_bigdecimal_release", op_bigdecimal_release},
+    {"s21_bigdecimal_from_decimal", op_bigdecimal_from_decimal},
+    {"s21_bigdecimal_to_decimal", op_bigdecimal_to_decimal},
+    {"s21_bigdecimal_add", op_bigdecimal_add},
+    {"s21_bigdecimal_sub", op_bigdecimal_sub},
+    {"s21_bigdecimal_mul", op_bigdecimal_mul},
+    {"s21_bigdecimal_compare", op_bigdecimal_compare},
+    {"s21_to_chars", op_to_chars},
+    {"s21_from_chars", op_from_chars},
+    {"s21_from_decimal_to_decimal128", op_to_decimal128},
+    {"s21_from_decimal128_to_decimal", op_from_decimal128},
+    {"s21_from_decimal_to_decimal128_batch", op_to_decimal128_batch},
+    {"s21_from_decimal128_to_decimal_batch", op_from_decimal128_batch},
+    {"s21_to_arrow_decimal128", op_to_arrow},
+    {"s21_from_arrow_decimal128", op_from_arrow},
+    {"s21_arrow_export_decimal128", op_arrow_export},
+    {"s21_arrow_import_decimal128", op_arrow_import},
+    {"s21_coef_to_decimal", op_coef_to_decimal},
+    {"s21_to_pg_numeric", op_to_pg_numeric},
+    {"s21_from_pg_numeric", op_from_pg_numeric},
+    {"s21_to_pg_numeric_batch", op_to_pg_numeric_batch},
+    {"s21_from_pg_numeric_batch", op_from_pg_numeric_batch},
+    {"s21_encode_varint", op_encode_varint},
+    {"s21_decode_varint", op_decode_varint},
+    {"s21_encode_varint_batch", op_encode_varint_batch},
+    {"s21_decode_varint_batch", op_decode_varint_batch},
+    {"s21_bitpack_bound", op_bitpack_bound},
+    {"s21_bitpack_encode", op_bitpack_encode},
+    {"s21_bitpack_encode_int64", op_bitpack_encode_int64},
+    {"s21_bitpack_info", op_bitpack_info},
+    {"s21_bitpack_decode", op_bitpack_decode},
+    {"s21_bitpack_decode_int64", op_bitpack_decode_int64},
+    {"s21_get_scale", op_get_scale},
+    {"s21_set_scale", op_set_scale},
+    {"s21_get_sign", op_get_sign},
+    {"s21_set_sign", op_set_sign},
+    {"s21_is_zero", op_is_zero},
+    {"s21_reset_value", op_reset_value},
+    {"s21_strip_trailing_zeros", op_strip_trailing_zeros},
+    {"s21_to_common_scale", op_to_common_scale},
+    {"s21_scale_down_one_banker", op_scale_down_one_banker},
+    {"s21_scale_up_one", op_scale_up_one},
+    {"s21_decimal_to_binary", op_decimal_to_binary},
+    {"s21_round_increment", op_round_increment},
+};
+
+const size_t bench_ops_count = sizeof(bench_ops) / sizeof(bench_ops[0]);
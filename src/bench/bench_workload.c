@@ -0,0 +1,243 @@
+/**
+ * @file bench_workload.c
+ * @brief Реалистичные наборы decimal и их двоичный формат
+ */
+
+#include "bench_workload.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+static const char *const workload_names[BENCH_WL_COUNT] = {
+    "prices", "quantities", "fx_rates", "notionals", "ledger"};
+
+static const char workload_magic[4] = {'S', '2', '1', 'W'};
+
+const char *bench_workload_name(bench_workload_kind kind) {
+  return workload_names[kind];
+}
+
+int bench_workload_parse(const char *name) {
+  int kind = -1;
+  for (int k = 0; k < BENCH_WL_COUNT && kind < 0; k++)
+    if (!strcmp(name, workload_names[k])) kind = k;
+  return kind;
+}
+
+// Равномерное число в [0, 1)
+static double rand_unit(uint64_t *state) {
+  return (double)(bench_rand(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Равномерное целое в [lo, hi]
+static int rand_range(uint64_t *state, int lo, int hi) {
+  return lo + (int)(bench_rand(state) % (uint64_t)(hi - lo + 1));
+}
+
+// Логарифмически равномерное число в [lo, hi]
+static double rand_log_uniform(uint64_t *state, double lo, double hi) {
+  return lo * exp(rand_unit(state) * log(hi / lo));
+}
+
+// Стандартное нормальное распределение (преобразование Бокса-Мюллера)
+static double rand_normal(uint64_t *state) {
+  double u = 1.0 - rand_unit(state);
+  double v = rand_unit(state);
+  return sqrt(-2.0 * log(u)) * cos(6.283185307179586 * v);
+}
+
+// Значение с заданным масштабом: мантисса = round(|x| * 10^scale)
+static s21_decimal make_value(double x, int scale) {
+  s21_decimal d = {{0, 0, 0, 0}};
+  double m = floor(fabs(x) * pow(10.0, scale) + 0.5);
+
+  if (m < 1.0) m = 1.0;
+  if (m > 1e18) m = 1e18;
+  s21_from_uint64_to_decimal((uint64_t)m, &d);
+  s21_set_scale(&d, scale);
+  s21_set_sign(&d, x < 0.0);
+  return d;
+}
+
+// Цена: от центов до десятков тысяч, котировки с 2-8 знаками
+static s21_decimal gen_price(uint64_t *state) {
+  int scale = rand_range(state, 2, 8);
+  // Большинство инструментов котируются с 2 или 4 знаками
+  if (rand_unit(state) < 0.6) scale = (bench_rand(state) & 1u) ? 2 : 4;
+  return make_value(rand_log_uniform(state, 0.01, 10000.0), scale);
+}
+
+// Количество: целые лоты, реже дробные (до 4 знаков)
+static s21_decimal gen_quantity(uint64_t *state) {
+  s21_decimal d;
+  if (rand_unit(state) < 0.7)
+    d = make_value(floor(rand_log_uniform(state, 1.0, 10000.0)), 0);
+  else
+    d = make_value(rand_log_uniform(state, 0.0001, 1000.0),
+                   rand_range(state, 1, 4));
+  return d;
+}
+
+// Курс валюты: логнормальное распределение около 1, 10-12 знаков
+static s21_decimal gen_fx_rate(uint64_t *state) {
+  double x = exp(2.0 * rand_normal(state));
+  if (x < 0.0001) x = 0.0001;
+  if (x > 10000.0) x = 10000.0;
+  return make_value(x, rand_range(state, 10, 12));
+}
+
+// Сумма сделки: Парето с alpha = 1.2, минимум 100.00, до 10^15
+static s21_decimal gen_notional(uint64_t *state) {
+  double u = 1.0 - rand_unit(state);
+  double x = 100.0 / pow(u, 1.0 / 1.2);
+  if (x > 1e15) x = 1e15;
+  return make_value(x, 2);
+}
+
+// Проводка: дебет/кредит с логнормальной суммой, 5% сторно предыдущей
+static s21_decimal gen_ledger(uint64_t *state, const s21_decimal *prev) {
+  s21_decimal d;
+  if (prev && rand_unit(state) < 0.05) {
+    s21_negate(*prev, &d);
+  } else {
+    double x = exp(4.0 + 2.5 * rand_normal(state));
+    if (bench_rand(state) & 1u) x = -x;
+    d = make_value(x, 2);
+  }
+  return d;
+}
+
+int bench_workload_generate(bench_workload_kind kind, uint64_t seed,
+                            s21_decimal *out, size_t n) {
+  if (!out || kind < 0 || kind >= BENCH_WL_COUNT) return 1;
+
+  uint64_t state = seed ^ ((uint64_t)(kind + 1) * 0xD1B54A32D192ED03ull);
+
+  for (size_t i = 0; i < n; i++) {
+    switch (kind) {
+      case BENCH_WL_PRICES:
+        out[i] = gen_price(&state);
+        break;
+      case BENCH_WL_QUANTITIES:
+        out[i] = gen_quantity(&state);
+        break;
+      case BENCH_WL_FX_RATES:
+        out[i] = gen_fx_rate(&state);
+        break;
+      case BENCH_WL_NOTIONALS:
+        out[i] = gen_notional(&state);
+        break;
+      default:
+        out[i] = gen_ledger(&state, i ? &out[i - 1] : NULL);
+        break;
+    }
+  }
+  return 0;
+}
+
+static void put_u32(unsigned char *p, uint32_t v) {
+  for (int i = 0; i < 4; i++) p[i] = (unsigned char)(v >> (8 * i));
+}
+
+static void put_u64(unsigned char *p, uint64_t v) {
+  for (int i = 0; i < 8; i++) p[i] = (unsigned char)(v >> (8 * i));
+}
+
+static uint32_t get_u32(const unsigned char *p) {
+  uint32_t v = 0;
+  for (int i = 3; i >= 0; i--) v = (v << 8) | p[i];
+  return v;
+}
+
+static uint64_t get_u64(const unsigned char *p) {
+  uint64_t v = 0;
+  for (int i = 7; i >= 0; i--) v = (v << 8) | p[i];
+  return v;
+}
+
+int bench_workload_write(const char *path, bench_workload_kind kind,
+                         uint64_t seed, const s21_decimal *values, size_t n) {
+  if (!path || (!values && n)) return 1;
+
+  FILE *f = fopen(path, "wb");
+  if (!f) return 1;
+
+  unsigned char head[BENCH_WORKLOAD_HEADER_SIZE] = {0};
+  memcpy(head, workload_magic, 4);
+  put_u32(head + 4, BENCH_WORKLOAD_VERSION);
+  put_u32(head + 8, (uint32_t)kind);
+  put_u64(head + 16, seed);
+  put_u64(head + 24, (uint64_t)n);
+
+  int err = fwrite(head, sizeof(head), 1, f) != 1;
+  for (size_t i = 0; i < n && !err; i++) {
+    unsigned char rec[BENCH_WORKLOAD_RECORD_SIZE];
+    for (int w = 0; w < 4; w++)
+      put_u32(rec + 4 * w, (uint32_t)values[i].bits[w]);
+    err = fwrite(rec, sizeof(rec), 1, f) != 1;
+  }
+
+  if (fclose(f)) err = 1;
+  return err;
+}
+
+// Полных записей от текущей позиции до конца файла
+static uint64_t records_left(FILE *f) {
+  uint64_t left = 0;
+  long pos = ftell(f);
+
+  if (pos >= 0 && fseek(f, 0, SEEK_END) == 0) {
+    long end = ftell(f);
+    if (end >= pos)
+      left = (uint64_t)(end - pos) / BENCH_WORKLOAD_RECORD_SIZE;
+    if (fseek(f, pos, SEEK_SET) != 0) left = 0;
+  }
+  return left;
+}
+
+int bench_workload_read(const char *path, bench_workload_kind *kind,
+                        uint64_t *seed, s21_decimal **values, size_t *n) {
+  if (!path || !values || !n) return 1;
+
+  FILE *f = fopen(path, "rb");
+  if (!f) return 1;
+
+  unsigned char head[BENCH_WORKLOAD_HEADER_SIZE];
+  int err = fread(head, sizeof(head), 1, f) != 1 ||
+            memcmp(head, workload_magic, 4) != 0 ||
+            get_u32(head + 4) != BENCH_WORKLOAD_VERSION ||
+            get_u32(head + 8) >= BENCH_WL_COUNT;
+
+  uint64_t count = err ? 0 : get_u64(head + 24);
+  // счетчик из заголовка не больше записей в файле и помещается в size_t
+  if (!err && count)
+    err = count > SIZE_MAX / sizeof(s21_decimal) || count > records_left(f);
+
+  s21_decimal *buf = NULL;
+  if (!err && count) {
+    buf = malloc(sizeof(s21_decimal) * count);
+    err = buf == NULL;
+  }
+
+  for (uint64_t i = 0; i < count && !err; i++) {
+    unsigned char rec[BENCH_WORKLOAD_RECORD_SIZE];
+    err = fread(rec, sizeof(rec), 1, f) != 1;
+    for (int w = 0; w < 4 && !err; w++)
+      buf[i].bits[w] = (int)get_u32(rec + 4 * w);
+  }
+  fclose(f);
+
+  if (err) {
+    free(buf);
+  } else {
+    if (kind) *kind = (bench_workload_kind)get_u32(head + 8);
+    if (seed) *seed = get_u64(head + 16);
+    *values = buf;
+    *n = (size_t)count;
+  }
+  return err;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file bench_workload.h
+ * @brief Генератор реалистичных наборов decimal для бенчмарков
+ * @details Распределения повторяют типичные финансовые данные: цены с 2-8
+ *          знаками, количества, курсы валют с 10+ знаками, суммы сделок с
+ *          тяжелым хвостом и проводки с разными знаками. Наборы строятся
+ *          детерминированно по зерну и сохраняются в двоичный файл для
+ *          повторного прогона.
+ *
+ *          Формат файла (little-endian):
+ *            0  char[4]  "S21W"
+ *            4  uint32   версия (BENCH_WORKLOAD_VERSION)
+ *            8  uint32   вид набора (bench_workload_kind)
+ *            12 uint32   зарезервировано (0)
+ *            16 uint64   зерно генератора
+ *            24 uint64   количество записей
+ *            32 записи по 16 байт: bits[0], bits[1], bits[2], bits[3]
+ */
+
+#ifndef S21_BENCH_WORKLOAD_H
+#define S21_BENCH_WORKLOAD_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../s21_decimal.h"
+
+#define BENCH_WORKLOAD_VERSION 1u     // Версия формата файла
+#define BENCH_WORKLOAD_HEADER_SIZE 32 // Размер заголовка файла
+#define BENCH_WORKLOAD_RECORD_SIZE 16 // Размер одной записи
+
+// Виды наборов данных
+typedef enum {
+  BENCH_WL_PRICES = 0,  // цены: 0.01..10000, масштаб 2..8
+  BENCH_WL_QUANTITIES,  // количества: в основном целые, иногда дробные
+  BENCH_WL_FX_RATES,    // курсы валют: 0.0001..10000, масштаб 10..12
+  BENCH_WL_NOTIONALS,   // суммы сделок: распределение Парето, масштаб 2
+  BENCH_WL_LEDGER,      // проводки: разные знаки, сторно, масштаб 2
+  BENCH_WL_COUNT
+} bench_workload_kind;
+
+// Имя вида набора
+const char *bench_workload_name(bench_workload_kind kind);
+
+// Вид набора по имени, -1 если имя неизвестно
+int bench_workload_parse(const char *name);
+
+/**
+ * @brief Заполнить массив значениями заданного вида
+ * @param kind Вид набора
+ * @param seed Зерно генератора
+ * @param out Массив результата
+ * @param n Количество значений
+ * @return 0 - успех, 1 - неверные аргументы
+ */
+int bench_workload_generate(bench_workload_kind kind, uint64_t seed,
+                            s21_decimal *out, size_t n);
+
+/**
+ * @brief Записать набор в файл
+ * @return 0 - успех, 1 - неверные аргументы или ошибка записи
+ */
+int bench_workload_write(const char *path, bench_workload_kind kind,
+                         uint64_t seed, const s21_decimal *values, size_t n);
+
+/**
+ * @brief Прочитать набор из файла
+ * @details Массив *values выделяется через malloc, освобождает вызывающий
+ * @return 0 - успех, 1 - ошибка чтения или неверный формат
+ */
+int bench_workload_read(const char *path, bench_workload_kind *kind,
+                        uint64_t *seed, s21_decimal **values, size_t *n);
+
+#endif
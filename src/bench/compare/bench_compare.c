@@ -0,0 +1,418 @@
+/**
+ * @file bench_compare.c
+ * @brief Сравнение реализаций src/ и decimal-main/ на одинаковых данных
+ * @details Обе реализации линкуются в один исполняемый файл (символы
+ *          decimal-main переименованы через dm_prefix.h). Для каждой
+ *          операции и каждого класса входных данных измеряется время
+ *          обеих реализаций и сравниваются результаты:
+ *            code_diffs  - разные коды возврата;
+ *            value_diffs - разные значения результата;
+ *            repr_diffs  - одинаковые значения в разном представлении
+ *                          (например 1.0 и 1).
+ *
+ *          Использование:
+ *            bench_compare [--seed N] [--rounds N] [--format json|csv]
+ *                          [--filter подстрока] [--show N] [--strict]
+ *
+ *          С --strict код возврата равен 1, если найдено хотя бы одно
+ *          расхождение кодов или значений.
+ *
+ *          Известное расхождение: сравнения decimal-main (s21_is_less и
+ *          выражаемые через нее) зацикливаются в s21_to_common_scale,
+ *          если при выравнивании масштабов умножение на 10 дает четный
+ *          перенос. Для наборов с такими парами decimal-main не
+ *          запускается, а в результате указывается known_divergence.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../bench.h"
+#include "dm_api.h"
+
+#define COMPARE_DEFAULT_ROUNDS 5       // Замеров каждой реализации
+#define COMPARE_MIN_ROUND_NS 5000000ull  // Минимальная длительность замера
+#define CMP_DM_HANG "dm_common_scale_hang"  // decimal-main зацикливается
+
+// Вид результата операции
+typedef enum {
+  CMP_DECIMAL = 0,  // результат s21_decimal + код возврата
+  CMP_BOOL,         // результат сравнения (код возврата)
+  CMP_INT,          // результат int + код возврата
+  CMP_FLOAT         // результат float + код возврата
+} cmp_kind;
+
+// Результаты одной реализации на наборе
+typedef struct {
+  int code[BENCH_SET_SIZE];
+  s21_decimal dec[BENCH_SET_SIZE];
+  int i[BENCH_SET_SIZE];
+  float f[BENCH_SET_SIZE];
+} cmp_out;
+
+typedef void (*cmp_fn)(const bench_set *in, cmp_out *out);
+
+typedef struct {
+  const char *name;
+  cmp_kind kind;
+  cmp_fn src;  // реализация src/
+  cmp_fn dm;   // реализация decimal-main/
+  int common_scale;  // decimal-main выравнивает масштабы (может зависнуть)
+} cmp_op;
+
+typedef struct {
+  uint64_t seed;
+  int rounds;
+  int csv;
+  const char *filter;
+  int show;
+  int strict;
+} cmp_options;
+
+typedef struct {
+  double src_ns;
+  double dm_ns;
+  size_t code_diffs;
+  size_t value_diffs;
+  size_t repr_diffs;
+  size_t dm_hangs;  // пар, на которых decimal-main зацикливается
+} cmp_result;
+
+// Пара адаптеров для операции вида a op b -> s21_decimal
+#define CMP_BINARY(name, fn)                                        \
+  static void src_##name(const bench_set *in, cmp_out *out) {       \
+    for (size_t i = 0; i < BENCH_SET_SIZE; i++)                     \
+      out->code[i] = fn(in->a[i], in->b[i], &out->dec[i]);          \
+  }                                                                 \
+  static void dm_##name(const bench_set *in, cmp_out *out) {        \
+    for (size_t i = 0; i < BENCH_SET_SIZE; i++)                     \
+      out->code[i] = dm_##fn(in->a[i], in->b[i], &out->dec[i]);     \
+  }
+
+// Пара адаптеров для сравнения a op b -> int
+#define CMP_COMPARE(name, fn)                                       \
+  static void src_##name(const bench_set *in, cmp_out *out) {       \
+    for (size_t i = 0; i < BENCH_SET_SIZE; i++)                     \
+      out->code[i] = fn(in->a[i], in->b[i]);                        \
+  }                                                                 \
+  static void dm_##name(const bench_set *in, cmp_out *out) {        \
+    for (size_t i = 0; i < BENCH_SET_SIZE; i++)                     \
+      out->code[i] = dm_##fn(in->a[i], in->b[i]);                   \
+  }
+
+// Пара адаптеров для унарной операции from -> to
+#define CMP_UNARY(name, fn, from, to)                               \
+  static void src_##name(const bench_set *in, cmp_out *out) {       \
+    for (size_t i = 0; i < BENCH_SET_SIZE; i++)                     \
+      out->code[i] = fn(in->from[i], &out->to[i]);                  \
+  }                                                                 \
+  static void dm_##name(const bench_set *in, cmp_out *out) {        \
+    for (size_t i = 0; i < BENCH_SET_SIZE; i++)                     \
+      out->code[i] = dm_##fn(in->from[i], &out->to[i]);             \
+  }
+
+CMP_BINARY(add, s21_add)
+CMP_BINARY(sub, s21_sub)
+CMP_BINARY(mul, s21_mul)
+CMP_BINARY(div, s21_div)
+
+CMP_COMPARE(is_less, s21_is_less)
+CMP_COMPARE(is_less_or_equal, s21_is_less_or_equal)
+CMP_COMPARE(is_greater, s21_is_greater)
+CMP_COMPARE(is_greater_or_equal, s21_is_greater_or_equal)
+CMP_COMPARE(is_equal, s21_is_equal)
+CMP_COMPARE(is_not_equal, s21_is_not_equal)
+
+CMP_UNARY(floor, s21_floor, a, dec)
+CMP_UNARY(round, s21_round, a, dec)
+CMP_UNARY(truncate, s21_truncate, a, dec)
+CMP_UNARY(negate, s21_negate, a, dec)
+CMP_UNARY(from_int, s21_from_int_to_decimal, ints, dec)
+CMP_UNARY(from_float, s21_from_float_to_decimal, floats, dec)
+CMP_UNARY(to_int, s21_from_decimal_to_int, a, i)
+CMP_UNARY(to_float, s21_from_decimal_to_float, a, f)
+
+#define CMP_OP(fn, name, kind) {#fn, kind, src_##name, dm_##name, 0}
+#define CMP_OP_SCALED(fn, name, kind) {#fn, kind, src_##name, dm_##name, 1}
+
+static const cmp_op cmp_ops[] = {
+    CMP_OP(s21_add, add, CMP_DECIMAL),
+    CMP_OP(s21_sub, sub, CMP_DECIMAL),
+    CMP_OP(s21_mul, mul, CMP_DECIMAL),
+    CMP_OP(s21_div, div, CMP_DECIMAL),
+    CMP_OP_SCALED(s21_is_less, is_less, CMP_BOOL),
+    CMP_OP_SCALED(s21_is_less_or_equal, is_less_or_equal, CMP_BOOL),
+    CMP_OP_SCALED(s21_is_greater, is_greater, CMP_BOOL),
+    CMP_OP_SCALED(s21_is_greater_or_equal, is_greater_or_equal, CMP_BOOL),
+    CMP_OP(s21_is_equal, is_equal, CMP_BOOL),
+    CMP_OP(s21_is_not_equal, is_not_equal, CMP_BOOL),
+    CMP_OP(s21_floor, floor, CMP_DECIMAL),
+    CMP_OP(s21_round, round, CMP_DECIMAL),
+    CMP_OP(s21_truncate, truncate, CMP_DECIMAL),
+    CMP_OP(s21_negate, negate, CMP_DECIMAL),
+    CMP_OP(s21_from_int_to_decimal, from_int, CMP_DECIMAL),
+    CMP_OP(s21_from_float_to_decimal, from_float, CMP_DECIMAL),
+    CMP_OP(s21_from_decimal_to_int, to_int, CMP_INT),
+    CMP_OP(s21_from_decimal_to_float, to_float, CMP_FLOAT),
+};
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+// Время одной операции: повторяем набор, пока замер не станет достаточно
+// длинным
+static double time_round(cmp_fn fn, const bench_set *in, cmp_out *out) {
+  uint64_t total = 0;
+  size_t ops = 0;
+
+  while (total < COMPARE_MIN_ROUND_NS) {
+    uint64_t t0 = now_ns();
+    fn(in, out);
+    total += now_ns() - t0;
+    ops += BENCH_SET_SIZE;
+  }
+  return (double)total / (double)ops;
+}
+
+// Повторяет цикл s21_to_common_scale из decimal-main и возвращает 1, если
+// он не завершится: s21_scale_up_one возвращает carry & 1, поэтому при
+// четном переносе масштаб не меняется и число не округляется
+static int dm_common_scale_hangs(s21_decimal a, s21_decimal b) {
+  int hang = 0;
+
+  if (!dm_s21_is_zero(&a) || !dm_s21_is_zero(&b)) {
+    dm_s21_strip_trailing_zeros(&a);
+    dm_s21_strip_trailing_zeros(&b);
+    while (!hang && dm_s21_get_scale(&a) != dm_s21_get_scale(&b)) {
+      int a_low = dm_s21_get_scale(&a) < dm_s21_get_scale(&b);
+      s21_decimal *up = a_low ? &a : &b;
+      s21_decimal *down = a_low ? &b : &a;
+      int scale = dm_s21_get_scale(up);
+
+      if (dm_s21_scale_up_one(up))
+        dm_s21_scale_down_one_banker(down);
+      else if (dm_s21_get_scale(up) == scale)
+        hang = 1;
+    }
+  }
+  return hang;
+}
+
+static size_t count_dm_hangs(const bench_set *in) {
+  size_t n = 0;
+
+  for (size_t i = 0; i < BENCH_SET_SIZE; i++)
+    n += (size_t)dm_common_scale_hangs(in->a[i], in->b[i]);
+  return n;
+}
+
+static void print_decimal(const char *label, const s21_decimal *d) {
+  fprintf(stderr, " %s=%08x:%08x:%08x:%08x", label, (unsigned)d->bits[3],
+          (unsigned)d->bits[2], (unsigned)d->bits[1], (unsigned)d->bits[0]);
+}
+
+// Вывод примера расхождения в stderr
+static void show_diff(const cmp_op *op, const char *cls, const bench_set *in,
+                      size_t i, const cmp_out *s, const cmp_out *d) {
+  fprintf(stderr, "diff %s %s #%zu:", op->name, cls, i);
+  print_decimal("a", &in->a[i]);
+  print_decimal("b", &in->b[i]);
+  fprintf(stderr, " src_code=%d dm_code=%d", s->code[i], d->code[i]);
+  if (op->kind == CMP_DECIMAL) {
+    print_decimal("src", &s->dec[i]);
+    print_decimal("dm", &d->dec[i]);
+  } else if (op->kind == CMP_INT) {
+    fprintf(stderr, " src=%d dm=%d", s->i[i], d->i[i]);
+  } else if (op->kind == CMP_FLOAT) {
+    fprintf(stderr, " src=%.9g dm=%.9g", (double)s->f[i], (double)d->f[i]);
+  }
+  fputc('\n', stderr);
+}
+
+// Поэлементное сравнение результатов двух реализаций
+static void diff_outputs(const cmp_op *op, const char *cls,
+                         const bench_set *in, const cmp_out *s,
+                         const cmp_out *d, int show, cmp_result *res) {
+  int shown = 0;
+
+  for (size_t i = 0; i < BENCH_SET_SIZE; i++) {
+    int value = 0;
+    int repr = 0;
+
+    if (op->kind == CMP_BOOL) {
+      value = s->code[i] != d->code[i];
+    } else if (s->code[i] != d->code[i]) {
+      res->code_diffs++;
+      value = -1;
+    } else if (s->code[i] == 0 && op->kind == CMP_DECIMAL) {
+      if (memcmp(&s->dec[i], &d->dec[i], sizeof(s21_decimal)) != 0) {
+        if (s21_is_equal(s->dec[i], d->dec[i]))
+          repr = 1;
+        else
+          value = 1;
+      }
+    } else if (s->code[i] == 0 && op->kind == CMP_INT) {
+      value = s->i[i] != d->i[i];
+    } else if (s->code[i] == 0 && op->kind == CMP_FLOAT) {
+      value = memcmp(&s->f[i], &d->f[i], sizeof(float)) != 0 &&
+              !(s->f[i] != s->f[i] && d->f[i] != d->f[i]);
+    }
+
+    if (value > 0) res->value_diffs++;
+    if (repr) res->repr_diffs++;
+    if ((value || repr) && shown < show) {
+      show_diff(op, cls, in, i, s, d);
+      shown++;
+    }
+  }
+}
+
+static void compare_op(const cmp_op *op, const bench_set *in, const char *cls,
+                       const cmp_options *opt, cmp_out *s, cmp_out *d,
+                       cmp_result *res) {
+  memset(res, 0, sizeof(*res));
+  res->src_ns = 1e300;
+  res->dm_ns = 1e300;
+  if (op->common_scale) res->dm_hangs = count_dm_hangs(in);
+
+  // Замеры чередуются, берется лучший из каждой реализации. Если
+  // decimal-main на наборе зацикливается, измеряется только src/
+  for (int r = 0; r < opt->rounds; r++) {
+    double ts = time_round(op->src, in, s);
+    if (ts < res->src_ns) res->src_ns = ts;
+    if (!res->dm_hangs) {
+      double td = time_round(op->dm, in, d);
+      if (td < res->dm_ns) res->dm_ns = td;
+    }
+  }
+
+  memset(s, 0, sizeof(*s));
+  memset(d, 0, sizeof(*d));
+  op->src(in, s);
+  if (!res->dm_hangs) {
+    op->dm(in, d);
+    diff_outputs(op, cls, in, s, d, opt->show, res);
+  } else {
+    fprintf(stderr,
+            "skip decimal-main %s %s: %zu pairs hang in "
+            "s21_to_common_scale\n",
+            op->name, cls, res->dm_hangs);
+  }
+}
+
+static void print_result(const cmp_options *opt, const char *op,
+                         const char *cls, const cmp_result *r) {
+  double ratio = r->dm_ns / r->src_ns;
+  const char *known = r->dm_hangs ? CMP_DM_HANG : "";
+
+  if (opt->csv && r->dm_hangs) {
+    printf("%s,%s,%d,%.3f,,,,,,%s\n", op, cls, BENCH_SET_SIZE, r->src_ns,
+           known);
+  } else if (opt->csv) {
+    printf("%s,%s,%d,%.3f,%.3f,%.3f,%zu,%zu,%zu,\n", op, cls, BENCH_SET_SIZE,
+           r->src_ns, r->dm_ns, ratio, r->code_diffs, r->value_diffs,
+           r->repr_diffs);
+  } else if (r->dm_hangs) {
+    printf(
+        "{\"op\":\"%s\",\"class\":\"%s\",\"n\":%d,\"src_ns\":%.3f,"
+        "\"dm_ns\":null,\"dm_over_src\":null,\"code_diffs\":null,"
+        "\"value_diffs\":null,\"repr_diffs\":null,"
+        "\"known_divergence\":\"%s\",\"dm_hang_pairs\":%zu}\n",
+        op, cls, BENCH_SET_SIZE, r->src_ns, known, r->dm_hangs);
+  } else {
+    printf(
+        "{\"op\":\"%s\",\"class\":\"%s\",\"n\":%d,\"src_ns\":%.3f,"
+        "\"dm_ns\":%.3f,\"dm_over_src\":%.3f,\"code_diffs\":%zu,"
+        "\"value_diffs\":%zu,\"repr_diffs\":%zu}\n",
+        op, cls, BENCH_SET_SIZE, r->src_ns, r->dm_ns, ratio, r->code_diffs,
+        r->value_diffs, r->repr_diffs);
+  }
+}
+
+static int parse_options(int argc, char **argv, cmp_options *opt) {
+  int err = 0;
+
+  for (int i = 1; i < argc && !err; i++) {
+    const char *arg = argv[i];
+    const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+    if (!strcmp(arg, "--strict")) {
+      opt->strict = 1;
+      continue;
+    }
+
+    if (!val) {
+      err = 1;
+    } else if (!strcmp(arg, "--seed")) {
+      opt->seed = strtoull(val, NULL, 0);
+    } else if (!strcmp(arg, "--rounds")) {
+      opt->rounds = atoi(val);
+    } else if (!strcmp(arg, "--format")) {
+      opt->csv = !strcmp(val, "csv");
+    } else if (!strcmp(arg, "--filter")) {
+      opt->filter = val;
+    } else if (!strcmp(arg, "--show")) {
+      opt->show = atoi(val);
+    } else {
+      err = 1;
+    }
+    i++;
+  }
+
+  if (opt->rounds <= 0) err = 1;
+  return err;
+}
+
+int main(int argc, char **argv) {
+  cmp_options opt = {0x5EED5EEDull, COMPARE_DEFAULT_ROUNDS, 0, NULL, 0, 0};
+  size_t mismatches = 0;
+
+  if (parse_options(argc, argv, &opt)) {
+    fprintf(stderr,
+            "usage: %s [--seed N] [--rounds N] [--format json|csv] "
+            "[--filter name] [--show N] [--strict]\n",
+            argv[0]);
+    return 1;
+  }
+
+  bench_set *sets = malloc(sizeof(bench_set) * BENCH_CLASS_COUNT);
+  cmp_out *outs = malloc(sizeof(cmp_out) * 2);
+  if (!sets || !outs) {
+    free(sets);
+    free(outs);
+    return 1;
+  }
+
+  for (int c = 0; c < BENCH_CLASS_COUNT; c++)
+    bench_fill(&sets[c], (bench_class)c, opt.seed);
+
+  if (opt.csv)
+    printf(
+        "op,class,n,src_ns,dm_ns,dm_over_src,code_diffs,value_diffs,"
+        "repr_diffs,known_divergence\n");
+
+  for (size_t i = 0; i < sizeof(cmp_ops) / sizeof(cmp_ops[0]); i++) {
+    const cmp_op *op = &cmp_ops[i];
+    if (opt.filter && !strstr(op->name, opt.filter)) continue;
+
+    for (int c = 0; c < BENCH_CLASS_COUNT; c++) {
+      const char *cls = bench_class_name((bench_class)c);
+      cmp_result res;
+      compare_op(op, &sets[c], cls, &opt, &outs[0], &outs[1], &res);
+      print_result(&opt, op->name, cls, &res);
+      fflush(stdout);
+      mismatches += res.code_diffs + res.value_diffs;
+    }
+  }
+
+  free(sets);
+  free(outs);
+  return (opt.strict && mismatches) ? 1 : 0;
+}
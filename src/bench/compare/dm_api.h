@@ -0,0 +1,43 @@
+/**
+ * @file dm_api.h
+ * @brief Публичные функции decimal-main под префиксом dm_
+ * @details Тип s21_decimal в обеих реализациях имеет одинаковое
+ *          представление (int bits[4]), поэтому значения передаются
+ *          между ними без преобразований
+ */
+
+#ifndef S21_DM_API_H
+#define S21_DM_API_H
+
+#include "../../s21_decimal.h"
+
+int dm_s21_add(s21_decimal value_1, s21_decimal value_2, s21_decimal *result);
+int dm_s21_sub(s21_decimal value_1, s21_decimal value_2, s21_decimal *result);
+int dm_s21_mul(s21_decimal value_1, s21_decimal value_2, s21_decimal *result);
+int dm_s21_div(s21_decimal value_1, s21_decimal value_2, s21_decimal *result);
+
+int dm_s21_is_less(s21_decimal value1, s21_decimal value2);
+int dm_s21_is_less_or_equal(s21_decimal value1, s21_decimal value2);
+int dm_s21_is_greater(s21_decimal value1, s21_decimal value2);
+int dm_s21_is_greater_or_equal(s21_decimal value1, s21_decimal value2);
+int dm_s21_is_equal(s21_decimal value1, s21_decimal value2);
+int dm_s21_is_not_equal(s21_decimal value1, s21_decimal value2);
+
+int dm_s21_from_int_to_decimal(int src, s21_decimal *dst);
+int dm_s21_from_float_to_decimal(float src, s21_decimal *dst);
+int dm_s21_from_decimal_to_int(s21_decimal src, int *dst);
+int dm_s21_from_decimal_to_float(s21_decimal src, float *dst);
+
+int dm_s21_floor(s21_decimal value, s21_decimal *result);
+int dm_s21_round(s21_decimal value, s21_decimal *result);
+int dm_s21_truncate(s21_decimal value, s21_decimal *result);
+int dm_s21_negate(s21_decimal value, s21_decimal *result);
+
+// Служебные функции, через которые повторяется приведение к общему масштабу
+int dm_s21_get_scale(const s21_decimal *d);
+int dm_s21_is_zero(const s21_decimal *d);
+void dm_s21_strip_trailing_zeros(s21_decimal *d);
+void dm_s21_scale_down_one_banker(s21_decimal *d);
+int dm_s21_scale_up_one(s21_decimal *d);
+
+#endif
@@ -0,0 +1,50 @@
+/**
+ * @file dm_prefix.h
+ * @brief Переименование внешних символов реализации decimal-main
+ * @details Подключается через -include при компиляции исходников
+ *          decimal-main, чтобы обе реализации можно было слинковать в
+ *          один исполняемый файл: s21_add -> dm_s21_add и т.д.
+ */
+
+#ifndef S21_DM_PREFIX_H
+#define S21_DM_PREFIX_H
+
+#define s21_add dm_s21_add
+#define s21_sub dm_s21_sub
+#define s21_mul dm_s21_mul
+#define s21_div dm_s21_div
+#define s21_is_less dm_s21_is_less
+#define s21_is_less_or_equal dm_s21_is_less_or_equal
+#define s21_is_greater dm_s21_is_greater
+#define s21_is_greater_or_equal dm_s21_is_greater_or_equal
+#define s21_is_equal dm_s21_is_equal
+#define s21_is_not_equal dm_s21_is_not_equal
+#define s21_from_int_to_decimal dm_s21_from_int_to_decimal
+#define s21_from_float_to_decimal dm_s21_from_float_to_decimal
+#define s21_from_decimal_to_int dm_s21_from_decimal_to_int
+#define s21_from_decimal_to_float dm_s21_from_decimal_to_float
+#define s21_floor dm_s21_floor
+#define s21_round dm_s21_round
+#define s21_truncate dm_s21_truncate
+#define s21_negate dm_s21_negate
+#define s21_get_scale dm_s21_get_scale
+#define s21_set_scale dm_s21_set_scale
+#define s21_get_sign dm_s21_get_sign
+#define s21_set_sign dm_s21_set_sign
+#define s21_reset_value dm_s21_reset_value
+#define s21_is_zero dm_s21_is_zero
+#define s21_strip_trailing_zeros dm_s21_strip_trailing_zeros
+#define s21_to_common_scale dm_s21_to_common_scale
+#define s21_scale_down_one_banker dm_s21_scale_down_one_banker
+#define s21_scale_up_one dm_s21_scale_up_one
+#define u96_from_dec dm_u96_from_dec
+#define u96_to_dec dm_u96_to_dec
+#define u96_is_zero dm_u96_is_zero
+#define u96_cmp dm_u96_cmp
+#define u96_add dm_u96_add
+#define u96_sub dm_u96_sub
+#define u96_mul10 dm_u96_mul10
+#define u96_div10 dm_u96_div10
+#define u96_copy dm_u96_copy
+
+#endif
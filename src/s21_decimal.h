@@ -6,6 +6,10 @@
 #include <stdint.h>    // Типы фиксированной ширины (uint32_t, etc.)
 #include <stdlib.h>    // Стандартные функции (malloc, free, etc.)
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 typedef struct {
   int bits[4];  // Массив из 4-х 32-битных слов для хранения decimal
 } s21_decimal;
@@ -15,7 +19,218 @@ typedef struct {
 #define S21_SCALE_MASK 0x00FF0000u  // Маска для масштаба (биты 16-23)
 #define S21_SCALE_SHIFT 16          // Сдвиг для масштаба из bits[3]
 #define S21_SCALE_MAX 28            // Максимальный масштаб
+#define S21_POW10_F64_MAX 22        // Максимальная точная степень 10 в double
+#define S21_UN_MAX_LIMBS 16         // Максимум разрядов для uN_divmod
+
+// Инициализатор decimal из слов мантиссы, масштаба и знака - константное
+// выражение, годится для static переменных без вызова функций
+#define S21_DECIMAL_INIT(lo, mid, hi, scale, negative)                    \
+  {{(int)(uint32_t)(lo), (int)(uint32_t)(mid), (int)(uint32_t)(hi),       \
+    (int)(((negative) ? S21_SIGN_MASK : 0u) |                             \
+          ((uint32_t)(scale) << S21_SCALE_SHIFT))}}
+
+// Масштабированное целое до 64 бит (scale 0..28):
+// static const s21_decimal price = S21_DECIMAL_LITERAL(1999, 2);  // 19.99
+#define S21_DECIMAL_LITERAL(units, scale)                                 \
+  S21_DECIMAL_INIT(S21_DECIMAL_ABS64_(units),                             \
+                   S21_DECIMAL_ABS64_(units) >> 32, 0u, scale, (units) < 0)
+#define S21_DECIMAL_ABS64_(v) ((v) < 0 ? 0u - (uint64_t)(v) : (uint64_t)(v))
+
+// restrict для внутренних функций над заведомо разными массивами
+#ifdef __cplusplus
+#define S21_RESTRICT __restrict
+#else
+#define S21_RESTRICT restrict
+#endif
+
+// режимы округления
+typedef enum {
+  S21_ROUND_HALF_EVEN = 0,  // к ближайшему, половина к четному (банковское)
+  S21_ROUND_HALF_UP,        // к ближайшему, половина от нуля
+  S21_ROUND_HALF_DOWN,      // к ближайшему, половина к нулю
+  S21_ROUND_DOWN,           // к нулю (отбрасывание)
+  S21_ROUND_FLOOR,          // к минус бесконечности
+  S21_ROUND_CEILING,        // к плюс бесконечности
+  S21_ROUND_UP              // от нуля
+} s21_rounding_mode;
+
+// флаги состояния контекста (накапливаются до явного сброса)
+#define S21_FLAG_INEXACT 0x01u      // результат отличается от точного
+#define S21_FLAG_ROUNDED 0x02u      // отброшены разряды (возможно нулевые)
+#define S21_FLAG_OVERFLOW 0x04u     // результат не помещается в decimal
+#define S21_FLAG_DIV_BY_ZERO 0x08u  // деление на ноль
+
+// контекст вычислений, по умолчанию свой у каждого потока
+typedef struct {
+  s21_rounding_mode round;  // режим округления до max_scale
+  int max_scale;            // максимальный масштаб результата (0..28)
+  unsigned flags;           // накопленные флаги S21_FLAG_*
+} s21_context;
+
+// число с 256 бит мантиссой для точных промежуточных результатов
+// (накопители, скалярные произведения): 77 значащих цифр, масштаб 0..76
+#define S21_DECIMAL256_LIMBS 8
+#define S21_DECIMAL256_SCALE_MAX 76
+
+typedef struct {
+  uint32_t bits[S21_DECIMAL256_LIMBS];  // мантисса, младший разряд первым
+  int scale;                            // 0..S21_DECIMAL256_SCALE_MAX
+  int sign;                             // 1 - отрицательное
+} s21_decimal256;
+
+// IEEE 754-2008 decimal128: 34 цифры, порядок -6176..6111 (w[0] - младшие
+// 64 бита, порядок байт платформы)
+#define S21_DECIMAL128_BIAS 6176
+
+typedef struct {
+  uint64_t w[2];
+} s21_decimal128;
+
+// кодировка мантиссы decimal128
+typedef enum {
+  S21_DECIMAL128_BID = 0,  // двоичное целое (Intel, большинство СУБД)
+  S21_DECIMAL128_DPD       // densely packed decimal (IBM)
+} s21_decimal128_encoding;
+
+// Apache Arrow C Data Interface (ABI из спецификации Arrow, без
+// зависимости от библиотеки Arrow)
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+  // описание типа
+  const char *format;
+  const char *name;
+  const char *metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema **children;
+  struct ArrowSchema *dictionary;
+
+  // освобождение (вызывает потребитель)
+  void (*release)(struct ArrowSchema *);
+  // данные производителя
+  void *private_data;
+};
+
+struct ArrowArray {
+  // описание данных
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void **buffers;
+  struct ArrowArray **children;
+  struct ArrowArray *dictionary;
+
+  // освобождение (вызывает потребитель)
+  void (*release)(struct ArrowArray *);
+  // данные производителя
+  void *private_data;
+};
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+#define S21_ARROW_PRECISION 38  // цифр в Arrow decimal128
+
+// PostgreSQL NUMERIC: знак в двоичном формате и наибольший размер значения
+// из децималь (заголовок 8 байт и до 8 цифр по основанию 10000)
+#define S21_PG_NUMERIC_POS 0x0000
+#define S21_PG_NUMERIC_NEG 0x4000
+#define S21_PG_NUMERIC_MAX_SIZE 24
+
+// наибольший размер записи s21_encode_varint (заголовок и 14 байт LEB128)
+#define S21_VARINT_MAX_SIZE 15
+
+// размеры блока сжатия столбца s21_bitpack_*
+#define S21_BITPACK_BLOCK_SMALL 128
+#define S21_BITPACK_BLOCK_LARGE 1024
+
+// компактное число 8 байт для значений до 16 цифр: мантисса 56 бит
+// (биты 0-55), масштаб 0..28 (биты 56-60), знак (бит 63)
+#define S21_DECIMAL64_COEF_MAX ((UINT64_C(1) << 56) - 1u)
+#define S21_DECIMAL64_SCALE_SHIFT 56
+#define S21_DECIMAL64_SCALE_MASK (UINT64_C(0x1F) << S21_DECIMAL64_SCALE_SHIFT)
+#define S21_DECIMAL64_SIGN_MASK (UINT64_C(1) << 63)
+// код операций s21_decimal64: результат не помещается в 56 бит и записан
+// в s21_decimal
+#define S21_DECIMAL64_PROMOTED 4
+
+typedef struct {
+  uint64_t bits;
+} s21_decimal64;
 
+// число произвольной длины для редких результатов больше 256 бит: разряды
+// берутся из пула потока (S21_BIGDECIMAL_POOL_LIMBS по 32 бита), malloc нет
+#define S21_BIGDECIMAL_POOL_LIMBS 8192
+#define S21_BIGDECIMAL_SCALE_MAX 65535
+
+typedef struct {
+  uint32_t *limbs;  // мантисса в пуле потока, младший разряд первым
+  int len;          // значащих разрядов (0 - ноль)
+  int cap;          // выделено разрядов
+  int scale;        // 0..S21_BIGDECIMAL_SCALE_MAX
+  int sign;         // 1 - отрицательное
+} s21_bigdecimal;
+
+// формула над столбцами decimal ("qty * price * (1 - disc) + fee"),
+// скомпилированная в регистровый байткод (s21_formula_compile)
+#define S21_FORMULA_MAX_CODE 64    // инструкций
+#define S21_FORMULA_MAX_VARS 16    // переменных (столбцов)
+#define S21_FORMULA_MAX_CONSTS 16  // констант
+#define S21_FORMULA_MAX_REGS 8     // рабочих регистров (глубина выражения)
+#define S21_FORMULA_NAME_MAX 16    // длина имени переменной с '\0'
+#define S21_FORMULA_BLOCK 32       // строк в одном проходе по столбцам
+
+// операнд инструкции: вид в старших битах, номер в младших
+#define S21_FORMULA_ARG_REG 0x00u
+#define S21_FORMULA_ARG_VAR 0x40u
+#define S21_FORMULA_ARG_CONST 0x80u
+#define S21_FORMULA_ARG_KIND 0xC0u
+#define S21_FORMULA_ARG_INDEX 0x3Fu
+
+// коды операций
+typedef enum {
+  S21_FORMULA_ADD = 0,  // dst = a + b
+  S21_FORMULA_SUB,      // dst = a - b
+  S21_FORMULA_MUL,      // dst = a * b
+  S21_FORMULA_DIV,      // dst = a / b
+  S21_FORMULA_NEG,      // dst = -a
+  S21_FORMULA_MOV       // dst = a (результат - переменная или константа)
+} s21_formula_op;
+
+typedef struct {
+  unsigned char op;   // s21_formula_op
+  unsigned char dst;  // регистр результата
+  unsigned char a;    // операнды S21_FORMULA_ARG_* | номер
+  unsigned char b;
+} s21_formula_insn;
+
+typedef struct {
+  s21_formula_insn code[S21_FORMULA_MAX_CODE];
+  int n_code;
+  s21_decimal consts[S21_FORMULA_MAX_CONSTS];
+  int n_consts;
+  char vars[S21_FORMULA_MAX_VARS][S21_FORMULA_NAME_MAX];  // в порядке появления
+  int n_vars;
+  int n_regs;  // использовано регистров, результат в регистре 0
+} s21_formula;
+
+// таблица степеней десяти 10^0..10^28 в формате 96 бит
+extern const uint32_t s21_pow10_u96[S21_SCALE_MAX + 1][3];
+
+// таблица точных степеней десяти 10^0..10^22 в double
+extern const double s21_pow10_f64[S21_POW10_F64_MAX + 1];
+
+#ifdef S21_HEADER_ONLY
+// масштаб, знак и операции над 96 битами - static inline
+#include "s21_decimal_inline.h"
+#else
 // Получить масштаб decimal числа
 int s21_get_scale(const s21_decimal *d);
 
@@ -27,6 +242,7 @@ int s21_get_sign(const s21_decimal *d);
 
 // Установить знак decimal числа
 void s21_set_sign(s21_decimal *d, int neg);
+#endif
 
 
 
@@ -52,6 +268,7 @@ int s21_scale_up_one(s21_decimal *d);
 
 
 
+#ifndef S21_HEADER_ONLY
 // получить мантиссу из децималь
 void u96_from_dec(const s21_decimal *d, uint32_t a[3]);
 
@@ -78,6 +295,52 @@ uint32_t u96_div10(uint32_t a[3]);
 
 // комировать куда откуда 96 бит
 void u96_copy(uint32_t dst[3], const uint32_t src[3]);
+#endif
+
+// количество значащих бит 96 бит числа
+int u96_bit_length(const uint32_t a[3]);
+
+// количество значащих разрядов многоразрядного числа
+int uN_len(const uint32_t* a, int n);
+
+// операции над многоразрядными числами из n 32 бит разрядов (младший первым)
+uint32_t uN_div10(uint32_t* a, int n);                          // ретюрн остаток
+uint32_t uN_add_small(uint32_t* a, int n, uint32_t add);        // ретюрн перенос
+uint32_t uN_mul_small(uint32_t* a, int n, uint32_t m);          // ретюрн перенос
+uint32_t uN_add(uint32_t* a, const uint32_t* b, int n);         // a += b, перенос
+uint32_t uN_sub(uint32_t* a, const uint32_t* b, int n);         // a -= b, заем
+int uN_compare(const uint32_t* a, const uint32_t* b, int n);    // -1, 0, 1
+int uN_mul_pow10(uint32_t* a, int n, int k);                    // 1 - переполнение
+
+// отбросить цифры до fit разрядов и масштаба <= max_scale с одним
+// банковским округлением (1 - не помещается при масштабе 0)
+int uN_reduce(uint32_t* a, int n, int fit, int* scale, int max_scale);
+
+// то же с одним округлением в режиме mode, negative - знак числа,
+// sticky - ненулевые цифры, отброшенные до вызова
+int uN_reduce_mode(uint32_t* a, int n, int fit, int* scale, int max_scale, int negative, int sticky, s21_rounding_mode mode);
+
+// мантисса c (до 128 бит, буфер из 8 разрядов) * 10^q в decimal с одним
+// банковским округлением (1 - не помещается)
+int s21_coef_to_decimal(uint32_t c[8], int q, int sign, s21_decimal *dst);
+
+// разделить 96 бит на 10^k за один шаг (a - частное, rem - остаток)
+void u96_divmod_pow10(uint32_t a[3], int k, uint32_t rem[3]);
+
+// умножить 96 бит на 10^k (1 - переполнение)
+int u96_mul_pow10(uint32_t a[3], int k);
+
+// нужно ли увеличить частное q на 1 после деления на 10^k с остатком rem
+int s21_round_increment(const uint32_t q[3], const uint32_t rem[3], int k, int negative, s21_rounding_mode mode);
+
+// деление многоразрядных чисел u / v - частное q и остаток r (m >= n)
+void uN_divmod(const uint32_t* u, int m, const uint32_t* v, int n, uint32_t* q, uint32_t* r);
+
+// decimal в двоичную мантиссу из bits бит и порядок, с корректным округлением
+void s21_decimal_to_binary(const s21_decimal* d, int bits, uint64_t* mant, int* exp2);
+
+// сложение (negate_2 = 0) или вычитание (negate_2 = 1) по указателям
+int s21_add_sub_p(const s21_decimal *value_1, const s21_decimal *value_2, int negate_2, s21_decimal *result);
 
 
 
@@ -94,6 +357,81 @@ int s21_mul(s21_decimal value_1, s21_decimal value_2, s21_decimal *result);
 // деление
 int s21_div(s21_decimal value_1, s21_decimal value_2, s21_decimal *result);
 
+// те же операции по указателям (без копий структур), коды ошибок те же;
+// result может совпадать с любым из операндов
+int s21_add_p(const s21_decimal *value_1, const s21_decimal *value_2, s21_decimal *result);
+int s21_sub_p(const s21_decimal *value_1, const s21_decimal *value_2, s21_decimal *result);
+int s21_mul_p(const s21_decimal *value_1, const s21_decimal *value_2, s21_decimal *result);
+int s21_div_p(const s21_decimal *value_1, const s21_decimal *value_2, s21_decimal *result);
+
+// на месте: *acc = *acc op *value (value может совпадать с acc),
+// при ошибке *acc не меняется
+int s21_add_assign(s21_decimal *acc, const s21_decimal *value);
+int s21_sub_assign(s21_decimal *acc, const s21_decimal *value);
+int s21_mul_assign(s21_decimal *acc, const s21_decimal *value);
+int s21_div_assign(s21_decimal *acc, const s21_decimal *value);
+
+
+
+
+// контекст текущего потока (HALF_EVEN, масштаб 28, без флагов при старте)
+s21_context *s21_context_get(void);
+
+// заполнить контекст значениями по умолчанию
+void s21_context_init(s21_context *ctx);
+
+// добавить флаги в контекст текущего потока
+void s21_context_raise(unsigned flags);
+
+// операции с контекстом (NULL - контекст потока): ошибки отмечаются
+// флагами, результат округляется один раз в режиме round до 96 бит и
+// масштаба max_scale (деление тоже округляет, а не отбрасывает цифры)
+int s21_add_ctx(s21_decimal value_1, s21_decimal value_2, s21_decimal *result, s21_context *ctx);
+int s21_sub_ctx(s21_decimal value_1, s21_decimal value_2, s21_decimal *result, s21_context *ctx);
+int s21_mul_ctx(s21_decimal value_1, s21_decimal value_2, s21_decimal *result, s21_context *ctx);
+int s21_div_ctx(s21_decimal value_1, s21_decimal value_2, s21_decimal *result, s21_context *ctx);
+
+// пакетные операции out[i] = a[i] op b[i], возвращают флаги этого вызова,
+// ошибочные элементы получают 0, out может совпадать с a или b
+unsigned s21_add_batch(const s21_decimal *a, const s21_decimal *b, s21_decimal *out, size_t n, s21_context *ctx);
+unsigned s21_sub_batch(const s21_decimal *a, const s21_decimal *b, s21_decimal *out, size_t n, s21_context *ctx);
+unsigned s21_mul_batch(const s21_decimal *a, const s21_decimal *b, s21_decimal *out, size_t n, s21_context *ctx);
+unsigned s21_div_batch(const s21_decimal *a, const s21_decimal *b, s21_decimal *out, size_t n, s21_context *ctx);
+
+// счетчики медленных путей арифметики текущего потока
+// (считаются только в сборке с -DS21_STATS, иначе всегда 0)
+typedef struct {
+  uint64_t add_calls;           // вызовы s21_add (и s21_sub)
+  uint64_t add_align_round;     // align_scales: округление большего масштаба
+  uint64_t add_carry_loop;      // итерации do/while при переносе в s21_add
+  uint64_t mul_calls;           // вызовы s21_mul
+  uint64_t mul_round_div10;     // отброшенные цифры произведения в s21_mul
+  uint64_t div_calls;           // вызовы s21_div
+  uint64_t div_overflow_round;  // срабатывания handle_div_overflow_and_round
+  uint64_t div_digits;          // дробные цифры, сгенерированные s21_div
+} s21_stats;
+
+// 1 если библиотека собрана со счетчиками
+int s21_stats_enabled(void);
+
+// копия счетчиков текущего потока
+void s21_stats_snapshot(s21_stats *out);
+
+// обнулить счетчики текущего потока
+void s21_stats_reset(void);
+
+#ifdef S21_STATS
+#ifdef __cplusplus
+extern thread_local s21_stats s21_thread_stats;
+#else
+extern _Thread_local s21_stats s21_thread_stats;
+#endif
+#define S21_STAT_ADD(field, n) (s21_thread_stats.field += (uint64_t)(n))
+#else
+#define S21_STAT_ADD(field, n) ((void)(n))
+#endif
+#define S21_STAT_INC(field) S21_STAT_ADD(field, 1)
+
 
 
 
@@ -130,6 +468,158 @@ int s21_from_decimal_to_int(s21_decimal src, int *dst);
 // децималь в флоат 0 - успех
 int s21_from_decimal_to_float(s21_decimal src, float *dst);
 
+// децималь в дабл 0 - успех
+int s21_from_decimal_to_double(s21_decimal src, double *dst);
+
+// int64 в децималь 0 - успех
+int s21_from_int64_to_decimal(int64_t src, s21_decimal *dst);
+
+// uint64 в децималь 0 - успех
+int s21_from_uint64_to_decimal(uint64_t src, s21_decimal *dst);
+
+// масштабированное int64 в децималь (1999 при scale 2 -> 19.99) 0 - успех
+int s21_from_scaled_int64_to_decimal(int64_t src, int scale, s21_decimal *dst);
+
+// децималь в int64 (дробная часть отбрасывается) 0 - успех
+int s21_from_decimal_to_int64(s21_decimal src, int64_t *dst);
+
+// децималь в uint64 (дробная часть отбрасывается) 0 - успех
+int s21_from_decimal_to_uint64(s21_decimal src, uint64_t *dst);
+
+// децималь в масштабированное int64 (банковское округление) 0 - успех
+int s21_from_decimal_to_scaled_int64(s21_decimal src, int scale, int64_t *dst);
+
+// пакетные версии - 0 если все элементы сконвертированы, ошибочные получают 0
+int s21_from_int64_to_decimal_batch(const int64_t *src, s21_decimal *dst, size_t n);
+int s21_from_uint64_to_decimal_batch(const uint64_t *src, s21_decimal *dst, size_t n);
+int s21_from_scaled_int64_to_decimal_batch(const int64_t *src, int scale, s21_decimal *dst, size_t n);
+int s21_from_decimal_to_int64_batch(const s21_decimal *src, int64_t *dst, size_t n);
+int s21_from_decimal_to_uint64_batch(const s21_decimal *src, uint64_t *dst, size_t n);
+int s21_from_decimal_to_scaled_int64_batch(const s21_decimal *src, int scale, int64_t *dst, size_t n);
+
+#ifdef __SIZEOF_INT128__
+// __int128 в децималь (не больше 96 бит) 0 - успех
+int s21_from_int128_to_decimal(__int128 src, s21_decimal *dst);
+
+// децималь в __int128 (дробная часть отбрасывается) 0 - успех
+int s21_from_decimal_to_int128(s21_decimal src, __int128 *dst);
+
+int s21_from_int128_to_decimal_batch(const __int128 *src, s21_decimal *dst, size_t n);
+int s21_from_decimal_to_int128_batch(const s21_decimal *src, __int128 *dst, size_t n);
+#endif
+
+// децималь в текст [-]цифры[.цифры] в [first, last), масштаб сохраняется
+// 0 - успех, 1 - не хватает места (*end - конец записанного, без '\0')
+int s21_to_chars(const s21_decimal *src, char *first, char *last, char **end);
+
+// текст [+-]цифры[.цифры] в децималь, лишние дробные цифры округляются
+// к четному. 0 - успех, 1 - нет цифр, 2 - не помещается (*end - конец)
+int s21_from_chars(const char *first, const char *last, s21_decimal *dst, const char **end);
+
+// массив децималь в массив флоат 0 - успех
+int s21_from_decimal_to_float_batch(const s21_decimal *src, float *dst, size_t n);
+
+// массив децималь в массив дабл 0 - успех
+int s21_from_decimal_to_double_batch(const s21_decimal *src, double *dst, size_t n);
+
+// decimal128 в децималь: лишние цифры (больше 96 бит или масштаба 28)
+// округляются к четному, неканоническая мантисса BID - ноль.
+// 0 - успех, 1 - NaN, бесконечность или не помещается
+int s21_from_decimal128_to_decimal(s21_decimal128 src, s21_decimal128_encoding encoding, s21_decimal *dst);
+
+// децималь в decimal128 (всегда точно) 0 - успех
+int s21_from_decimal_to_decimal128(const s21_decimal *src, s21_decimal128_encoding encoding, s21_decimal128 *dst);
+
+// пакетные версии - 0 если все элементы сконвертированы, ошибочные получают 0
+int s21_from_decimal128_to_decimal_batch(const s21_decimal128 *src, s21_decimal128_encoding encoding, s21_decimal *dst, size_t n);
+int s21_from_decimal_to_decimal128_batch(const s21_decimal *src, s21_decimal128_encoding encoding, s21_decimal128 *dst, size_t n);
+
+// децималь в значения Arrow decimal128 с масштабом scale (0..38): 16 байт,
+// дополнительный код, младшие 64 бита первыми. Меньший масштаб
+// домножается, больший округляется к четному, dst может совпадать с src
+// (на месте). 0 - успех, 1 - значение больше 38 цифр (получает 0) или NULL
+int s21_to_arrow_decimal128(const s21_decimal *src, size_t n, int scale, void *dst);
+
+// значения Arrow decimal128 с масштабом scale в децималь, лишние цифры
+// округляются к четному, dst может совпадать с src (на месте).
+// 0 - успех, 1 - значение не помещается (получает 0) или NULL
+int s21_from_arrow_decimal128(const void *src, size_t n, int scale, s21_decimal *dst);
+
+// экспорт столбца как Arrow decimal128(38, scale) через C Data Interface,
+// scale < 0 - наибольший масштаб столбца. in_place = 1: значения
+// переписываются прямо в column (без буфера под данные), массив ссылается
+// на column, и до release column хранит значения Arrow (обратно -
+// s21_from_arrow_decimal128). Иначе данные копируются в новый буфер.
+// Память освобождает release (вызывает потребитель).
+// 0 - успех, 1 - ошибка аргументов или памяти (schema и array не
+// заполнены), 2 - экспортировано, но значения больше 38 цифр получили 0
+int s21_arrow_export_decimal128(s21_decimal *column, size_t n, int scale, int in_place, struct ArrowSchema *schema, struct ArrowArray *array);
+
+// импорт массива Arrow decimal128 (формат "d:P,S" или "d:P,S,128") в dst
+// из array->length элементов, null получают 0, dst может совпадать с
+// буфером данных массива. array не освобождается.
+// 0 - успех, 1 - не decimal128 или NULL, 2 - значения, которые не
+// помещаются в децималь, получили 0
+int s21_arrow_import_decimal128(const struct ArrowSchema *schema, const struct ArrowArray *array, s21_decimal *dst);
+
+// децималь в двоичный PostgreSQL NUMERIC (numeric_send): dscale = масштаб,
+// *len - размер (не больше S21_PG_NUMERIC_MAX_SIZE).
+// 0 - успех, 1 - NULL, масштаб больше 28 или не хватает cap байт
+int s21_to_pg_numeric(const s21_decimal *src, unsigned char *dst, size_t cap, size_t *len);
+
+// двоичный PostgreSQL NUMERIC из len байт в децималь с масштабом dscale
+// (не больше 28), лишние цифры округляются к четному.
+// 0 - успех, 1 - NaN, бесконечность, неверный формат или не помещается
+int s21_from_pg_numeric(const unsigned char *src, size_t len, s21_decimal *dst);
+
+// пакетные версии для полей COPY BINARY (длина int32 big-endian, затем
+// значение; длина -1 - NULL). *written / *consumed - байт записано /
+// прочитано (можно NULL). Запись останавливается, когда не хватает места,
+// чтение - на обрезанном поле (остальные элементы получают 0).
+// 0 - все элементы сконвертированы, 1 - иначе (ошибочные и NULL получают 0,
+// NULL ошибкой не считается)
+int s21_to_pg_numeric_batch(const s21_decimal *src, size_t n, unsigned char *dst, size_t cap, size_t *written);
+int s21_from_pg_numeric_batch(const unsigned char *src, size_t len, s21_decimal *dst, size_t n, size_t *consumed);
+
+// децималь в запись переменной длины: байт заголовка (масштаб и знак) и
+// модуль LEB128, *len - размер (не больше S21_VARINT_MAX_SIZE).
+// 0 - успех, 1 - NULL, масштаб больше 28 или не хватает cap байт
+int s21_encode_varint(const s21_decimal *src, unsigned char *dst, size_t cap, size_t *len);
+
+// запись переменной длины из первых len байт в децималь, *used - размер
+// записи (можно NULL). 0 - успех, 1 - неверный формат или NULL,
+// 2 - запись не закончилась в len байтах
+int s21_decode_varint(const unsigned char *src, size_t len, s21_decimal *dst, size_t *used);
+
+// пакетные версии для потока: записи подряд, *count - обработано
+// элементов, *written / *consumed - байт (можно NULL). На коде 2 (нет места
+// или последняя запись обрезана) следующий вызов продолжает с src + *count
+// или с непрочитанного хвоста. Запись: 0 - успех, 1 - были ошибочные
+// элементы (записаны как 0). Чтение: 0 - успех, 1 - неверный формат
+// (чтение остановлено на элементе *count)
+int s21_encode_varint_batch(const s21_decimal *src, size_t n, unsigned char *dst, size_t cap, size_t *count, size_t *written);
+int s21_decode_varint_batch(const unsigned char *src, size_t len, s21_decimal *dst, size_t n, size_t *count, size_t *consumed);
+
+// наибольший размер сжатого столбца из n значений (0 - неверный block)
+size_t s21_bitpack_bound(size_t n, int block);
+
+// сжатие столбца с общим масштабом scale блоками по block (128 или 1024)
+// значений: минимум блока и разности по наименьшей ширине бит. Значения с
+// меньшим масштабом домножаются точно, *len - размер.
+// 0 - успех, 1 - неверные аргументы, значение с большим масштабом или не
+// помещается в int64 при scale, 2 - не хватает cap байт
+int s21_bitpack_encode(const s21_decimal *src, size_t n, int scale, int block, unsigned char *dst, size_t cap, size_t *len);
+int s21_bitpack_encode_int64(const int64_t *src, size_t n, int scale, int block, unsigned char *dst, size_t cap, size_t *len);
+
+// число значений и масштаб сжатого столбца 0 - успех, 1 - неверный формат
+int s21_bitpack_info(const unsigned char *src, size_t len, size_t *n, int *scale);
+
+// распаковка всех значений в dst (n из s21_bitpack_info элементов), в
+// децималь с масштабом столбца или в масштабированные int64.
+// 0 - успех, 1 - неверный формат
+int s21_bitpack_decode(const unsigned char *src, size_t len, s21_decimal *dst);
+int s21_bitpack_decode_int64(const unsigned char *src, size_t len, int64_t *dst);
+
 
 
 
@@ -142,7 +632,116 @@ int s21_round(s21_decimal value, s21_decimal *result);
 // отбросить дробную часть числа(окргуление к нулю)
 int s21_truncate(s21_decimal value, s21_decimal *result);
 
+// округлить до scale знаков после запятой в заданном режиме
+int s21_round_to_scale(s21_decimal value, int scale, s21_rounding_mode mode, s21_decimal *result);
+
 // изменить знак числа на противоположный
 int s21_negate(s21_decimal value, s21_decimal *result);
 
-#endif
\ No newline at end of file
+
+
+
+// decimal в s21_decimal256 без потерь (0 - успех, 1 - NULL)
+int s21_decimal256_from_decimal(const s21_decimal *src, s21_decimal256 *dst);
+
+// s21_decimal256 в decimal с банковским округлением до 96 бит и масштаба 28
+// 0 - успех, 1 - слишком большое, 2 - слишком маленькое (dst не меняется)
+int s21_decimal256_to_decimal(const s21_decimal256 *src, s21_decimal *dst);
+
+// арифметика s21_decimal256: точный результат округляется один раз до 256
+// бит и масштаба 76, коды ошибок и флаги как у s21_add / s21_mul;
+// result может совпадать с операндами
+int s21_decimal256_add(const s21_decimal256 *value_1, const s21_decimal256 *value_2, s21_decimal256 *result);
+int s21_decimal256_sub(const s21_decimal256 *value_1, const s21_decimal256 *value_2, s21_decimal256 *result);
+int s21_decimal256_mul(const s21_decimal256 *value_1, const s21_decimal256 *value_2, s21_decimal256 *result);
+
+// числовое сравнение: -1, 0, 1 (1.0 == 1.00, 0 == -0)
+int s21_decimal256_compare(const s21_decimal256 *value_1, const s21_decimal256 *value_2);
+
+
+
+
+// decimal в s21_decimal64 без потерь (0 - успех, 1 - мантисса больше
+// 56 бит, неверный масштаб или NULL, dst не меняется)
+int s21_decimal64_from_decimal(const s21_decimal *src, s21_decimal64 *dst);
+
+// s21_decimal64 в decimal, всегда точно (0 - успех, 1 - NULL)
+int s21_decimal64_to_decimal(s21_decimal64 src, s21_decimal *dst);
+
+// масштабированное int64 в s21_decimal64 (1999 при scale 2 -> 19.99)
+// 0 - успех, 1 - модуль больше 56 бит или масштаб вне 0..28
+int s21_decimal64_from_scaled_int64(int64_t src, int scale, s21_decimal64 *dst);
+
+// арифметика s21_decimal64 без округления: масштаб суммы - больший из
+// масштабов, произведения - сумма масштабов. 0 - результат в *result;
+// S21_DECIMAL64_PROMOTED - точный результат не помещается в s21_decimal64
+// и записан в *promoted (с одним банковским округлением, как
+// s21_decimal256_to_decimal); 1 / 2 - не помещается и в decimal, 1 - NULL
+int s21_decimal64_add(s21_decimal64 value_1, s21_decimal64 value_2, s21_decimal64 *result, s21_decimal *promoted);
+int s21_decimal64_sub(s21_decimal64 value_1, s21_decimal64 value_2, s21_decimal64 *result, s21_decimal *promoted);
+int s21_decimal64_mul(s21_decimal64 value_1, s21_decimal64 value_2, s21_decimal64 *result, s21_decimal *promoted);
+
+// числовое сравнение: -1, 0, 1 (1.0 == 1.00, 0 == -0)
+int s21_decimal64_compare(s21_decimal64 value_1, s21_decimal64 value_2);
+
+// пакетные версии - 0 если все элементы сконвертированы, ошибочные получают 0
+int s21_decimal64_from_decimal_batch(const s21_decimal *src, s21_decimal64 *dst, size_t n);
+int s21_decimal64_to_decimal_batch(const s21_decimal64 *src, s21_decimal *dst, size_t n);
+
+
+
+
+// позиция пула s21_bigdecimal текущего потока
+size_t s21_bigdecimal_mark(void);
+
+// вернуть в пул все разряды, выделенные после mark (числа, получившие
+// разряды после mark, нужно заново инициализировать)
+void s21_bigdecimal_release(size_t mark);
+
+// ноль без разрядов (разряды выделяются при первой записи результата)
+void s21_bigdecimal_init(s21_bigdecimal *d);
+
+// decimal в s21_bigdecimal без потерь, dst получает новые разряды
+// (0 - успех, 1 - NULL или нет места в пуле)
+int s21_bigdecimal_from_decimal(const s21_decimal *src, s21_bigdecimal *dst);
+
+// s21_bigdecimal в decimal с банковским округлением до 96 бит и масштаба 28
+// 0 - успех, 1 - слишком большое (или нет места в пуле для копии
+// мантиссы), 2 - слишком маленькое (dst не меняется)
+int s21_bigdecimal_to_decimal(const s21_bigdecimal *src, s21_decimal *dst);
+
+// точная арифметика s21_bigdecimal: 0 - успех, 1 - NULL, нет места в пуле
+// или масштаб больше S21_BIGDECIMAL_SCALE_MAX (result не меняется, у
+// масштаба произведения - флаг OVERFLOW в контексте);
+// result должен быть инициализирован и может совпадать с операндами
+int s21_bigdecimal_add(const s21_bigdecimal *value_1, const s21_bigdecimal *value_2, s21_bigdecimal *result);
+int s21_bigdecimal_sub(const s21_bigdecimal *value_1, const s21_bigdecimal *value_2, s21_bigdecimal *result);
+int s21_bigdecimal_mul(const s21_bigdecimal *value_1, const s21_bigdecimal *value_2, s21_bigdecimal *result);
+
+// числовое сравнение в *result: -1, 0, 1 (1.0 == 1.00, 0 == -0)
+// 0 - успех, 1 - NULL или нет места в пуле для выравнивания масштабов
+int s21_bigdecimal_compare(const s21_bigdecimal *value_1, const s21_bigdecimal *value_2, int *result);
+
+
+// разобрать формулу: числа, переменные [A-Za-z_][A-Za-z0-9_]*, + - * /,
+// унарный минус и скобки. Константные подвыражения вычисляются сразу.
+// 0 - успех, 1 - синтаксическая ошибка, 2 - превышены лимиты
+// S21_FORMULA_MAX_* или константа не вычисляется (*error_pos - смещение
+// ошибки, может быть NULL)
+int s21_formula_compile(const char *text, s21_formula *formula, size_t *error_pos);
+
+// номер переменной (индекс столбца для s21_formula_eval), -1 если нет
+int s21_formula_var(const s21_formula *formula, const char *name);
+
+// out[i] = формула от columns[v][i] по блокам S21_FORMULA_BLOCK строк,
+// каждая инструкция - пакетная операция над столбцом блока; ошибки и
+// округления как у s21_*_batch (строка с ошибкой получает 0), возвращает
+// флаги вызова. out может совпадать с любым столбцом
+unsigned s21_formula_eval(const s21_formula *formula, const s21_decimal *const *columns, s21_decimal *out,
+                          size_t n, s21_context *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
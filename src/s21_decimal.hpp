@@ -0,0 +1,390 @@
+/**
+ * @file s21_decimal.hpp
+ * @brief C++ обертка s21::Decimal над s21_decimal
+ * @details Decimal - standard-layout класс с единственным полем
+ *          s21_decimal: размер и расположение совпадают, поэтому массивы
+ *          s21_decimal и Decimal приводятся друг к другу без копирования
+ *          (as_decimal / as_raw). Операторы вызывают операции библиотеки
+ *          по указателям (s21_*_p), сравнения, смена знака и проверка на
+ *          ноль для чисел с одинаковым масштабом выполняются прямо в
+ *          заголовке. Заголовок включает s21_decimal.h в режиме
+ *          S21_HEADER_ONLY (горячие функции static inline), библиотеку
+ *          можно собирать в любом режиме.
+ *
+ *          Операторы не бросают исключений: при ошибке результат равен 0,
+ *          а в контексте потока (s21_context_get()->flags) поднимаются
+ *          флаги S21_FLAG_OVERFLOW / S21_FLAG_DIV_BY_ZERO. Коды ошибок
+ *          доступны через s21::add / sub / mul / div.
+ *
+ *          Константы: литерал "19.99"_dec (или 19.99_dec) и операции
+ *          +, -, * и сравнения constexpr - в константных выражениях они
+ *          вычисляются при компиляции (s21_decimal_constexpr.hpp) с тем
+ *          же результатом, что у библиотеки.
+ *
+ *          Требуется C++17 (to_chars / from_chars из <charconv>).
+ */
+
+#ifndef S21_DECIMAL_HPP
+#define S21_DECIMAL_HPP
+
+#ifndef S21_HEADER_ONLY
+#define S21_HEADER_ONLY
+#endif
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include "s21_decimal.h"
+#include "s21_decimal_constexpr.hpp"
+
+namespace s21 {
+
+class Decimal {
+ public:
+  // 0 с масштабом 0
+  constexpr Decimal() noexcept : value_{{0, 0, 0, 0}} {}
+
+  // копия значения C API
+  constexpr explicit Decimal(const s21_decimal &raw) noexcept : value_(raw) {}
+
+  // целые со знаком до 64 бит
+  template <class T, typename std::enable_if<std::is_integral<T>::value &&
+                                                 std::is_signed<T>::value,
+                                             int>::type = 0>
+  constexpr Decimal(T v) noexcept  // NOLINT: неявное как у целых
+      : Decimal(from_u64(v < 0 ? 0u - static_cast<uint64_t>(v)
+                               : static_cast<uint64_t>(v),
+                         0, v < 0)) {}
+
+  // целые без знака до 64 бит
+  template <class T, typename std::enable_if<std::is_integral<T>::value &&
+                                                 !std::is_signed<T>::value &&
+                                                 !std::is_same<T, bool>::value,
+                                             int>::type = 0>
+  constexpr Decimal(T v) noexcept  // NOLINT: неявное как у целых
+      : Decimal(from_u64(static_cast<uint64_t>(v), 0, false)) {}
+
+  // масштабированное целое: from_scaled(1999, 2) = 19.99 (0 при
+  // масштабе вне 0..28)
+  static constexpr Decimal from_scaled(int64_t v, int scale) noexcept {
+    Decimal d;
+    if (scale >= 0 && scale <= S21_SCALE_MAX)
+      d = from_u64(v < 0 ? 0u - static_cast<uint64_t>(v)
+                         : static_cast<uint64_t>(v),
+                   scale, v < 0);
+    return d;
+  }
+
+  constexpr const s21_decimal &raw() const noexcept { return value_; }
+  constexpr s21_decimal &raw() noexcept { return value_; }
+
+  constexpr int scale() const noexcept { return detail::ce_scale(value_); }
+  constexpr bool is_negative() const noexcept {
+    return detail::ce_sign(value_);
+  }
+  constexpr bool is_zero() const noexcept {
+    return (value_.bits[0] | value_.bits[1] | value_.bits[2]) == 0;
+  }
+
+  explicit operator double() const noexcept {
+    double d = 0.0;
+    s21_from_decimal_to_double(value_, &d);
+    return d;
+  }
+
+  constexpr Decimal operator-() const noexcept {
+    Decimal d(*this);
+    d.value_.bits[3] =
+        static_cast<int>(static_cast<uint32_t>(d.value_.bits[3]) ^
+                         S21_SIGN_MASK);
+    return d;
+  }
+  constexpr Decimal operator+() const noexcept { return *this; }
+
+  // в константном выражении - constexpr версия, при ее ошибке вызов
+  // библиотеки делает выражение неконстантным (ошибка компиляции)
+  constexpr Decimal &operator+=(const Decimal &o) noexcept {
+    if (detail::constant_evaluated() &&
+        detail::ce_add_sub(value_, o.value_, false, value_) == 0)
+      return *this;
+    return apply(s21_add_p, o);
+  }
+  constexpr Decimal &operator-=(const Decimal &o) noexcept {
+    if (detail::constant_evaluated() &&
+        detail::ce_add_sub(value_, o.value_, true, value_) == 0)
+      return *this;
+    return apply(s21_sub_p, o);
+  }
+  constexpr Decimal &operator*=(const Decimal &o) noexcept {
+    if (detail::constant_evaluated() &&
+        detail::ce_mul(value_, o.value_, value_) == 0)
+      return *this;
+    return apply(s21_mul_p, o);
+  }
+  Decimal &operator/=(const Decimal &o) noexcept {
+    return apply(s21_div_p, o);
+  }
+
+  friend constexpr Decimal operator+(Decimal a, const Decimal &b) noexcept {
+    return a += b;
+  }
+  friend constexpr Decimal operator-(Decimal a, const Decimal &b) noexcept {
+    return a -= b;
+  }
+  friend constexpr Decimal operator*(Decimal a, const Decimal &b) noexcept {
+    return a *= b;
+  }
+  friend Decimal operator/(Decimal a, const Decimal &b) noexcept {
+    return a /= b;
+  }
+
+  // -1, 0, 1: a < b, a == b, a > b (числовое сравнение, 1.0 == 1.00)
+  friend constexpr int compare(const Decimal &a, const Decimal &b) noexcept {
+    int result = 0;
+    if (detail::constant_evaluated()) {
+      result = detail::ce_compare(a.value_, b.value_);
+    } else if (a.is_zero() && b.is_zero()) {
+      result = 0;
+    } else if (a.value_.bits[3] == b.value_.bits[3]) {
+      // одинаковые знак и масштаб - сравниваем мантиссы
+      uint32_t x[3] = {0u, 0u, 0u}, y[3] = {0u, 0u, 0u};
+      u96_from_dec(&a.value_, x);
+      u96_from_dec(&b.value_, y);
+      result = u96_compare(x, y);
+      if (a.is_negative()) result = -result;
+    } else if (s21_is_equal(a.value_, b.value_)) {
+      result = 0;
+    } else {
+      result = s21_is_less(a.value_, b.value_) ? -1 : 1;
+    }
+    return result;
+  }
+
+  friend constexpr bool operator==(const Decimal &a,
+                                   const Decimal &b) noexcept {
+    return compare(a, b) == 0;
+  }
+  friend constexpr bool operator!=(const Decimal &a,
+                                   const Decimal &b) noexcept {
+    return compare(a, b) != 0;
+  }
+  friend constexpr bool operator<(const Decimal &a,
+                                  const Decimal &b) noexcept {
+    return compare(a, b) < 0;
+  }
+  friend constexpr bool operator<=(const Decimal &a,
+                                   const Decimal &b) noexcept {
+    return compare(a, b) <= 0;
+  }
+  friend constexpr bool operator>(const Decimal &a,
+                                  const Decimal &b) noexcept {
+    return compare(a, b) > 0;
+  }
+  friend constexpr bool operator>=(const Decimal &a,
+                                   const Decimal &b) noexcept {
+    return compare(a, b) >= 0;
+  }
+
+  // хеш не зависит от масштаба: 1.0 и 1.00 дают одно значение
+  std::size_t hash() const noexcept {
+    uint64_t h = 0;
+    if (!is_zero()) {
+      s21_decimal n = value_;
+      s21_strip_trailing_zeros(&n);
+      uint64_t lo = static_cast<uint32_t>(n.bits[0]) |
+                    (static_cast<uint64_t>(static_cast<uint32_t>(n.bits[1]))
+                     << 32);
+      uint64_t hi = static_cast<uint32_t>(n.bits[2]) |
+                    (static_cast<uint64_t>(static_cast<uint32_t>(n.bits[3]))
+                     << 32);
+      h = mix(lo ^ mix(hi));
+    }
+    return static_cast<std::size_t>(h);
+  }
+
+ private:
+  using op_p = int (*)(const s21_decimal *, const s21_decimal *,
+                       s21_decimal *);
+
+  // при ошибке операции результат 0 (флаги уже подняты библиотекой)
+  Decimal &apply(op_p op, const Decimal &o) noexcept {
+    if (op(&value_, &o.value_, &value_) != 0) value_ = Decimal().value_;
+    return *this;
+  }
+
+  static constexpr Decimal from_u64(uint64_t mag, int scale,
+                                   bool negative) noexcept {
+    return Decimal(s21_decimal{
+        {static_cast<int>(static_cast<uint32_t>(mag)),
+         static_cast<int>(static_cast<uint32_t>(mag >> 32)), 0,
+         static_cast<int>((static_cast<uint32_t>(scale) << S21_SCALE_SHIFT) |
+                          (negative ? S21_SIGN_MASK : 0u))}});
+  }
+
+  // финальное перемешивание splitmix64
+  static uint64_t mix(uint64_t x) noexcept {
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ull;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBull;
+    x ^= x >> 31;
+    return x;
+  }
+
+  s21_decimal value_;
+};
+
+static_assert(std::is_standard_layout<Decimal>::value,
+              "Decimal должен быть standard-layout");
+static_assert(sizeof(Decimal) == sizeof(s21_decimal) &&
+                  alignof(Decimal) == alignof(s21_decimal),
+              "Decimal и s21_decimal должны совпадать по расположению");
+
+// массив s21_decimal как массив Decimal и обратно, без копирования
+inline Decimal *as_decimal(s21_decimal *p) noexcept {
+  return reinterpret_cast<Decimal *>(p);
+}
+inline const Decimal *as_decimal(const s21_decimal *p) noexcept {
+  return reinterpret_cast<const Decimal *>(p);
+}
+inline s21_decimal *as_raw(Decimal *p) noexcept {
+  return reinterpret_cast<s21_decimal *>(p);
+}
+inline const s21_decimal *as_raw(const Decimal *p) noexcept {
+  return reinterpret_cast<const s21_decimal *>(p);
+}
+
+// операции с кодом ошибки библиотеки (0 - успех), out может быть a или b
+inline int add(const Decimal &a, const Decimal &b, Decimal &out) noexcept {
+  return s21_add_p(&a.raw(), &b.raw(), &out.raw());
+}
+inline int sub(const Decimal &a, const Decimal &b, Decimal &out) noexcept {
+  return s21_sub_p(&a.raw(), &b.raw(), &out.raw());
+}
+inline int mul(const Decimal &a, const Decimal &b, Decimal &out) noexcept {
+  return s21_mul_p(&a.raw(), &b.raw(), &out.raw());
+}
+inline int div(const Decimal &a, const Decimal &b, Decimal &out) noexcept {
+  return s21_div_p(&a.raw(), &b.raw(), &out.raw());
+}
+
+// текст [-]цифры[.цифры] с сохранением масштаба
+inline std::to_chars_result to_chars(char *first, char *last,
+                                     const Decimal &v) noexcept {
+  char *end = last;
+  std::to_chars_result r{last, std::errc::value_too_large};
+  if (s21_to_chars(&v.raw(), first, last, &end) == 0) r = {end, std::errc()};
+  return r;
+}
+
+// [+-]цифры[.цифры], лишние дробные цифры округляются к четному
+inline std::from_chars_result from_chars(const char *first, const char *last,
+                                         Decimal &v) noexcept {
+  const char *end = first;
+  int code = s21_from_chars(first, last, &v.raw(), &end);
+  std::from_chars_result r{end, std::errc()};
+  if (code == 1) r.ec = std::errc::invalid_argument;
+  if (code == 2) r.ec = std::errc::result_out_of_range;
+  return r;
+}
+
+inline std::string to_string(const Decimal &v) {
+  char buf[32];  // знак, 29 цифр, точка, ведущий 0
+  auto r = to_chars(buf, buf + sizeof(buf), v);
+  return std::string(buf, r.ptr);
+}
+
+namespace literals {
+
+// "19.99"_dec: constexpr разбор, в константном выражении некорректный
+// или слишком большой литерал - ошибка компиляции, во время выполнения -
+// 0 (и флаг переполнения, если целая часть больше 96 бит)
+constexpr Decimal operator""_dec(const char *s, std::size_t n) noexcept {
+  s21_decimal d{};
+  int code = detail::ce_from_chars(s, s + n, d);
+  if (code != 0) detail::literal_error(code);
+  return Decimal(d);
+}
+
+// 19.99_dec: всегда разбирается при компиляции
+template <char... C>
+constexpr Decimal operator""_dec() noexcept {
+  constexpr detail::literal_result r = detail::parse_literal<C...>();
+  static_assert(r.code == 0, "некорректный или слишком большой литерал");
+  return Decimal(r.value);
+}
+
+}  // namespace literals
+
+}  // namespace s21
+
+namespace std {
+
+template <>
+struct hash<s21::Decimal> {
+  std::size_t operator()(const s21::Decimal &d) const noexcept {
+    return d.hash();
+  }
+};
+
+// точный десятичный тип: 28 знаков, шаг 1e-28, без бесконечностей и NaN
+template <>
+class numeric_limits<s21::Decimal> {
+ public:
+  static constexpr bool is_specialized = true;
+  static constexpr bool is_signed = true;
+  static constexpr bool is_integer = false;
+  static constexpr bool is_exact = true;
+  static constexpr bool has_infinity = false;
+  static constexpr bool has_quiet_NaN = false;
+  static constexpr bool has_signaling_NaN = false;
+  static constexpr float_denorm_style has_denorm = denorm_absent;
+  static constexpr bool has_denorm_loss = false;
+  static constexpr float_round_style round_style = round_to_nearest;
+  static constexpr bool is_iec559 = false;
+  static constexpr bool is_bounded = true;
+  static constexpr bool is_modulo = false;
+  static constexpr int radix = 10;
+  static constexpr int digits = 28;
+  static constexpr int digits10 = 28;
+  static constexpr int max_digits10 = 29;
+  static constexpr int min_exponent = -S21_SCALE_MAX;
+  static constexpr int min_exponent10 = -S21_SCALE_MAX;
+  static constexpr int max_exponent = 29;
+  static constexpr int max_exponent10 = 28;
+  static constexpr bool traps = false;
+  static constexpr bool tinyness_before = false;
+
+  // наименьшее положительное: 1e-28
+  static constexpr s21::Decimal min() noexcept {
+    return s21::Decimal(s21_decimal{{1, 0, 0, S21_SCALE_MAX << 16}});
+  }
+  // 2^96 - 1 = 79228162514264337593543950335
+  static constexpr s21::Decimal max() noexcept {
+    return s21::Decimal(s21_decimal{{-1, -1, -1, 0}});
+  }
+  static constexpr s21::Decimal lowest() noexcept {
+    return s21::Decimal(s21_decimal{{-1, -1, -1, INT32_MIN}});
+  }
+  static constexpr s21::Decimal epsilon() noexcept { return min(); }
+  // половина единицы последнего разряда
+  static constexpr s21::Decimal round_error() noexcept {
+    return s21::Decimal(s21_decimal{{5, 0, 0, 1 << 16}});
+  }
+  static constexpr s21::Decimal infinity() noexcept { return s21::Decimal(); }
+  static constexpr s21::Decimal quiet_NaN() noexcept { return s21::Decimal(); }
+  static constexpr s21::Decimal signaling_NaN() noexcept {
+    return s21::Decimal();
+  }
+  static constexpr s21::Decimal denorm_min() noexcept { return min(); }
+};
+
+}  // namespace std
+
+#endif
@@ -0,0 +1,288 @@
+/**
+ * @file s21_decimal_constexpr.hpp
+ * @brief constexpr сложение, умножение, сравнение и разбор текста
+ * @details Повторяют алгоритмы s21_add_sub_p, s21_mul_p, сравнений и
+ *          s21_from_chars шаг в шаг (тот же результат, включая масштаб),
+ *          но без флагов контекста и вызовов C функций, поэтому доступны
+ *          при вычислении на этапе компиляции. s21::Decimal вызывает их
+ *          только внутри константных выражений, во время выполнения
+ *          работает библиотека.
+ */
+
+#ifndef S21_DECIMAL_CONSTEXPR_HPP
+#define S21_DECIMAL_CONSTEXPR_HPP
+
+#include <cstdint>
+
+#include "s21_decimal.h"
+#include "s21_wide.hpp"
+
+namespace s21 {
+namespace detail {
+
+constexpr int ce_scale(const s21_decimal &d) noexcept {
+  uint32_t w = static_cast<uint32_t>(d.bits[3]);
+  return static_cast<int>((w & S21_SCALE_MASK) >> S21_SCALE_SHIFT);
+}
+
+constexpr bool ce_sign(const s21_decimal &d) noexcept {
+  return (static_cast<uint32_t>(d.bits[3]) & S21_SIGN_MASK) != 0u;
+}
+
+constexpr s21_decimal ce_make(const uint_n<3> &mag, int scale,
+                              bool negative) noexcept {
+  s21_decimal d{{static_cast<int>(mag.w[0]), static_cast<int>(mag.w[1]),
+                 static_cast<int>(mag.w[2]),
+                 static_cast<int>(
+                     (static_cast<uint32_t>(scale) << S21_SCALE_SHIFT) |
+                     (negative ? S21_SIGN_MASK : 0u))}};
+  return d;
+}
+
+// a / 10 с округлением к четному по остатку
+template <int N>
+constexpr void ce_div10_round(uint_n<N> &a) noexcept {
+  uint32_t rem = wide_div_small(a, 10u);
+  if (rem > 5u || (rem == 5u && (a.w[0] & 1u)))
+    wide_add(a, wide_from_u64<N>(1u));
+}
+
+// s21_add_sub_p: 0 - успех, 1 - переполнение
+constexpr int ce_add_sub(const s21_decimal &x, const s21_decimal &y,
+                         bool negate, s21_decimal &out) noexcept {
+  uint_n<3> a = wide_from_decimal<3>(x);
+  uint_n<3> b = wide_from_decimal<3>(y);
+  int sa = ce_scale(x), sb = ce_scale(y);
+  bool na = ce_sign(x), nb = ce_sign(y) != negate;
+  int result = 0;
+
+  // align_scales: меньший масштаб растет, пока мантисса помещается,
+  // затем больший уменьшается с округлением
+  if (sa > sb) {
+    uint_n<3> t = a;
+    a = b;
+    b = t;
+    int ts = sa;
+    sa = sb;
+    sb = ts;
+    bool tn = na;
+    na = nb;
+    nb = tn;
+  }
+  while (sa < sb) {
+    uint_n<3> t = a;
+    if (wide_mul_small(t, 10u) == 0u) {
+      a = t;
+      sa++;
+    } else {
+      ce_div10_round(b);
+      sb--;
+    }
+  }
+
+  uint_n<3> r{};
+  bool nr = false;
+  int scale = sa;
+
+  if (na == nb) {
+    uint_n<4> ext = wide_resize<4>(a, nullptr);
+    wide_add(ext, wide_resize<4>(b, nullptr));
+    while (result == 0 && ext.w[3] != 0u) {
+      if (scale == 0) {
+        result = 1;
+      } else {
+        ce_div10_round(ext);
+        scale--;
+      }
+    }
+    r = wide_resize<3>(ext, nullptr);
+    nr = na;
+  } else {
+    int cmp = wide_cmp(a, b);
+    if (cmp == 0) {
+      scale = 0;
+    } else if (cmp > 0) {
+      r = a;
+      wide_sub(r, b);
+      nr = na;
+    } else {
+      r = b;
+      wide_sub(r, a);
+      nr = nb;
+    }
+  }
+
+  if (result == 0) {
+    // strip_trailing_zeros
+    bool more = true;
+    while (scale > 0 && more) {
+      uint_n<3> t = r;
+      more = wide_div_small(t, 10u) == 0u;
+      if (more) {
+        r = t;
+        scale--;
+      }
+    }
+    out = ce_make(r, scale, nr);
+  }
+  return result;
+}
+
+// s21_mul_p: 0 - успех, 1 - переполнение
+constexpr int ce_mul(const s21_decimal &x, const s21_decimal &y,
+                     s21_decimal &out) noexcept {
+  uint_n<6> p = wide_mul(wide_from_decimal<3>(x), wide_from_decimal<3>(y));
+  int scale = ce_scale(x) + ce_scale(y);
+  int result = 0;
+  bool dropped = false;
+  uint32_t last = 0u;
+  bool sticky = false;
+
+  // reduce_product: цифры отбрасываются без округления, затем одно
+  // округление к четному
+  while (result == 0 && (wide_len(p) > 3 || scale > S21_SCALE_MAX)) {
+    if (scale == 0) {
+      result = 1;
+    } else {
+      sticky = sticky || last != 0u;
+      last = wide_div_small(p, 10u);
+      scale--;
+      dropped = true;
+    }
+  }
+
+  if (result == 0 && dropped &&
+      (last > 5u || (last == 5u && (sticky || (p.w[0] & 1u))))) {
+    wide_add(p, wide_from_u64<6>(1u));
+    if (wide_len(p) > 3) {
+      if (scale == 0) {
+        result = 1;
+      } else {
+        ce_div10_round(p);
+        scale--;
+      }
+    }
+  }
+
+  if (result == 0)
+    out = ce_make(wide_resize<3>(p, nullptr), scale,
+                  ce_sign(x) != ce_sign(y));
+  return result;
+}
+
+// числовое сравнение: -1, 0, 1 (1.0 == 1.00, 0 == -0)
+constexpr int ce_compare(const s21_decimal &x, const s21_decimal &y) noexcept {
+  uint_n<6> a = wide_from_decimal<6>(x);
+  uint_n<6> b = wide_from_decimal<6>(y);
+  bool za = wide_is_zero(a), zb = wide_is_zero(b);
+  bool na = ce_sign(x) && !za, nb = ce_sign(y) && !zb;
+  int result = 0;
+
+  if (na != nb) {
+    result = na ? -1 : 1;
+  } else {
+    int sa = ce_scale(x), sb = ce_scale(y);
+    if (sa < sb) wide_mul_pow10(a, sb - sa);
+    if (sb < sa) wide_mul_pow10(b, sa - sb);
+    result = wide_cmp(a, b);
+    if (na) result = -result;
+  }
+  return result;
+}
+
+// s21_from_chars для всей строки [first, last): 0 - успех, 1 - не
+// число или лишние символы, 2 - целая часть больше 96 бит
+constexpr int ce_from_chars(const char *first, const char *last,
+                            s21_decimal &out) noexcept {
+  const char *p = first;
+  uint_n<3> a{};
+  bool negative = false;
+  int scale = 0;
+  int digits = 0;
+  bool overflow = false;
+  int dropped = -1;  // первая отброшенная цифра (-1 - нет)
+  bool sticky = false;
+  int result = 1;
+
+  if (p < last && (*p == '-' || *p == '+')) {
+    negative = *p == '-';
+    p++;
+  }
+
+  // цифра в мантиссу, false если не помещается (a не меняется)
+  auto push = [](uint_n<3> &m, uint32_t d) {
+    uint_n<3> t = m;
+    bool fits = wide_mul_small(t, 10u) == 0u &&
+                wide_add(t, wide_from_u64<3>(d)) == 0u;
+    if (fits) m = t;
+    return fits;
+  };
+
+  while (p < last && *p >= '0' && *p <= '9') {
+    if (!push(a, static_cast<uint32_t>(*p - '0'))) overflow = true;
+    digits++;
+    p++;
+  }
+
+  if (p + 1 < last && *p == '.' && p[1] >= '0' && p[1] <= '9') {
+    p++;
+    while (p < last && *p >= '0' && *p <= '9') {
+      uint32_t d = static_cast<uint32_t>(*p - '0');
+      if (dropped < 0 && scale < S21_SCALE_MAX && push(a, d)) {
+        scale++;
+      } else if (dropped < 0) {
+        dropped = static_cast<int>(d);
+      } else if (d != 0u) {
+        sticky = true;
+      }
+      digits++;
+      p++;
+    }
+  }
+
+  if (digits > 0 && p == last) {
+    if (dropped > 5 || (dropped == 5 && (sticky || (a.w[0] & 1u)))) {
+      if (wide_add(a, wide_from_u64<3>(1u)) != 0u) {
+        // 2^96 - 1 + 1: отбрасываем еще одну цифру
+        if (scale == 0) {
+          overflow = true;
+        } else {
+          a = uint_n<3>{{~0u, ~0u, ~0u}};
+          uint32_t rem = wide_div_small(a, 10u);
+          scale--;
+          if (rem > 5u ||
+              (rem == 5u && (dropped != 0 || sticky || (a.w[0] & 1u))))
+            wide_add(a, wide_from_u64<3>(1u));
+        }
+      }
+    }
+    result = overflow ? 2 : 0;
+    if (result == 0) out = ce_make(a, scale, negative);
+  }
+  return result;
+}
+
+// разбор литерала 19.99_dec из символов шаблона
+struct literal_result {
+  s21_decimal value;
+  int code;  // код ce_from_chars
+};
+
+template <char... C>
+constexpr literal_result parse_literal() noexcept {
+  const char s[] = {C...};
+  literal_result r{{{0, 0, 0, 0}}, 1};
+  r.code = ce_from_chars(s, s + sizeof...(C), r.value);
+  return r;
+}
+
+// ошибка литерала (не constexpr: в константном выражении - ошибка
+// компиляции, во время выполнения - флаг переполнения для кода 2)
+inline void literal_error(int code) noexcept {
+  if (code == 2) raise_flags(S21_FLAG_OVERFLOW);
+}
+
+}  // namespace detail
+}  // namespace s21
+
+#endif
@@ -0,0 +1,178 @@
+/**
+ * @file s21_decimal_inline.h
+ * @brief Горячие вспомогательные функции: масштаб, знак и 96-битная мантисса
+ * @details Обычная сборка: s21_extra_functions.c включает этот файл с пустым
+ *          S21_HELPER и получает внешние определения. Режим S21_HEADER_ONLY:
+ *          s21_decimal.h включает файл вместо прототипов, функции становятся
+ *          static inline и встраиваются в каждый вызов без LTO. Режим нужно
+ *          включать одинаково для библиотеки и для кода, который ее
+ *          использует (make HEADER_ONLY=1).
+ */
+
+#ifndef S21_DECIMAL_INLINE_H
+#define S21_DECIMAL_INLINE_H
+
+#ifndef S21_HELPER
+#define S21_HELPER static inline
+#endif
+
+// получение значения масштаба
+S21_HELPER int s21_get_scale(const s21_decimal* d){
+
+  int scale = 0;
+
+  if( d != NULL){
+  uint32_t scale_bit = d->bits[3] & S21_SCALE_MASK;
+
+  scale = (int)(scale_bit >> S21_SCALE_SHIFT);
+  }
+
+  return scale;
+}
+
+// установка значения масштаба
+S21_HELPER void s21_set_scale(s21_decimal* d, int s){
+
+  if(d != NULL){
+
+    if(s < 0) s = 0;
+    if(s > S21_SCALE_MAX) s = S21_SCALE_MAX;
+
+    uint32_t clear_bit = (uint32_t)d->bits[3] & ~S21_SCALE_MASK;
+    uint32_t new_scale = (uint32_t)s << S21_SCALE_SHIFT;
+
+    d->bits[3] = (int)(clear_bit | new_scale);
+  }
+}
+
+// получение знака десималь
+S21_HELPER int s21_get_sign(const s21_decimal* d) {
+
+  int sign = 0;
+
+  if(d != NULL){
+    if(((uint32_t)d->bits[3] & S21_SIGN_MASK) != 0u) sign = 1;
+  }
+  return sign;
+}
+
+// установка знака 1 - для отрицательного
+S21_HELPER void s21_set_sign(s21_decimal* d, int negative){
+
+  if(d != NULL){
+
+    if (negative){
+      d->bits[3] = (int)((uint32_t)d->bits[3] | S21_SIGN_MASK);
+    } else {
+      d->bits[3] = (int)((uint32_t)d->bits[3] & ~S21_SIGN_MASK);
+    }
+  }
+}
+
+// извлечь мантиссу из десималь
+S21_HELPER void u96_from_dec(const s21_decimal* d, uint32_t a[3]){
+  a[0] = (uint32_t)d->bits[0];
+  a[1] = (uint32_t)d->bits[1];
+  a[2] = (uint32_t)d->bits[2];
+}
+
+// сохранить 96 бит в десималь
+S21_HELPER void u96_to_dec(const uint32_t a[3], s21_decimal* d) {
+  d->bits[0] = (int)a[0];
+  d->bits[1] = (int)a[1];
+  d->bits[2] = (int)a[2];
+}
+
+// комировать 96 бит
+S21_HELPER void u96_copy(uint32_t dst[3], const uint32_t src[3]){
+  dst[0] = src[0];
+  dst[1] = src[1];
+  dst[2] = src[2];
+}
+
+// проверка 96 бит числа на 0
+S21_HELPER int u96_is_zero(const uint32_t a[3]){
+  return a[0] == 0u && a[1] == 0u && a[2] == 0u;
+}
+
+// сравнение a > b => 1
+S21_HELPER int u96_compare(const uint32_t a[3], const uint32_t b[3]){
+
+  int result = 0;
+  if(a[2] != b[2]){
+    if(a[2] > b[2]) result = 1;
+    else result = -1;
+
+  } else if(a[1] != b[1]){
+    if(a[1] > b[1]) result = 1;
+    else result = -1;
+    
+  } else if(a[0] != b[0]){
+    if(a[0] > b[0]) result = 1;
+    else result = -1;
+  }
+
+  return result;
+}
+
+// функция для сложения 96 бит и возвращения переноса(cтаршего разряда) при сложении 2х больших чисел
+S21_HELPER int u96_add(uint32_t a[3], const uint32_t b[3]) {
+  uint64_t c = (uint64_t)a[0] + b[0];
+  a[0] = (uint32_t)c;
+
+  c = (c >> 32) + (uint64_t)a[1] + b[1];
+  a[1] = (uint32_t)c;
+
+  c = (c >> 32) + (uint64_t)a[2] + b[2];
+  a[2] = (uint32_t)c;
+
+  return (int)(c >> 32);
+}
+
+// Функция для вычитания из a величину b и сохранение переноса
+// (заем - старший бит разности, 0 или 1)
+S21_HELPER int u96_sub(uint32_t a[3],const uint32_t b[3]){
+  uint64_t c = (uint64_t)a[0] - b[0];
+  a[0] = (uint32_t)c;
+
+  c = (uint64_t)a[1] - b[1] - (c >> 63);
+  a[1] = (uint32_t)c;
+
+  c = (uint64_t)a[2] - b[2] - (c >> 63);
+  a[2] = (uint32_t)c;
+
+  return (int)(c >> 63);
+}
+
+// умножение 96 бит на 10 возврат переноса
+S21_HELPER uint32_t u96_mul10(uint32_t a[3]){
+  uint64_t c = (uint64_t)a[0] * 10u;
+  a[0] = (uint32_t)c;
+
+  c = (c >> 32) + (uint64_t)a[1] * 10u;
+  a[1] = (uint32_t)c;
+
+  c = (c >> 32) + (uint64_t)a[2] * 10u;
+  a[2] = (uint32_t)c;
+
+  return (uint32_t)(c >> 32);
+}
+
+// Деление на 10 для 96 бит
+S21_HELPER uint32_t u96_div10(uint32_t a[3]){
+
+  uint32_t remain = 0;
+  uint64_t current = 0;
+
+  for(int i = 2; i >= 0; i--){
+    //берем число и добавляем остаток(cтарший разряд)
+    current = ((uint64_t)remain << 32) | a[i];
+
+    a[i] = (uint32_t)(current / 10); // целая часть
+    remain = (uint32_t)(current % 10); //остаток для следующего разряда
+  }
+
+  return remain;
+}
+
+#endif
@@ -0,0 +1,286 @@
+/**
+ * @file s21_expr.hpp
+ * @brief Шаблоны выражений: формула из +, -, * с одним округлением
+ * @details s21::fused(a) * b + fused(c) * d - e не вычисляется сразу, а
+ *          строит дерево узлов (тип выражения известен при компиляции).
+ *          При преобразовании в s21::Decimal дерево считается точно в
+ *          целых из N 32-битных разрядов (s21_wide.hpp): произведение
+ *          без потерь расширяет мантиссу, сумма выравнивает масштабы
+ *          умножением на 10^k. N каждого узла вычисляется при компиляции
+ *          по худшему случаю (a * b - 6 разрядов, a * b + c * d - 13),
+ *          памяти выражение не выделяет.
+ *
+ *          Округление одно, к четному, в конце: масштаб результата -
+ *          масштаб точного значения (как у умножения, без удаления
+ *          конечных нулей), уменьшается только если значение не
+ *          помещается в 96 бит или масштаб больше 28. Поэтому результат
+ *          не зависит от порядка операций и может отличаться от цепочки
+ *          s21_mul / s21_add, где округляется каждый шаг. Деления в
+ *          выражениях нет: его результат неточен, а одно округление в
+ *          конце требует точных промежуточных значений.
+ *
+ *          Ошибки как у s21::Decimal: результат 0 и флаг
+ *          S21_FLAG_OVERFLOW, при отброшенных знаках - S21_FLAG_ROUNDED /
+ *          S21_FLAG_INEXACT; код ошибки дает eval(). Все операции
+ *          constexpr, переполнение на этапе компиляции - ошибка
+ *          компиляции.
+ */
+
+#ifndef S21_EXPR_HPP
+#define S21_EXPR_HPP
+
+#include <cstdint>
+
+#include "s21_decimal.hpp"
+#include "s21_wide.hpp"
+
+namespace s21 {
+namespace expr {
+
+// точное значение узла: мантисса из N разрядов, масштаб и знак
+template <int N>
+struct Value {
+  detail::uint_n<N> mag;
+  int scale;
+  bool neg;  // false для нуля
+};
+
+// разрядов на множитель 10^k (с запасом в один бит)
+constexpr int pow10_limbs(int k) noexcept {
+  return (k * 3322 / 1000 + 33) / 32;
+}
+
+constexpr int max_of(int a, int b) noexcept { return a > b ? a : b; }
+
+// разрядов не больше 2048 бит: длиннее формулу лучше разбить
+constexpr int kMaxLimbs = 64;
+
+// лист: число s21::Decimal (масштаб больше 28 считается равным 28, как в
+// s21_set_scale)
+struct Leaf {
+  static constexpr int limbs = 3;
+  static constexpr int max_scale = S21_SCALE_MAX;
+
+  constexpr Value<limbs> eval() const noexcept {
+    int scale = d.scale();
+    return {detail::wide_from_decimal<3>(d.raw()),
+            scale > S21_SCALE_MAX ? S21_SCALE_MAX : scale,
+            d.is_negative() && !d.is_zero()};
+  }
+
+  Decimal d;
+};
+
+// l * r: произведение мантисс без потерь, масштабы складываются
+template <class L, class R>
+struct Mul {
+  static constexpr int limbs = L::limbs + R::limbs;
+  static constexpr int max_scale = L::max_scale + R::max_scale;
+  static_assert(limbs <= kMaxLimbs, "выражение слишком длинное");
+
+  constexpr Value<limbs> eval() const noexcept {
+    auto a = l.eval();
+    auto b = r.eval();
+    Value<limbs> v{detail::wide_mul(a.mag, b.mag), a.scale + b.scale, false};
+    v.neg = a.neg != b.neg && !detail::wide_is_zero(v.mag);
+    return v;
+  }
+
+  L l;
+  R r;
+};
+
+// l + r (Negate = false) или l - r: меньший масштаб домножается на 10^k,
+// разрядов хватает на худший случай и перенос
+template <class L, class R, bool Negate>
+struct AddSub {
+  static constexpr int limbs =
+      max_of(L::limbs + pow10_limbs(R::max_scale),
+             R::limbs + pow10_limbs(L::max_scale)) +
+      1;
+  static constexpr int max_scale = max_of(L::max_scale, R::max_scale);
+  static_assert(limbs <= kMaxLimbs, "выражение слишком длинное");
+
+  constexpr Value<limbs> eval() const noexcept {
+    auto a = l.eval();
+    auto b = r.eval();
+    Value<limbs> v{detail::wide_resize<limbs>(a.mag, nullptr), a.scale,
+                   a.neg};
+    detail::uint_n<limbs> m = detail::wide_resize<limbs>(b.mag, nullptr);
+
+    if (b.scale > v.scale) {
+      detail::wide_mul_pow10(v.mag, b.scale - v.scale);
+      v.scale = b.scale;
+    } else {
+      detail::wide_mul_pow10(m, v.scale - b.scale);
+    }
+    detail::wide_signed_add(v.mag, v.neg, m, b.neg != Negate);
+    return v;
+  }
+
+  L l;
+  R r;
+};
+
+// -e
+template <class E>
+struct Neg {
+  static constexpr int limbs = E::limbs;
+  static constexpr int max_scale = E::max_scale;
+
+  constexpr Value<limbs> eval() const noexcept {
+    Value<limbs> v = e.eval();
+    v.neg = !v.neg && !detail::wide_is_zero(v.mag);
+    return v;
+  }
+
+  E e;
+};
+
+// точное значение в s21_decimal с одним округлением к четному:
+// 0 - успех, 1 / 2 - переполнение (по знаку), *inexact - отброшены
+// ненулевые цифры, *rounded - отброшены цифры
+template <int N>
+constexpr int round_value(Value<N> v, s21_decimal &out, bool *rounded,
+                          bool *inexact) noexcept {
+  int result = 0;
+  int k = v.scale > S21_SCALE_MAX ? v.scale - S21_SCALE_MAX : 0;
+  int bits = detail::wide_bit_length(v.mag);
+
+  // 10^k0 <= 2^(bits - 96): после деления остается не меньше 2^95, k0
+  // не больше нужного числа цифр (хотя бы одна цифра лишняя всегда)
+  if (bits > 96) k = max_of(k, max_of(1, (bits - 96) * 30103 / 100000));
+
+  *rounded = k > 0;
+  *inexact = false;
+  if (k > 0) {
+    bool sticky = detail::wide_div_pow10(v.mag, k - 1) != 0;
+    uint32_t digit = detail::wide_div_small(v.mag, 10u);
+
+    // оценка снизу: добираем цифры, пока мантисса не помещается
+    while (detail::wide_len(v.mag) > 3) {
+      sticky = sticky || digit != 0u;
+      digit = detail::wide_div_small(v.mag, 10u);
+      k++;
+    }
+    if (digit > 5u || (digit == 5u && (sticky || (v.mag.w[0] & 1u)))) {
+      detail::wide_add(v.mag, detail::wide_from_u64<N>(1u));
+      if (detail::wide_len(v.mag) > 3) {
+        // 2^96 - 1 + 1 = 2^96: еще одна цифра, остаток 6 -> к большему
+        detail::wide_div_small(v.mag, 10u);
+        detail::wide_add(v.mag, detail::wide_from_u64<N>(1u));
+        k++;
+      }
+    }
+    *inexact = sticky || digit != 0u;
+  }
+
+  if (k > v.scale) {
+    result = v.neg ? 2 : 1;
+  } else {
+    out = detail::ce_make(detail::wide_resize<3>(v.mag, nullptr),
+                          v.scale - k, v.neg);
+  }
+  return result;
+}
+
+template <class E>
+class Expr {
+ public:
+  using node_type = E;
+
+  constexpr explicit Expr(const E &node) noexcept : node_(node) {}
+
+  constexpr const E &node() const noexcept { return node_; }
+
+  // 0 - успех, 1 / 2 - результат слишком велик / мал (out не меняется)
+  constexpr int eval(Decimal &out) const noexcept {
+    bool rounded = false, inexact = false;
+    int result = round_value(node_.eval(), out.raw(), &rounded, &inexact);
+    if (result != 0) {
+      detail::raise_flags(S21_FLAG_OVERFLOW);
+    } else if (rounded && !detail::constant_evaluated()) {
+      detail::raise_flags(S21_FLAG_ROUNDED |
+                          (inexact ? S21_FLAG_INEXACT : 0u));
+    }
+    return result;
+  }
+
+  // при ошибке 0
+  constexpr operator Decimal() const noexcept {  // NOLINT: как у Decimal
+    Decimal d;
+    eval(d);
+    return d;
+  }
+
+  constexpr Decimal value() const noexcept { return *this; }
+
+ private:
+  E node_;
+};
+
+// начало выражения: fused(a) * b + c вычисляется с одним округлением
+constexpr Expr<Leaf> fused(const Decimal &d) noexcept {
+  return Expr<Leaf>(Leaf{d});
+}
+
+template <class L, class R>
+constexpr Expr<Mul<L, R>> operator*(const Expr<L> &a,
+                                    const Expr<R> &b) noexcept {
+  return Expr<Mul<L, R>>({a.node(), b.node()});
+}
+template <class L>
+constexpr Expr<Mul<L, Leaf>> operator*(const Expr<L> &a,
+                                       const Decimal &b) noexcept {
+  return a * fused(b);
+}
+template <class R>
+constexpr Expr<Mul<Leaf, R>> operator*(const Decimal &a,
+                                       const Expr<R> &b) noexcept {
+  return fused(a) * b;
+}
+
+template <class L, class R>
+constexpr Expr<AddSub<L, R, false>> operator+(const Expr<L> &a,
+                                              const Expr<R> &b) noexcept {
+  return Expr<AddSub<L, R, false>>({a.node(), b.node()});
+}
+template <class L>
+constexpr Expr<AddSub<L, Leaf, false>> operator+(const Expr<L> &a,
+                                                 const Decimal &b) noexcept {
+  return a + fused(b);
+}
+template <class R>
+constexpr Expr<AddSub<Leaf, R, false>> operator+(const Decimal &a,
+                                                 const Expr<R> &b) noexcept {
+  return fused(a) + b;
+}
+
+template <class L, class R>
+constexpr Expr<AddSub<L, R, true>> operator-(const Expr<L> &a,
+                                             const Expr<R> &b) noexcept {
+  return Expr<AddSub<L, R, true>>({a.node(), b.node()});
+}
+template <class L>
+constexpr Expr<AddSub<L, Leaf, true>> operator-(const Expr<L> &a,
+                                                const Decimal &b) noexcept {
+  return a - fused(b);
+}
+template <class R>
+constexpr Expr<AddSub<Leaf, R, true>> operator-(const Decimal &a,
+                                                const Expr<R> &b) noexcept {
+  return fused(a) - b;
+}
+
+template <class E>
+constexpr Expr<Neg<E>> operator-(const Expr<E> &a) noexcept {
+  return Expr<Neg<E>>({a.node()});
+}
+
+}  // namespace expr
+
+using expr::fused;
+
+}  // namespace s21
+
+#endif
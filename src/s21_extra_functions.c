@@ -1,162 +1,48 @@
 #include "s21_decimal.h"
 
-// получение значения масштаба
-int s21_get_scale(const s21_decimal* d){
-
-  int scale = 0;
-
-  if( d != NULL){
-  uint32_t scale_bit = d->bits[3] & S21_SCALE_MASK;
-
-  scale = (int)(scale_bit >> S21_SCALE_SHIFT);
-  }
-
-  return scale;
-}
-
-// установка значения масштаба
-void s21_set_scale(s21_decimal* d, int s){
-
-  if(d != NULL){
-
-    if(s < 0) s = 0;
-    if(s > S21_SCALE_MAX) s = S21_SCALE_MAX;
-
-    uint32_t clear_bit = (uint32_t)d->bits[3] & ~S21_SCALE_MASK;
-    uint32_t new_scale = (uint32_t)s << S21_SCALE_SHIFT;
-
-    d->bits[3] = (int)(clear_bit | new_scale);
-  }
-}
-
-// получение знака десималь
-int s21_get_sign(const s21_decimal* d) {
-
-  int sign = 0;
-
-  if(d != NULL){
-    if(((uint32_t)d->bits[3] & S21_SIGN_MASK) != 0u) sign = 1;
-  }
-  return sign;
-}
-
-// установка знака 1 - для отрицательного
-void s21_set_sign(s21_decimal* d, int negative){
-
-  if(d != NULL){
-
-    if (negative){
-      d->bits[3] = (int)((uint32_t)d->bits[3] | S21_SIGN_MASK);
-    } else {
-      d->bits[3] = (int)((uint32_t)d->bits[3] & ~S21_SIGN_MASK);
-    }
-  }
-}
-
-// извлечь мантиссу из десималь
-void u96_from_dec(const s21_decimal* d, uint32_t a[3]){
-  a[0] = (uint32_t)d->bits[0];
-  a[1] = (uint32_t)d->bits[1];
-  a[2] = (uint32_t)d->bits[2];
-}
-
-// сохранить 96 бит в десималь
-void u96_to_dec(const uint32_t a[3], s21_decimal* d) {
-  d->bits[0] = (int)a[0];
-  d->bits[1] = (int)a[1];
-  d->bits[2] = (int)a[2];
-}
-
-// комировать 96 бит
-void u96_copy(uint32_t dst[3], const uint32_t src[3]){
-  dst[0] = src[0];
-  dst[1] = src[1];
-  dst[2] = src[2];
-}
-
-// проверка 96 бит числа на 0
-int u96_is_zero(const uint32_t a[3]){
-  return a[0] == 0u && a[1] == 0u && a[2] == 0u;
-}
-
-// сравнение a > b => 1
-int u96_compare(const uint32_t a[3], const uint32_t b[3]){
-
-  int result = 0;
-  if(a[2] != b[2]){
-    if(a[2] > b[2]) result = 1;
-    else result = -1;
-
-  } else if(a[1] != b[1]){
-    if(a[1] > b[1]) result = 1;
-    else result = -1;
-    
-  } else if(a[0] != b[0]){
-    if(a[0] > b[0]) result = 1;
-    else result = -1;
-  }
-
-  return result;
-}
-
-// функция для сложения 96 бит и возвращения переноса(старшего разряда) при сложении 2х больших чисел
-int u96_add(uint32_t a[3], const uint32_t b[3]) {
-  uint64_t с = (uint64_t)a[0] + b[0];
-  a[0] = (uint32_t)с;
-
-  с = (с >> 32) + (uint64_t)a[1] + b[1];
-  a[1] = (uint32_t)с;
-
-  с = (с >> 32) + (uint64_t)a[2] + b[2];
-  a[2] = (uint32_t)с;
-
-  return (int)(с >> 32);
-}
-
-// Функция для вычитания из a величину b и сохранение переноса
-int u96_sub(uint32_t a[3],const uint32_t b[3]){
-  uint64_t c = (uint64_t)a[0] - b[0];
-  a[0] = (uint32_t)c;
-
-  c = (c >> 32) + (uint64_t)a[1] - b[1];
-  a[1] = (uint32_t)c;
-
-  c = (c >> 32) + (uint64_t)a[2] - b[2];
-  a[2] = (uint32_t)c;
-
-  return (c >> 32) ? 1 : 0;
-}
-
-// умножение 96 бит на 10 возврат переноса
-uint32_t u96_mul10(uint32_t a[3]){
-  uint64_t c = (uint64_t)a[0] * 10u;
-  a[0] = (uint32_t)c;
-
-  c = (c >> 32) + (uint64_t)a[1] * 10u;
-  a[1] = (uint32_t)c;
-
-  c = (c >> 32) + (uint64_t)a[2] * 10u;
-  a[2] = (uint32_t)c;
-
-  return (uint32_t)(c >> 32);
-}
-
-// Деление на 10 для 96 бит
-uint32_t u96_div10(uint32_t a[3]){
-
-  uint32_t remain = 0;
-  uint64_t current = 0;
-
-  for(int i = 2; i >= 0; i--){
-    //берем число и добавляем остаток(старший разряд)
-    current = ((uint64_t)remain << 32) | a[i];
-
-    a[i] = (uint32_t)(current / 10); // целая часть
-    remain = (uint32_t)(current % 10); //остаток для следующего разряда
-  }
-
-  return remain;
-}
+// степени десяти 10^0..10^28 в формате 96 бит (младший разряд первым)
+const uint32_t s21_pow10_u96[S21_SCALE_MAX + 1][3] = {
+    {0x00000001u, 0x00000000u, 0x00000000u},  // 1e0
+    {0x0000000Au, 0x00000000u, 0x00000000u},  // 1e1
+    {0x00000064u, 0x00000000u, 0x00000000u},  // 1e2
+    {0x000003E8u, 0x00000000u, 0x00000000u},  // 1e3
+    {0x00002710u, 0x00000000u, 0x00000000u},  // 1e4
+    {0x000186A0u, 0x00000000u, 0x00000000u},  // 1e5
+    {0x000F4240u, 0x00000000u, 0x00000000u},  // 1e6
+    {0x00989680u, 0x00000000u, 0x00000000u},  // 1e7
+    {0x05F5E100u, 0x00000000u, 0x00000000u},  // 1e8
+    {0x3B9ACA00u, 0x00000000u, 0x00000000u},  // 1e9
+    {0x540BE400u, 0x00000002u, 0x00000000u},  // 1e10
+    {0x4876E800u, 0x00000017u, 0x00000000u},  // 1e11
+    {0xD4A51000u, 0x000000E8u, 0x00000000u},  // 1e12
+    {0x4E72A000u, 0x00000918u, 0x00000000u},  // 1e13
+    {0x107A4000u, 0x00005AF3u, 0x00000000u},  // 1e14
+    {0xA4C68000u, 0x00038D7Eu, 0x00000000u},  // 1e15
+    {0x6FC10000u, 0x002386F2u, 0x00000000u},  // 1e16
+    {0x5D8A0000u, 0x01634578u, 0x00000000u},  // 1e17
+    {0xA7640000u, 0x0DE0B6B3u, 0x00000000u},  // 1e18
+    {0x89E80000u, 0x8AC72304u, 0x00000000u},  // 1e19
+    {0x63100000u, 0x6BC75E2Du, 0x00000005u},  // 1e20
+    {0xDEA00000u, 0x35C9ADC5u, 0x00000036u},  // 1e21
+    {0xB2400000u, 0x19E0C9BAu, 0x0000021Eu},  // 1e22
+    {0xF6800000u, 0x02C7E14Au, 0x0000152Du},  // 1e23
+    {0xA1000000u, 0x1BCECCEDu, 0x0000D3C2u},  // 1e24
+    {0x4A000000u, 0x16140148u, 0x00084595u},  // 1e25
+    {0xE4000000u, 0xDCC80CD2u, 0x0052B7D2u},  // 1e26
+    {0xE8000000u, 0x9FD0803Cu, 0x033B2E3Cu},  // 1e27
+    {0x10000000u, 0x3E250261u, 0x204FCE5Eu},  // 1e28
+};
+
+// степени десяти 10^0..10^22 - точно представимы в double
+const double s21_pow10_f64[S21_POW10_F64_MAX + 1] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+#ifndef S21_HEADER_ONLY
+// внешние определения горячих функций (в S21_HEADER_ONLY они static inline)
+#define S21_HELPER
+#include "s21_decimal_inline.h"
+#endif
 
 // проверяет делится ла 96 бит на 10 нацело
 static int u96_divisible_by_10(const uint32_t a[3]){
@@ -227,7 +113,7 @@ int s21_scale_up_one(s21_decimal* d){
     u96_to_dec(a, d);
     s21_set_scale(d,s21_get_scale(d)+1);
   }
-  return  carry & 1u;
+  return carry != 0u;
 }
 
 // Удаление незначащих нулей из мантиссы
@@ -274,4 +160,627 @@ void s21_to_common_scale(s21_decimal* a, s21_decimal* b){
     }
   }
 
-}
\ No newline at end of file
+}
+// количество ведущих нулевых бит в 32 бит слове (x != 0)
+static int u32_clz(uint32_t x){
+#if defined(__GNUC__)
+  return __builtin_clz(x);
+#else
+  int n = 0;
+  while((x & 0x80000000u) == 0u){
+    x <<= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
+// количество значащих разрядов многоразрядного числа
+int uN_len(const uint32_t* a, int n){
+  while(n > 0 && a[n - 1] == 0u) n--;
+  return n;
+}
+
+// разделить многоразрядное число на 10 (ретюрн остаток)
+uint32_t uN_div10(uint32_t* a, int n){
+
+  uint64_t rem = 0u;
+
+  // в столбик от старшего разряда к младшему
+  for(int i = n - 1; i >= 0; i--){
+    uint64_t cur = (rem << 32) | a[i];
+    a[i] = (uint32_t)(cur / 10u);
+    rem = cur % 10u;
+  }
+
+  return (uint32_t)rem;
+}
+
+// прибавить 32 бит число (ретюрн перенос из старшего разряда)
+uint32_t uN_add_small(uint32_t* a, int n, uint32_t add){
+
+  uint64_t carry = add;
+
+  for(int i = 0; i < n && carry; i++){
+    uint64_t cur = (uint64_t)a[i] + carry;
+    a[i] = (uint32_t)cur;
+    carry = cur >> 32;
+  }
+
+  return (uint32_t)carry;
+}
+
+// умножить на 32 бит число (ретюрн старший разряд)
+uint32_t uN_mul_small(uint32_t* a, int n, uint32_t m){
+
+  uint64_t carry = 0u;
+
+  for(int i = 0; i < n; i++){
+    uint64_t cur = (uint64_t)a[i] * m + carry;
+    a[i] = (uint32_t)cur;
+    carry = cur >> 32;
+  }
+
+  return (uint32_t)carry;
+}
+
+// a = a + b (ретюрн перенос)
+uint32_t uN_add(uint32_t* a, const uint32_t* b, int n){
+
+  uint64_t carry = 0u;
+
+  for(int i = 0; i < n; i++){
+    uint64_t cur = (uint64_t)a[i] + b[i] + carry;
+    a[i] = (uint32_t)cur;
+    carry = cur >> 32;
+  }
+
+  return (uint32_t)carry;
+}
+
+// a = a - b (ретюрн заем)
+uint32_t uN_sub(uint32_t* a, const uint32_t* b, int n){
+
+  uint64_t borrow = 0u;
+
+  for(int i = 0; i < n; i++){
+    uint64_t cur = (uint64_t)a[i] - b[i] - borrow;
+    a[i] = (uint32_t)cur;
+    borrow = (cur >> 32) & 1u;
+  }
+
+  return (uint32_t)borrow;
+}
+
+// сравнить 2 числа по n разрядов: -1, 0, 1
+int uN_compare(const uint32_t* a, const uint32_t* b, int n){
+
+  int result = 0;
+
+  for(int i = n - 1; i >= 0 && result == 0; i--){
+    if(a[i] != b[i]) result = a[i] > b[i] ? 1 : -1;
+  }
+
+  return result;
+}
+
+// a = a * 10^k (1 - не поместилось в n разрядов)
+int uN_mul_pow10(uint32_t* a, int n, int k){
+
+  uint32_t carry = 0u;
+
+  for(; k > 0 && carry == 0u; k -= 9){
+    int step = k < 9 ? k : 9;
+    carry = uN_mul_small(a, n, s21_pow10_u96[step][0]);
+  }
+
+  return carry != 0u;
+}
+
+// Сокращение многоразрядного числа до fit разрядов и масштаба max_scale
+/*
+Цифры отбрасываются по одной без округления (последняя и признак
+ненулевых цифр перед ней - sticky), затем одно округление в режиме mode
+(sticky_in - ненулевые цифры, отброшенные еще до вызова, например
+остаток деления). Если округление дало 2^(32 * fit), отбрасывается еще
+одна цифра. Масштаб уменьшается на число отброшенных цифр, флаги
+ROUNDED / INEXACT поднимаются в контексте потока. Возвращает 1, если при
+масштабе 0 число не помещается (a при этом испорчено).
+*/
+int uN_reduce_mode(uint32_t* a, int n, int fit, int* scale, int max_scale, int negative, int sticky_in,
+                   s21_rounding_mode mode){
+
+  int result = 0;
+  int dropped = 0;
+  uint32_t last = 0u;
+  int sticky = sticky_in != 0;
+  int len = uN_len(a, n);
+
+  while(result == 0 && (len > fit || *scale > max_scale)){
+    if(*scale == 0){
+      result = 1;
+    } else {
+      sticky |= last != 0u;
+      last = uN_div10(a, len);
+      len = uN_len(a, len);
+      (*scale)--;
+      dropped = 1;
+    }
+  }
+
+  if(result == 0 && dropped){
+    // последняя цифра и sticky - остаток от деления на 10^2
+    uint32_t rem[3] = {last * 10u + (sticky ? 1u : 0u), 0u, 0u};
+
+    s21_context_raise(S21_FLAG_ROUNDED | (rem[0] ? S21_FLAG_INEXACT : 0u));
+
+    if(s21_round_increment(a, rem, 2, negative, mode)){
+      (void)uN_add_small(a, n, 1u);
+
+      if(uN_len(a, n) > fit){
+        if(*scale == 0){
+          result = 1;
+        } else {
+          rem[0] = uN_div10(a, n);
+          (*scale)--;
+          if(s21_round_increment(a, rem, 1, negative, mode)) (void)uN_add_small(a, n, 1u);
+        }
+      }
+    }
+  }
+
+  return result;
+}
+
+// то же с банковским округлением и без остатка до вызова
+int uN_reduce(uint32_t* a, int n, int fit, int* scale, int max_scale){
+  return uN_reduce_mode(a, n, fit, scale, max_scale, 0, 0, S21_ROUND_HALF_EVEN);
+}
+
+// Мантисса до 128 бит и десятичный порядок в decimal
+/*
+Значение c * 10^q (c - 4 значащих разряда в буфере из 8, q - порядок,
+как в decimal128 и Arrow с масштабом -q). Положительный порядок
+домножает мантиссу, лишние цифры (больше 96 бит или масштаба 28)
+отбрасываются uN_reduce с одним банковским округлением. Возвращает 1,
+если значение не помещается (dst не меняется, флаг OVERFLOW).
+*/
+int s21_coef_to_decimal(uint32_t c[8], int q, int sign, s21_decimal* dst){
+
+  int result = 0;
+  int scale = 0;
+  int zero = uN_len(c, 4) == 0;
+
+  if(q >= 0 && !zero){
+    // 10^29 > 2^96: при q > 28 ненулевое значение не помещается
+    result = q > S21_SCALE_MAX || uN_mul_pow10(c, 8, q) || uN_len(c, 8) > 3;
+  } else if(q < 0){
+    scale = -q;
+    if(scale > S21_SCALE_MAX + 40){
+      // 2^128 < 10^39: отбрасываются все цифры и их меньше половины единицы
+      s21_context_raise(S21_FLAG_ROUNDED | (zero ? 0u : S21_FLAG_INEXACT));
+      c[0] = c[1] = c[2] = c[3] = 0u;
+      scale = S21_SCALE_MAX;
+    } else {
+      result = uN_reduce(c, 4, 3, &scale, S21_SCALE_MAX);
+    }
+  }
+
+  if(result){
+    s21_context_raise(S21_FLAG_OVERFLOW);
+  } else {
+    dst->bits[3] = 0;
+    u96_to_dec(c, dst);
+    s21_set_scale(dst, scale);
+    s21_set_sign(dst, sign);
+  }
+
+  return result;
+}
+
+// количество значащих бит 96 бит числа (0 для нуля)
+int u96_bit_length(const uint32_t a[3]){
+
+  int n = uN_len(a, 3);
+  int bits = 0;
+
+  if(n > 0) bits = n * 32 - u32_clz(a[n - 1]);
+
+  return bits;
+}
+
+// Деление многоразрядного числа u (m разрядов) на v (n разрядов)
+/*
+Алгоритм D Кнута: частное q (m - n + 1 разрядов) и остаток r (n разрядов)
+за один проход вместо побитового деления. Требуется m >= n, v[n - 1] != 0
+и n, m <= S21_UN_MAX_LIMBS.
+*/
+void uN_divmod(const uint32_t* u, int m, const uint32_t* v, int n, uint32_t* q, uint32_t* r){
+
+  const uint64_t base = 0x100000000ull;
+
+  if(n == 1){
+    // короткое деление на одно 32 бит слово
+    uint64_t rem = 0;
+    for(int j = m - 1; j >= 0; j--){
+      uint64_t cur = (rem << 32) | u[j];
+      q[j] = (uint32_t)(cur / v[0]);
+      rem = cur % v[0];
+    }
+    r[0] = (uint32_t)rem;
+  } else {
+    uint32_t un[S21_UN_MAX_LIMBS + 1];
+    uint32_t vn[S21_UN_MAX_LIMBS];
+
+    // нормализуем - старший бит делителя должен быть 1
+    int s = u32_clz(v[n - 1]);
+
+    for(int i = n - 1; i > 0; i--)
+      vn[i] = (v[i] << s) | (uint32_t)((uint64_t)v[i - 1] >> (32 - s));
+    vn[0] = v[0] << s;
+
+    un[m] = (uint32_t)((uint64_t)u[m - 1] >> (32 - s));
+    for(int i = m - 1; i > 0; i--)
+      un[i] = (u[i] << s) | (uint32_t)((uint64_t)u[i - 1] >> (32 - s));
+    un[0] = u[0] << s;
+
+    for(int j = m - n; j >= 0; j--){
+
+      // оценка очередной цифры частного по двум старшим разрядам
+      uint64_t top = ((uint64_t)un[j + n] << 32) | un[j + n - 1];
+      uint64_t qhat = top / vn[n - 1];
+      uint64_t rhat = top % vn[n - 1];
+
+      while(qhat >= base || qhat * vn[n - 2] > ((rhat << 32) | un[j + n - 2])){
+        qhat--;
+        rhat += vn[n - 1];
+        if(rhat >= base) break;
+      }
+
+      // вычитаем qhat * v из текущего окна делимого
+      int64_t borrow = 0;
+      int64_t t;
+      for(int i = 0; i < n; i++){
+        uint64_t p = qhat * vn[i];
+        t = (int64_t)un[i + j] - borrow - (int64_t)(p & 0xFFFFFFFFu);
+        un[i + j] = (uint32_t)t;
+        borrow = (int64_t)(p >> 32) - (t >> 32);
+      }
+      t = (int64_t)un[j + n] - borrow;
+      un[j + n] = (uint32_t)t;
+
+      q[j] = (uint32_t)qhat;
+
+      // оценка оказалась на 1 больше - возвращаем делитель обратно
+      if(t < 0){
+        q[j]--;
+        uint64_t carry = 0;
+        for(int i = 0; i < n; i++){
+          uint64_t c = (uint64_t)un[i + j] + vn[i] + carry;
+          un[i + j] = (uint32_t)c;
+          carry = c >> 32;
+        }
+        un[j + n] += (uint32_t)carry;
+      }
+    }
+
+    // денормализуем остаток
+    for(int i = 0; i < n - 1; i++)
+      r[i] = (un[i] >> s) | (uint32_t)((uint64_t)un[i + 1] << (32 - s));
+    r[n - 1] = un[n - 1] >> s;
+  }
+}
+
+// обратные степени десяти floor(2^(127 + e) / 10^k), e = ceil(log2(10^k)):
+// 128 бит со старшим битом 1 (младший разряд первым)
+static const uint32_t s21_recip_pow10_u128[S21_SCALE_MAX + 1][4] = {
+    {0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u},  // 1e0
+    {0xCCCCCCCCu, 0xCCCCCCCCu, 0xCCCCCCCCu, 0xCCCCCCCCu},  // 1e1
+    {0x0A3D70A3u, 0x3D70A3D7u, 0x70A3D70Au, 0xA3D70A3Du},  // 1e2
+    {0x083126E9u, 0x645A1CACu, 0x8D4FDF3Bu, 0x83126E97u},  // 1e3
+    {0x404EA4A8u, 0xD3C36113u, 0xE219652Bu, 0xD1B71758u},  // 1e4
+    {0x33721D53u, 0x0FCF80DCu, 0x1B478423u, 0xA7C5AC47u},  // 1e5
+    {0xC2C1B10Fu, 0xA63F9A49u, 0xAF6C69B5u, 0x8637BD05u},  // 1e6
+    {0x04691B4Cu, 0x3D329076u, 0xE57A42BCu, 0xD6BF94D5u},  // 1e7
+    {0x36BA7C3Du, 0xFDC20D2Bu, 0x8461CEFCu, 0xABCC7711u},  // 1e8
+    {0xF8953030u, 0x31680A88u, 0x36B4A597u, 0x89705F41u},  // 1e9
+    {0x5A884D1Bu, 0xB573440Eu, 0xBDEDD5BEu, 0xDBE6FECEu},  // 1e10
+    {0x1539D748u, 0xF78F69A5u, 0xCB24AAFEu, 0xAFEBFF0Bu},  // 1e11
+    {0x442E45D3u, 0xF93F87B7u, 0x6F5088CBu, 0x8CBCCC09u},  // 1e12
+    {0x06B06FB9u, 0x2865A5F2u, 0x4BB40E13u, 0xE12E1342u},  // 1e13
+    {0x9EF38C94u, 0x538484C1u, 0x095CD80Fu, 0xB424DC35u},  // 1e14
+    {0x4BF60A10u, 0x0F9D3701u, 0x3AB0ACD9u, 0x901D7CF7u},  // 1e15
+    {0x7989A9B3u, 0x4C2EBE68u, 0xC44DE15Bu, 0xE69594BEu},  // 1e16
+    {0xFAD487C2u, 0x09BEFEB9u, 0x36A4B449u, 0xB877AA32u},  // 1e17
+    {0x62439FCFu, 0x3AFF322Eu, 0x921D5D07u, 0x9392EE8Eu},  // 1e18
+    {0xD06C32E5u, 0x2B31E9E3u, 0xB69561A5u, 0xEC1E4A7Du},  // 1e19
+    {0xA6BCF584u, 0x88F4BB1Cu, 0x92111AEAu, 0xBCE50864u},  // 1e20
+    {0xEBCA5E03u, 0xD3F6FC16u, 0x74DA7BEEu, 0x971DA050u},  // 1e21
+    {0x12DD6338u, 0x5324C68Bu, 0xBAF72CB1u, 0xF1C90080u},  // 1e22
+    {0x0F178293u, 0x75B7053Cu, 0x95928A27u, 0xC16D9A00u},  // 1e23
+    {0x72793542u, 0xC4926A96u, 0x44753B52u, 0x9ABE14CDu},  // 1e24
+    {0x83F52204u, 0x3A83DDBDu, 0xD3EEC551u, 0xF79687AEu},  // 1e25
+    {0x032A819Du, 0x95364AFEu, 0x76589DDAu, 0xC6120625u},  // 1e26
+    {0xCF55347Du, 0x775EA264u, 0x91E07E48u, 0x9E74D1B7u},  // 1e27
+    {0x188853FCu, 0x8BCA9D6Eu, 0x8300CA0Du, 0xFD87B5F2u},  // 1e28
+};
+
+// Частное m / 10^scale умножением на обратное, 1 - округление не определено
+/*
+P = m * R (R из s21_recip_pow10_u128), m / 10^scale = X / 2^(127 + e),
+где X лежит в [P, P + m): R меньше точного обратного не больше чем на 1.
+В старших 128 битах P (T) это интервал [T, T + 3). Если в нем нет
+середины между соседними числами из bits бит, округление к ближайшему
+четному однозначно, иначе (точная середина или очень близко к ней) нужно
+точное деление. Для масштаба 0 R = 2^127 точно и X = P.
+*/
+// количество значащих бит 64 бит числа
+static int u64_bit_length(uint64_t x){
+
+  int bits = 0;
+
+  if(x >> 32 != 0u) bits = 64 - u32_clz((uint32_t)(x >> 32));
+  else if(x != 0u) bits = 32 - u32_clz((uint32_t)x);
+
+  return bits;
+}
+
+// P = m * r (96 на 128 бит) в 64 бит словах, младшее первым
+static void u96_mul_u128(const uint32_t m[3], const uint32_t r[4], uint64_t w[4]){
+
+#ifdef __SIZEOF_INT128__
+  uint64_t m_lo = ((uint64_t)m[1] << 32) | m[0];
+  uint64_t r_lo = ((uint64_t)r[1] << 32) | r[0];
+  uint64_t r_hi = ((uint64_t)r[3] << 32) | r[2];
+  unsigned __int128 ll = (unsigned __int128)m_lo * r_lo;
+  unsigned __int128 lh = (unsigned __int128)m_lo * r_hi;
+  unsigned __int128 hl = (unsigned __int128)m[2] * r_lo;
+  unsigned __int128 hh = (unsigned __int128)m[2] * r_hi;
+  unsigned __int128 mid = (ll >> 64) + (uint64_t)lh + (uint64_t)hl;
+  unsigned __int128 top = (mid >> 64) + (lh >> 64) + (hl >> 64) + hh;
+
+  w[0] = (uint64_t)ll;
+  w[1] = (uint64_t)mid;
+  w[2] = (uint64_t)top;
+  w[3] = (uint64_t)(top >> 64);
+#else
+  uint32_t p[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+
+  for(int i = 0; i < 3; i++){
+    uint64_t carry = 0;
+    for(int j = 0; j < 4; j++){
+      uint64_t cur = (uint64_t)p[i + j] + (uint64_t)m[i] * r[j] + carry;
+      p[i + j] = (uint32_t)cur;
+      carry = cur >> 32;
+    }
+    p[i + 4] = (uint32_t)carry;
+  }
+  for(int i = 0; i < 4; i++) w[i] = ((uint64_t)p[2 * i + 1] << 32) | p[2 * i];
+#endif
+}
+
+static int decimal_to_binary_recip(const uint32_t m[3], int scale, int e, int bits, uint64_t* mant, int* exp2){
+
+  int result = 0;
+  uint64_t w[5];
+  u96_mul_u128(m, s21_recip_pow10_u128[scale], w);
+  w[4] = 0u;
+
+  // P >= 2^127, старшие 128 бит (hi, lo) - со сдвигом sh <= 95
+  int top = w[3] != 0u ? 3 : 2;
+  int sh = top * 64 + u64_bit_length(w[top]) - 128;
+  int k = sh / 64;
+  int off = sh % 64;
+  uint64_t lo = w[k] >> off;
+  uint64_t hi = w[k + 1] >> off;
+  if(off != 0){
+    lo |= w[k + 1] << (64 - off);
+    hi |= w[k + 2] << (64 - off);
+  }
+
+  int drop = 64 - bits;
+  uint64_t res = hi >> drop;
+  uint64_t rest = hi & ((1ull << drop) - 1u);
+  uint64_t half = 1ull << (drop - 1);
+
+  if(scale == 0){
+    if(rest > half || (rest == half && (lo != 0u || (res & 1u)))) res++;
+  } else if(rest >= half){
+    // X > P: остаток строго больше середины
+    res++;
+  } else if(rest == half - 1u && lo >= UINT64_MAX - 3u){
+    result = 1;
+  }
+
+  int exp = sh + 64 + drop - 127 - e;
+
+  // округление дало лишний разряд (1.111 -> 10.000)
+  if(res >> bits){
+    res >>= 1;
+    exp++;
+  }
+
+  *mant = res;
+  *exp2 = exp;
+
+  return result;
+}
+
+// Частное m / 10^scale точным делением (алгоритм D), округленное до bits бит
+/*
+Мантисса 96 бит сдвигается влево так, чтобы частное от деления на 10^scale
+имело не меньше 64 бит, затем частное округляется к ближайшему четному
+с учетом всех отброшенных бит (остатка и младших бит частного).
+*/
+static void decimal_to_binary_div(const uint32_t m[3], int scale, int bits, uint64_t* mant, int* exp2){
+
+  const uint32_t* p = s21_pow10_u96[scale];
+  int pl = uN_len(p, 3);
+  int pbits = u96_bit_length(p);
+  int mbits = u96_bit_length(m);
+
+  // сдвиг делимого, чтобы в частном было не меньше 64 бит
+  int e = 64 + pbits - mbits;
+  if(e < 0) e = 0;
+
+  uint32_t num[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+  int limb = e / 32;
+  int off = e % 32;
+  for(int i = 0; i < 3; i++){
+    num[i + limb] |= m[i] << off;
+    if(off != 0) num[i + limb + 1] |= m[i] >> (32 - off);
+  }
+
+  uint32_t q[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+  uint32_t r[3] = {0, 0, 0};
+  uN_divmod(num, uN_len(num, 8), p, pl, q, r);
+
+  int sticky = uN_len(r, pl) != 0;
+
+  // берем старшие 64 бита частного (в частном от 64 до 96 бит)
+  int sh = u96_bit_length(q) - 64;
+  uint64_t lo = ((uint64_t)q[1] << 32) | q[0];
+  uint64_t top = lo;
+
+  if(sh > 0){
+    top = (lo >> sh) | ((uint64_t)q[2] << (64 - sh));
+    if((lo & ((1ull << sh) - 1u)) != 0u) sticky = 1;
+  }
+
+  // округляем до bits значащих бит к ближайшему четному
+  int drop = 64 - bits;
+  uint64_t res = top >> drop;
+  uint64_t rest = top & ((1ull << drop) - 1u);
+  uint64_t half = 1ull << (drop - 1);
+
+  if(rest > half || (rest == half && (sticky || (res & 1u)))) res++;
+
+  int exp = sh - e + drop;
+
+  // округление дало лишний разряд (1.111 -> 10.000)
+  if(res >> bits){
+    res >>= 1;
+    exp++;
+  }
+
+  *mant = res;
+  *exp2 = exp;
+}
+
+// Перевод decimal в двоичное число с плавающей точкой с заданным числом бит мантиссы
+/*
+Значение = mant * 2^exp2, mant содержит ровно bits значащих бит (bits <= 63).
+Частное мантиссы и 10^scale считается умножением на обратное
+(decimal_to_binary_recip), точное деление нужно только если частное почти
+точно посередине между соседними двоичными числами. Результат корректно
+округлен к ближайшему четному, без pow и деления чисел с плавающей точкой.
+Мантисса decimal не должна быть нулем, масштаб <= 28.
+*/
+void s21_decimal_to_binary(const s21_decimal* d, int bits, uint64_t* mant, int* exp2){
+
+  uint32_t m[3];
+  u96_from_dec(d, m);
+
+  int scale = s21_get_scale(d);
+  int e = scale > 0 ? u96_bit_length(s21_pow10_u96[scale]) : 0;
+
+  if(decimal_to_binary_recip(m, scale, e, bits, mant, exp2)) decimal_to_binary_div(m, scale, bits, mant, exp2);
+}
+
+// Деление 96 бит числа на 10^k (k <= 28) за один шаг
+/*
+a = a / 10^k, rem = a % 10^k. Делитель берется из таблицы степеней:
+при старшем разряде 0 и k <= 19 хватает одного 64 бит деления,
+иначе используется uN_divmod.
+*/
+void u96_divmod_pow10(uint32_t a[3], int k, uint32_t rem[3]){
+
+  rem[0] = rem[1] = rem[2] = 0u;
+
+  if(k > 0){
+    const uint32_t* p = s21_pow10_u96[k];
+
+    if(a[2] == 0u && k <= 19){
+      uint64_t n = ((uint64_t)a[1] << 32) | a[0];
+      uint64_t d = ((uint64_t)p[1] << 32) | p[0];
+      uint64_t q = n / d;
+      uint64_t r = n - q * d;
+
+      a[0] = (uint32_t)q;
+      a[1] = (uint32_t)(q >> 32);
+      rem[0] = (uint32_t)r;
+      rem[1] = (uint32_t)(r >> 32);
+    } else {
+      int pl = uN_len(p, 3);
+      int al = uN_len(a, 3);
+      uint32_t q[3] = {0, 0, 0};
+
+      if(al >= pl){
+        uN_divmod(a, al, p, pl, q, rem);
+      } else {
+        // делимое меньше делителя - частное 0, остаток само число
+        u96_copy(rem, a);
+      }
+      u96_copy(a, q);
+    }
+  }
+}
+
+// Умножение 96 бит числа на 10^k (k <= 28), 1 - переполнение (a не меняется)
+int u96_mul_pow10(uint32_t a[3], int k){
+
+  int result = 0;
+
+  if(k > 0){
+    const uint32_t* p = s21_pow10_u96[k];
+    uint32_t prod[6] = {0, 0, 0, 0, 0, 0};
+
+    for(int i = 0; i < 3; i++){
+      uint64_t carry = 0;
+      for(int j = 0; j < 3; j++){
+        uint64_t cur = (uint64_t)prod[i + j] + (uint64_t)a[i] * p[j] + carry;
+        prod[i + j] = (uint32_t)cur;
+        carry = cur >> 32;
+      }
+      prod[i + 3] = (uint32_t)carry;
+    }
+
+    if(prod[3] != 0u || prod[4] != 0u || prod[5] != 0u){
+      result = 1;
+    } else {
+      u96_copy(a, prod);
+    }
+  }
+
+  return result;
+}
+
+// Нужно ли увеличить модуль частного на 1 после деления на 10^k
+/*
+q - частное, rem - остаток от деления модуля на 10^k (k <= 28),
+negative - знак числа. Направленные режимы смотрят только на то,
+есть ли остаток, режимы "к ближайшему" сравнивают 2 * rem с 10^k.
+*/
+int s21_round_increment(const uint32_t q[3], const uint32_t rem[3], int k, int negative, s21_rounding_mode mode){
+
+  int inc = 0;
+
+  if(!u96_is_zero(rem)){
+    if(mode == S21_ROUND_UP) inc = 1;
+    else if(mode == S21_ROUND_FLOOR) inc = negative;
+    else if(mode == S21_ROUND_CEILING) inc = !negative;
+    else if(mode != S21_ROUND_DOWN){
+      // остаток < 10^28 < 2^94, удвоение помещается в 96 бит
+      uint32_t twice[3];
+      u96_copy(twice, rem);
+      (void)u96_add(twice, rem);
+      int cmp = u96_compare(twice, s21_pow10_u96[k]);
+
+      if(cmp > 0) inc = 1;
+      else if(cmp == 0 && mode == S21_ROUND_HALF_UP) inc = 1;
+      else if(cmp == 0 && mode == S21_ROUND_HALF_EVEN) inc = (q[0] & 1u) != 0u;
+    }
+  }
+
+  return inc;
+}
@@ -0,0 +1,413 @@
+/**
+ * @file s21_fixed.hpp
+ * @brief Десятичное число с масштабом, известным на этапе компиляции
+ * @details s21::Fixed<Scale> хранит только 96-битную мантиссу и знак,
+ *          масштаб - параметр шаблона (центы: Fixed<2>, базисные пункты:
+ *          Fixed<4>). Сложение и сравнение чисел одного масштаба не
+ *          разбирают bits[3] и не выравнивают масштабы, для разных
+ *          масштабов множитель 10^k вычисляется при компиляции. Перевод
+ *          в s21_decimal без потерь, обратно - с округлением к четному,
+ *          если у исходного числа больше знаков после точки.
+ *
+ *          Все операции кроме деления constexpr. Ошибки как у
+ *          s21::Decimal: результат 0 и флаги S21_FLAG_OVERFLOW /
+ *          S21_FLAG_DIV_BY_ZERO в контексте потока; переполнение при
+ *          вычислении на этапе компиляции - ошибка компиляции.
+ */
+
+#ifndef S21_FIXED_HPP
+#define S21_FIXED_HPP
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "s21_decimal.hpp"
+#include "s21_wide.hpp"
+
+namespace s21 {
+
+namespace detail {
+
+// мантисса числа с масштабом From в масштабе To, 1 при переполнении
+template <int To, int From>
+constexpr int rescale_mag(uint_n<3> &mag, bool *inexact) noexcept {
+  int overflow = 0;
+  if constexpr (To > From) {
+    overflow = wide_mul_pow10(mag, To - From);
+  } else if constexpr (To < From) {
+    bool lost = wide_div_pow10_round(mag, From - To) != 0;
+    if (inexact) *inexact = lost;
+  }
+  return overflow;
+}
+
+// то же для масштаба From, известного только при выполнении (0..28),
+// 1 при переполнении или масштабе вне диапазона
+template <int To, int... K>
+int rescale_mag_from(uint_n<3> &mag, int from, bool *inexact,
+                     std::integer_sequence<int, K...>) noexcept {
+  int result = 1;
+  ((from == K ? (result = rescale_mag<To, K>(mag, inexact)) : 0), ...);
+  return result;
+}
+
+}  // namespace detail
+
+template <int Scale>
+class Fixed {
+  static_assert(Scale >= 0 && Scale <= S21_SCALE_MAX,
+                "масштаб должен быть от 0 до 28");
+
+ public:
+  using mag_type = detail::uint_n<3>;
+  static constexpr int scale = Scale;
+
+  constexpr Fixed() noexcept : mag_{}, neg_(false) {}
+
+  // целое: Fixed<2>(5) = 5.00
+  template <class T, typename std::enable_if<std::is_integral<T>::value &&
+                                                 !std::is_same<T, bool>::value,
+                                             int>::type = 0>
+  constexpr Fixed(T v) noexcept : Fixed() {  // NOLINT: неявное как у целых
+    bool negative = v < 0;
+    mag_ = detail::wide_from_u64<3>(magnitude_of(v));
+    if (detail::wide_mul_pow10(mag_, Scale)) {
+      overflow();
+    } else {
+      neg_ = negative && !is_zero();
+    }
+  }
+
+  // число единиц младшего разряда: Fixed<2>::from_units(1999) = 19.99
+  static constexpr Fixed from_units(int64_t units) noexcept {
+    return from_magnitude(detail::wide_from_u64<3>(magnitude_of(units)),
+                          units < 0);
+  }
+
+  static constexpr Fixed from_magnitude(const mag_type &mag,
+                                        bool negative) noexcept {
+    Fixed f;
+    f.mag_ = mag;
+    f.neg_ = negative && !detail::wide_is_zero(mag);
+    return f;
+  }
+
+  // s21_decimal в масштаб Scale: 0 - успех, 1 - не помещается в 96 бит
+  // (out не меняется); лишние знаки округляются к четному
+  static int from_decimal(const s21_decimal &src, Fixed &out) noexcept {
+    mag_type mag = detail::wide_from_decimal<3>(src);
+    bool inexact = false;
+    int result = detail::rescale_mag_from<Scale>(
+        mag, s21_get_scale(&src), &inexact,
+        std::make_integer_sequence<int, S21_SCALE_MAX + 1>());
+
+    if (result == 0) {
+      out = from_magnitude(mag, s21_get_sign(&src) != 0);
+      if (s21_get_scale(&src) > Scale) round_flags(inexact);
+    }
+    return result;
+  }
+
+  explicit Fixed(const Decimal &d) noexcept : Fixed() {
+    if (from_decimal(d.raw(), *this) != 0) overflow();
+  }
+
+  // без потерь: та же мантисса, масштаб Scale
+  constexpr s21_decimal to_decimal() const noexcept {
+    s21_decimal d{{static_cast<int>(mag_.w[0]), static_cast<int>(mag_.w[1]),
+                   static_cast<int>(mag_.w[2]),
+                   static_cast<int>((static_cast<uint32_t>(Scale) << 16) |
+                                    (neg_ ? S21_SIGN_MASK : 0u))}};
+    return d;
+  }
+
+  explicit operator Decimal() const noexcept { return Decimal(to_decimal()); }
+
+  // другой масштаб: больший - точно, меньший - с округлением к четному
+  template <int R>
+  constexpr Fixed<R> rescale() const noexcept {
+    mag_type mag = mag_;
+    bool inexact = false;
+    Fixed<R> r;
+    if (detail::rescale_mag<R, Scale>(mag, &inexact)) {
+      r.overflow();
+    } else {
+      r = Fixed<R>::from_magnitude(mag, neg_);
+      if constexpr (R < Scale) round_flags(inexact);
+    }
+    return r;
+  }
+
+  constexpr const mag_type &magnitude() const noexcept { return mag_; }
+  constexpr bool is_negative() const noexcept { return neg_; }
+  constexpr bool is_zero() const noexcept {
+    return detail::wide_is_zero(mag_);
+  }
+
+  constexpr Fixed operator-() const noexcept {
+    return from_magnitude(mag_, !neg_);
+  }
+  constexpr Fixed operator+() const noexcept { return *this; }
+
+  constexpr Fixed &operator+=(const Fixed &o) noexcept {
+    if (detail::wide_signed_add(mag_, neg_, o.mag_, o.neg_)) overflow();
+    return *this;
+  }
+  constexpr Fixed &operator-=(const Fixed &o) noexcept {
+    if (detail::wide_signed_add(mag_, neg_, o.mag_, !o.neg_)) overflow();
+    return *this;
+  }
+
+  // умножение на целое (цена * количество) - масштаб не меняется
+  constexpr Fixed &operator*=(int64_t n) noexcept {
+    bool lost = false;
+    mag_ = detail::wide_resize<3>(
+        detail::wide_mul(mag_, detail::wide_from_u64<2>(magnitude_of(n))),
+        &lost);
+    neg_ = neg_ != (n < 0) && !is_zero();
+    if (lost) overflow();
+    return *this;
+  }
+
+  Fixed &operator/=(const Fixed &o) noexcept;
+
+  friend constexpr Fixed operator+(Fixed a, const Fixed &b) noexcept {
+    return a += b;
+  }
+  friend constexpr Fixed operator-(Fixed a, const Fixed &b) noexcept {
+    return a -= b;
+  }
+  friend constexpr Fixed operator*(Fixed a, int64_t n) noexcept {
+    return a *= n;
+  }
+  friend constexpr Fixed operator*(int64_t n, Fixed a) noexcept {
+    return a *= n;
+  }
+  friend Fixed operator/(Fixed a, const Fixed &b) noexcept { return a /= b; }
+
+  // одинаковый масштаб: сравнение знаков и мантисс без выравнивания
+  friend constexpr int compare(const Fixed &a, const Fixed &b) noexcept {
+    int result = 0;
+    if (a.neg_ != b.neg_) {
+      result = a.neg_ ? -1 : 1;
+    } else {
+      result = detail::wide_cmp(a.mag_, b.mag_);
+      if (a.neg_) result = -result;
+    }
+    return result;
+  }
+
+  friend constexpr bool operator==(const Fixed &a, const Fixed &b) noexcept {
+    return a.neg_ == b.neg_ && detail::wide_cmp(a.mag_, b.mag_) == 0;
+  }
+  friend constexpr bool operator!=(const Fixed &a, const Fixed &b) noexcept {
+    return !(a == b);
+  }
+  friend constexpr bool operator<(const Fixed &a, const Fixed &b) noexcept {
+    return compare(a, b) < 0;
+  }
+  friend constexpr bool operator<=(const Fixed &a, const Fixed &b) noexcept {
+    return compare(a, b) <= 0;
+  }
+  friend constexpr bool operator>(const Fixed &a, const Fixed &b) noexcept {
+    return compare(a, b) > 0;
+  }
+  friend constexpr bool operator>=(const Fixed &a, const Fixed &b) noexcept {
+    return compare(a, b) >= 0;
+  }
+
+ private:
+  template <int>
+  friend class Fixed;
+
+  template <class T>
+  static constexpr uint64_t magnitude_of(T v) noexcept {
+    uint64_t u = static_cast<uint64_t>(v);
+    if constexpr (std::is_signed<T>::value) {
+      if (v < 0) u = 0u - u;
+    }
+    return u;
+  }
+
+  // результат 0 и флаг переполнения
+  constexpr void overflow() noexcept {
+    *this = Fixed();
+    detail::raise_flags(S21_FLAG_OVERFLOW);
+  }
+
+  static constexpr void round_flags(bool inexact) noexcept {
+    if (!detail::constant_evaluated())
+      detail::raise_flags(S21_FLAG_ROUNDED |
+                          (inexact ? S21_FLAG_INEXACT : 0u));
+  }
+
+  mag_type mag_;
+  bool neg_;  // false для нуля
+};
+
+// сумма и разность с разными масштабами - в большем масштабе
+template <int A, int B>
+constexpr Fixed<(A > B ? A : B)> operator+(const Fixed<A> &a,
+                                           const Fixed<B> &b) noexcept {
+  constexpr int R = A > B ? A : B;
+  return a.template rescale<R>() + b.template rescale<R>();
+}
+
+template <int A, int B>
+constexpr Fixed<(A > B ? A : B)> operator-(const Fixed<A> &a,
+                                           const Fixed<B> &b) noexcept {
+  constexpr int R = A > B ? A : B;
+  return a.template rescale<R>() - b.template rescale<R>();
+}
+
+// произведение в масштабе R: точное в 192 битах, затем одно округление
+template <int R, int A, int B>
+constexpr Fixed<R> mul(const Fixed<A> &a, const Fixed<B> &b) noexcept {
+  detail::uint_n<6> p = detail::wide_mul(a.magnitude(), b.magnitude());
+  bool inexact = false;
+  int overflow = 0;
+
+  if constexpr (R > A + B) {
+    overflow = detail::wide_mul_pow10(p, R - A - B);
+  } else if constexpr (R < A + B) {
+    inexact = detail::wide_div_pow10_round(p, A + B - R) != 0;
+  }
+
+  bool lost = false;
+  Fixed<R> r = Fixed<R>::from_magnitude(detail::wide_resize<3>(p, &lost),
+                                        a.is_negative() != b.is_negative());
+  if (overflow || lost) {
+    r = Fixed<R>();
+    detail::raise_flags(S21_FLAG_OVERFLOW);
+  } else if (R < A + B && !detail::constant_evaluated()) {
+    detail::raise_flags(S21_FLAG_ROUNDED | (inexact ? S21_FLAG_INEXACT : 0u));
+  }
+  return r;
+}
+
+// точное произведение: масштаб складывается
+template <int A, int B>
+constexpr Fixed<A + B> operator*(const Fixed<A> &a,
+                                 const Fixed<B> &b) noexcept {
+  static_assert(A + B <= S21_SCALE_MAX,
+                "масштаб произведения больше 28, используйте mul<R>");
+  return mul<A + B>(a, b);
+}
+
+// частное в масштабе R с округлением к четному
+template <int R, int A, int B>
+Fixed<R> div(const Fixed<A> &a, const Fixed<B> &b) noexcept {
+  // a / b * 10^R = (a * 10^(R - A + B)) / b в единицах мантисс
+  constexpr int e = R - A + B;
+  detail::uint_n<9> num{};
+  detail::uint_n<6> den{};
+  Fixed<R> r;
+
+  if constexpr (e >= 0) {
+    num = detail::wide_resize<9>(
+        detail::wide_mul(a.magnitude(), detail::wide_pow10<6>(e)), nullptr);
+    den = detail::wide_resize<6>(b.magnitude(), nullptr);
+  } else {
+    num = detail::wide_resize<9>(a.magnitude(), nullptr);
+    den = detail::wide_mul(b.magnitude(), detail::wide_pow10<3>(-e));
+  }
+
+  int m = detail::wide_len(num);
+  int n = detail::wide_len(den);
+
+  if (n == 0) {
+    detail::raise_flags(S21_FLAG_DIV_BY_ZERO);
+  } else if (m >= n) {
+    detail::uint_n<9> q{};
+    detail::uint_n<6> rem{};
+    uN_divmod(num.w, m, den.w, n, q.w, rem.w);
+
+    // половина делителя: rem > den - rem или ровно половина и q нечетное
+    detail::uint_n<6> rest = den;
+    detail::wide_sub(rest, rem);
+    int half = detail::wide_cmp(rem, rest);
+    if (half > 0 || (half == 0 && (q.w[0] & 1u))) {
+      detail::wide_add(q, detail::wide_from_u64<9>(1u));
+    }
+
+    bool lost = false;
+    r = Fixed<R>::from_magnitude(detail::wide_resize<3>(q, &lost),
+                                 a.is_negative() != b.is_negative());
+    if (lost) {
+      r = Fixed<R>();
+      detail::raise_flags(S21_FLAG_OVERFLOW);
+    } else if (!detail::wide_is_zero(rem)) {
+      detail::raise_flags(S21_FLAG_ROUNDED | S21_FLAG_INEXACT);
+    }
+  } else if (m > 0) {
+    // |num| < |den|: частное 0 или 1 после округления
+    detail::uint_n<6> num6 = detail::wide_resize<6>(num, nullptr);
+    detail::uint_n<6> rest = den;
+    detail::wide_sub(rest, num6);
+    if (detail::wide_cmp(num6, rest) > 0) {
+      r = Fixed<R>::from_magnitude(detail::wide_from_u64<3>(1u),
+                                   a.is_negative() != b.is_negative());
+    }
+    detail::raise_flags(S21_FLAG_ROUNDED | S21_FLAG_INEXACT);
+  }
+  return r;
+}
+
+template <int Scale>
+Fixed<Scale> &Fixed<Scale>::operator/=(const Fixed &o) noexcept {
+  return *this = div<Scale>(*this, o);
+}
+
+// сравнение разных масштабов: меньший домножается на 10^k в 192 битах
+template <int A, int B>
+constexpr int compare(const Fixed<A> &a, const Fixed<B> &b) noexcept {
+  detail::uint_n<6> x = detail::wide_resize<6>(a.magnitude(), nullptr);
+  detail::uint_n<6> y = detail::wide_resize<6>(b.magnitude(), nullptr);
+  if constexpr (A < B) detail::wide_mul_pow10(x, B - A);
+  if constexpr (B < A) detail::wide_mul_pow10(y, A - B);
+
+  int result = 0;
+  if (a.is_negative() != b.is_negative()) {
+    result = a.is_negative() ? -1 : 1;
+  } else {
+    result = detail::wide_cmp(x, y);
+    if (a.is_negative()) result = -result;
+  }
+  return result;
+}
+
+template <int A, int B>
+constexpr bool operator==(const Fixed<A> &a, const Fixed<B> &b) noexcept {
+  return compare(a, b) == 0;
+}
+template <int A, int B>
+constexpr bool operator!=(const Fixed<A> &a, const Fixed<B> &b) noexcept {
+  return compare(a, b) != 0;
+}
+template <int A, int B>
+constexpr bool operator<(const Fixed<A> &a, const Fixed<B> &b) noexcept {
+  return compare(a, b) < 0;
+}
+template <int A, int B>
+constexpr bool operator<=(const Fixed<A> &a, const Fixed<B> &b) noexcept {
+  return compare(a, b) <= 0;
+}
+template <int A, int B>
+constexpr bool operator>(const Fixed<A> &a, const Fixed<B> &b) noexcept {
+  return compare(a, b) > 0;
+}
+template <int A, int B>
+constexpr bool operator>=(const Fixed<A> &a, const Fixed<B> &b) noexcept {
+  return compare(a, b) >= 0;
+}
+
+template <int Scale>
+inline std::string to_string(const Fixed<Scale> &v) {
+  return to_string(Decimal(v.to_decimal()));
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,256 @@
+/**
+ * @file s21_wide.hpp
+ * @brief constexpr беззнаковые целые из N 32-битных разрядов
+ * @details Служебная часть C++ слоя (пространство имен s21::detail):
+ *          сложение и вычитание с переносом, умножение с расширением,
+ *          деление на 32-битное число, умножение на 10^k и деление на
+ *          10^k с банковским округлением. Используется s21::Fixed для
+ *          выравнивания масштабов и произведений без выхода за 96 бит и
+ *          шаблонами выражений (s21_expr.hpp) для точных промежуточных
+ *          значений.
+ *          Все функции constexpr (C++17), память не выделяется.
+ */
+
+#ifndef S21_WIDE_HPP
+#define S21_WIDE_HPP
+
+#include <cstdint>
+
+#include "s21_decimal.h"
+
+namespace s21 {
+namespace detail {
+
+// N разрядов по 32 бита, младший первым
+template <int N>
+struct uint_n {
+  static_assert(N > 0, "нужен хотя бы один разряд");
+  uint32_t w[N];
+};
+
+// флаги контекста потока (вне constexpr вычислений; переполнение при
+// вычислении на этапе компиляции становится ошибкой компиляции)
+inline void raise_flags(unsigned flags) noexcept { s21_context_raise(flags); }
+
+// true при вычислении на этапе компиляции: флаги округления там не
+// поднимаются (GCC и clang >= 9, иначе всегда false)
+constexpr bool constant_evaluated() noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_is_constant_evaluated();
+#else
+  return false;
+#endif
+}
+
+// число значащих разрядов (0 для нуля)
+template <int N>
+constexpr int wide_len(const uint_n<N> &a) noexcept {
+  int n = N;
+  while (n > 0 && a.w[n - 1] == 0u) n--;
+  return n;
+}
+
+template <int N>
+constexpr bool wide_is_zero(const uint_n<N> &a) noexcept {
+  bool zero = true;
+  for (int i = 0; i < N; i++) zero = zero && a.w[i] == 0u;
+  return zero;
+}
+
+template <int N>
+constexpr uint_n<N> wide_from_u64(uint64_t v) noexcept {
+  uint_n<N> r{};
+  r.w[0] = static_cast<uint32_t>(v);
+  if constexpr (N > 1) r.w[1] = static_cast<uint32_t>(v >> 32);
+  return r;
+}
+
+// мантисса decimal в N >= 3 разрядов
+template <int N>
+constexpr uint_n<N> wide_from_decimal(const s21_decimal &d) noexcept {
+  static_assert(N >= 3, "мантисса decimal занимает 3 разряда");
+  uint_n<N> r{};
+  for (int i = 0; i < 3; i++) r.w[i] = static_cast<uint32_t>(d.bits[i]);
+  return r;
+}
+
+// N разрядов в M, *lost = 1 если отброшены ненулевые старшие разряды
+template <int M, int N>
+constexpr uint_n<M> wide_resize(const uint_n<N> &a, bool *lost) noexcept {
+  uint_n<M> r{};
+  bool high = false;
+  for (int i = 0; i < N; i++) {
+    if (i < M)
+      r.w[i] = a.w[i];
+    else
+      high = high || a.w[i] != 0u;
+  }
+  if (lost) *lost = high;
+  return r;
+}
+
+// -1, 0, 1
+template <int N>
+constexpr int wide_cmp(const uint_n<N> &a, const uint_n<N> &b) noexcept {
+  int result = 0;
+  for (int i = N - 1; i >= 0 && result == 0; i--) {
+    if (a.w[i] != b.w[i]) result = a.w[i] > b.w[i] ? 1 : -1;
+  }
+  return result;
+}
+
+// a += b, возвращает перенос
+template <int N>
+constexpr uint32_t wide_add(uint_n<N> &a, const uint_n<N> &b) noexcept {
+  uint64_t c = 0;
+  for (int i = 0; i < N; i++) {
+    c += static_cast<uint64_t>(a.w[i]) + b.w[i];
+    a.w[i] = static_cast<uint32_t>(c);
+    c >>= 32;
+  }
+  return static_cast<uint32_t>(c);
+}
+
+// a -= b, возвращает заем
+template <int N>
+constexpr uint32_t wide_sub(uint_n<N> &a, const uint_n<N> &b) noexcept {
+  uint64_t borrow = 0;
+  for (int i = 0; i < N; i++) {
+    uint64_t d = static_cast<uint64_t>(a.w[i]) - b.w[i] - borrow;
+    a.w[i] = static_cast<uint32_t>(d);
+    borrow = (d >> 32) & 1u;
+  }
+  return static_cast<uint32_t>(borrow);
+}
+
+// a *= m, возвращает перенос
+template <int N>
+constexpr uint32_t wide_mul_small(uint_n<N> &a, uint32_t m) noexcept {
+  uint64_t c = 0;
+  for (int i = 0; i < N; i++) {
+    c += static_cast<uint64_t>(a.w[i]) * m;
+    a.w[i] = static_cast<uint32_t>(c);
+    c >>= 32;
+  }
+  return static_cast<uint32_t>(c);
+}
+
+// a /= d, возвращает остаток
+template <int N>
+constexpr uint32_t wide_div_small(uint_n<N> &a, uint32_t d) noexcept {
+  uint64_t rem = 0;
+  for (int i = N - 1; i >= 0; i--) {
+    uint64_t cur = (rem << 32) | a.w[i];
+    a.w[i] = static_cast<uint32_t>(cur / d);
+    rem = cur % d;
+  }
+  return static_cast<uint32_t>(rem);
+}
+
+// полное произведение без потерь
+template <int N, int M>
+constexpr uint_n<N + M> wide_mul(const uint_n<N> &a,
+                                 const uint_n<M> &b) noexcept {
+  uint_n<N + M> r{};
+  for (int i = 0; i < N; i++) {
+    uint64_t c = 0;
+    for (int j = 0; j < M; j++) {
+      c += static_cast<uint64_t>(r.w[i + j]) +
+           static_cast<uint64_t>(a.w[i]) * b.w[j];
+      r.w[i + j] = static_cast<uint32_t>(c);
+      c >>= 32;
+    }
+    r.w[i + M] = static_cast<uint32_t>(c);
+  }
+  return r;
+}
+
+constexpr uint32_t pow10_u32(int k) noexcept {
+  uint32_t p = 1u;
+  for (int i = 0; i < k; i++) p *= 10u;
+  return p;
+}
+
+// a *= 10^k, 1 если результат не помещается в N разрядов
+template <int N>
+constexpr int wide_mul_pow10(uint_n<N> &a, int k) noexcept {
+  uint32_t carry = 0;
+  for (; k > 0 && carry == 0u; k -= 9)
+    carry = wide_mul_small(a, pow10_u32(k < 9 ? k : 9));
+  return carry != 0u;
+}
+
+template <int N>
+constexpr uint_n<N> wide_pow10(int k) noexcept {
+  uint_n<N> r = wide_from_u64<N>(1u);
+  wide_mul_pow10(r, k);
+  return r;
+}
+
+// a = a / 10^k, возвращает 1 если остаток ненулевой
+template <int N>
+constexpr int wide_div_pow10(uint_n<N> &a, int k) noexcept {
+  bool sticky = false;
+  for (; k > 0; k -= 9)
+    sticky = wide_div_small(a, pow10_u32(k < 9 ? k : 9)) != 0u || sticky;
+  return sticky;
+}
+
+// a = a / 10^k с округлением к четному, возвращает 1 если остаток был
+// ненулевым (результат неточный)
+template <int N>
+constexpr int wide_div_pow10_round(uint_n<N> &a, int k) noexcept {
+  int inexact = 0;
+  if (k > 0) {
+    // все цифры кроме последней - только признак ненулевого остатка
+    bool sticky = wide_div_pow10(a, k - 1) != 0;
+    uint32_t digit = wide_div_small(a, 10u);
+
+    if (digit > 5u || (digit == 5u && (sticky || (a.w[0] & 1u)))) {
+      uint_n<N> one = wide_from_u64<N>(1u);
+      wide_add(a, one);
+    }
+    inexact = sticky || digit != 0u;
+  }
+  return inexact;
+}
+
+// число значащих бит (0 для нуля)
+template <int N>
+constexpr int wide_bit_length(const uint_n<N> &a) noexcept {
+  int n = wide_len(a);
+  int bits = 0;
+  if (n > 0) {
+    uint32_t top = a.w[n - 1];
+    bits = (n - 1) * 32;
+    while (top != 0u) {
+      bits++;
+      top >>= 1;
+    }
+  }
+  return bits;
+}
+
+// знаковое сложение модулей: (am, an) += (bm, bn), 1 при переносе
+template <int N>
+constexpr int wide_signed_add(uint_n<N> &am, bool &an, const uint_n<N> &bm,
+                              bool bn) noexcept {
+  int overflow = 0;
+  if (an == bn) {
+    overflow = wide_add(am, bm) != 0u;
+  } else if (wide_cmp(am, bm) >= 0) {
+    wide_sub(am, bm);
+  } else {
+    uint_n<N> r = bm;
+    wide_sub(r, am);
+    am = r;
+    an = bn;
+  }
+  if (wide_is_zero(am)) an = false;
+  return overflow;
+}
+
+}  // namespace detail
+}  // namespace s21
+
+#endif
@@ -6,6 +6,20 @@
 
 #include "tests.h"
 
+/**
+ * @brief Вспомогательная функция для создания decimal числа
+ * @param lo Младшие 32 бита мантиссы
+ * @param scale Масштаб
+ * @param sign Знак (0 - положительное, 1 - отрицательное)
+ * @return Созданное decimal число
+ */
+s21_decimal mk_dec(unsigned lo, int scale, int sign) {
+  s21_decimal d = {{(int)lo, 0, 0, 0}};
+  s21_set_scale(&d, scale);
+  s21_set_sign(&d, sign);
+  return d;
+}
+
 /**
  * @brief Главная функция для запуска тестов
  * @return 0 если все тесты прошли успешно, 1 если были ошибки
@@ -29,6 +43,20 @@ int main(void) {
       test_div_ext(),                // Расширенные тесты деления
       test_div_extra(),              // Дополнительные тесты деления
       test_utilities_extra(),        // Тесты вспомогательных функций
+      test_to_double(),              // Тесты конвертации decimal → double
+      test_int64(),                  // Тесты 64/128 бит конвертаций
+      test_context(),                // Тесты контекста вычислений
+      test_pointer_api(),            // Тесты операций по указателям
+      test_chars(),                  // Тесты текстового представления
+      test_formula(),                // Тесты формул над столбцами
+      test_decimal256(),             // Тесты s21_decimal256
+      test_bigdecimal(),             // Тесты s21_bigdecimal
+      test_decimal64(),              // Тесты s21_decimal64
+      test_decimal128(),             // Тесты decimal128 (BID, DPD)
+      test_arrow(),                  // Тесты Arrow decimal128
+      test_pg_numeric(),             // Тесты PostgreSQL NUMERIC
+      test_varint(),                 // Тесты записи переменной длины
+      test_bitpack(),                // Тесты сжатия столбца
       NULL                           // Маркер конца массива
   };
 
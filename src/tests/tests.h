@@ -25,6 +25,9 @@
   } while (0)
 #endif
 
+// Число lo * 10^-scale со знаком sign (0 - положительное, 1 - отрицательное)
+s21_decimal mk_dec(unsigned lo, int scale, int sign);
+
 // Объявления тестовых наборов (суитов)
 
 Suite *test_to_float(void);              // Тесты конвертации decimal → float
@@ -39,5 +42,26 @@ Suite *test_negate(void);                // Тесты изменения зна
 Suite *test_div_ext(void);               // Расширенные тесты деления
 Suite *test_div_extra(void);             // Дополнительные тесты деления
 Suite *test_utilities_extra(void);
+Suite *test_to_double(void);             // Тесты конвертации decimal → double
+Suite *test_int64(void);                 // Тесты 64/128 бит конвертаций
+Suite *test_context(void);               // Тесты контекста вычислений
+Suite *test_pointer_api(void);           // Тесты операций по указателям
+Suite *test_chars(void);                 // Тесты текстового представления
+Suite *test_formula(void);               // Тесты формул над столбцами
+Suite *test_decimal256(void);            // Тесты s21_decimal256
+Suite *test_bigdecimal(void);            // Тесты s21_bigdecimal
+Suite *test_decimal64(void);             // Тесты s21_decimal64
+Suite *test_decimal128(void);            // Тесты decimal128 (BID, DPD)
+Suite *test_arrow(void);                 // Тесты Arrow decimal128
+Suite *test_pg_numeric(void);            // Тесты PostgreSQL NUMERIC
+Suite *test_varint(void);                // Тесты записи переменной длины
+Suite *test_bitpack(void);               // Тесты сжатия столбца
+
+#ifdef __cplusplus
+// Наборы C++ слоя (make test_cpp, main в tests_cpp.cpp)
+Suite *test_decimal_hpp(void);           // Тесты обертки s21::Decimal
+Suite *test_fixed(void);                 // Тесты s21::Fixed<Scale>
+Suite *test_expr(void);                  // Тесты шаблонов выражений
+#endif
 
 #endif
@@ -154,6 +154,59 @@ START_TEST(add_overflow_shrink128) {
 }
 END_TEST
 
+/**
+ * @brief Тест переноса за 96 бит с уменьшением масштаба
+ * @details Проверяет: 7922816251426433759354395033.5 * 2 =
+ *          15845632502852867518708790067 (масштаб уменьшается на 1,
+ *          нулевой остаток не округляет нечетную мантиссу вверх)
+ */
+START_TEST(add_carry_reduces_scale) {
+  s21_decimal a = mk(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 1, 0);
+  s21_decimal r;
+
+  ck_assert_int_eq(s21_add(a, a, &r), 0);
+  ck_assert_int_eq(s21_get_scale(&r), 0);
+  ck_assert_uint_eq((uint32_t)r.bits[0], 0x33333333u);
+  ck_assert_uint_eq((uint32_t)r.bits[1], 0x33333333u);
+  ck_assert_uint_eq((uint32_t)r.bits[2], 0x33333333u);
+}
+END_TEST
+
+/**
+ * @brief Тест заема через средний разряд мантиссы
+ * @details Проверяет: 1.0000000000000000000000000005 - 0.149 =
+ *          0.8510000000000000000000000005 (заем из младшего слова при
+ *          bits[1] уменьшаемого больше bits[1] вычитаемого)
+ */
+START_TEST(sub_borrow_middle_word) {
+  s21_decimal a = mk(0x10000005u, 0x3E250261u, 0x204FCE5Eu, 28, 0);
+  s21_decimal b = mk(149, 0, 0, 3, 0);
+  s21_decimal r;
+
+  ck_assert_int_eq(s21_sub(a, b, &r), 0);
+  ck_assert_int_eq(
+      s21_is_equal(r, mk(0xFE000005u, 0x6480434Du, 0x1B7F4E98u, 28, 0)), 1);
+}
+END_TEST
+
+/**
+ * @brief Тест знака при выравнивании масштабов с перестановкой
+ * @details Проверяет: 0.5 - 4 = -3.5 и 0.5 + (-4) = -3.5 (у первого
+ *          числа масштаб больше, поэтому мантиссы меняются местами)
+ */
+START_TEST(add_sub_swapped_scales_sign) {
+  s21_decimal a = mk(5, 0, 0, 1, 0);
+  s21_decimal r;
+
+  ck_assert_int_eq(s21_sub(a, mk(4, 0, 0, 0, 0), &r), 0);
+  ck_assert_int_eq(s21_is_equal(r, mk(35, 0, 0, 1, 1)), 1);
+  ck_assert_int_eq(s21_add(a, mk(4, 0, 0, 0, 1), &r), 0);
+  ck_assert_int_eq(s21_is_equal(r, mk(35, 0, 0, 1, 1)), 1);
+  ck_assert_int_eq(s21_add(mk(4, 0, 0, 0, 1), a, &r), 0);
+  ck_assert_int_eq(s21_is_equal(r, mk(35, 0, 0, 1, 1)), 1);
+}
+END_TEST
+
 Suite* test_add_sub(void) {
   Suite* s = suite_create("s21_add_sub");
   TCase* tc = tcase_create("add_sub");
@@ -171,6 +224,9 @@ Suite* test_add_sub(void) {
   tcase_add_test(tc, add_align_bankers_tie_odd);
   tcase_add_test(tc, add_align_bankers_tie_even);
   tcase_add_test(tc, add_overflow_shrink128);
+  tcase_add_test(tc, add_sub_swapped_scales_sign);
+  tcase_add_test(tc, add_carry_reduces_scale);
+  tcase_add_test(tc, sub_borrow_middle_word);
 
   suite_add_tcase(s, tc);
   return s;
@@ -0,0 +1,289 @@
+/**
+ * @file tests_arrow.c
+ * @brief Тесты обмена с Apache Arrow decimal128 (C Data Interface)
+ * @details Содержит юнит-тесты перевода значений с изменением масштаба,
+ *          экспорта столбца на месте и с копией, импорта с null и
+ *          смещением, отказа для неверного формата
+ */
+
+#include <string.h>
+
+#include "tests.h"
+
+// значение Arrow из 64 бит со знаком (младшие 64 бита первыми)
+static void put128(int64_t v, unsigned char *out) {
+  uint64_t w[2] = {(uint64_t)v, v < 0 ? UINT64_MAX : 0u};
+  memcpy(out, w, sizeof(w));
+}
+
+static void get128(const unsigned char *in, uint64_t w[2]) {
+  memcpy(w, in, 2 * sizeof(uint64_t));
+}
+
+// массив собран в тесте: освобождать нечего
+static void release_schema(struct ArrowSchema *schema) { (void)schema; }
+static void release_array(struct ArrowArray *array) { (void)array; }
+
+// чужой массив decimal128 из буферов (битовая карта и значения)
+static void foreign_array(const char *format, const void **buffers,
+                          int64_t length, int64_t offset,
+                          struct ArrowSchema *schema,
+                          struct ArrowArray *array) {
+  memset(schema, 0, sizeof(*schema));
+  memset(array, 0, sizeof(*array));
+  schema->format = format;
+  schema->release = release_schema;
+  array->release = release_array;
+  array->length = length;
+  array->offset = offset;
+  array->n_buffers = 2;
+  array->buffers = buffers;
+}
+
+// -19.99 при масштабе 3 -> -19990 в дополнительном коде
+START_TEST(arrow_negative_twos_complement) {
+  s21_decimal v = {{1999, 0, 0, (int)(S21_SIGN_MASK | (2u << 16))}};
+  unsigned char raw[16];
+  uint64_t w[2];
+  ck_assert_int_eq(s21_to_arrow_decimal128(&v, 1, 3, raw), 0);
+  get128(raw, w);
+  ck_assert_uint_eq(w[0], (uint64_t)-19990);
+  ck_assert_uint_eq(w[1], UINT64_MAX);
+}
+END_TEST
+
+// 0.0025 при масштабе 3 -> 2 (0.002, к четному)
+START_TEST(arrow_larger_scale_half_even) {
+  s21_decimal v = {{25, 0, 0, 4 << 16}};
+  unsigned char raw[16];
+  uint64_t w[2];
+  ck_assert_int_eq(s21_to_arrow_decimal128(&v, 1, 3, raw), 0);
+  get128(raw, w);
+  ck_assert_uint_eq(w[0], 2u);
+  ck_assert_uint_eq(w[1], 0u);
+}
+END_TEST
+
+// (2^96 - 1) * 10^10 - 39 цифр: элемент получает 0
+START_TEST(arrow_over_38_digits) {
+  s21_decimal src[2] = {{{7, 0, 0, 0}}, {{-1, -1, -1, 0}}};
+  unsigned char raw[32];
+  uint64_t w[2];
+  ck_assert_int_eq(s21_to_arrow_decimal128(src, 2, 10, raw), 1);
+  get128(raw, w);
+  ck_assert_uint_eq(w[0], UINT64_C(70000000000));
+  get128(raw + 16, w);
+  ck_assert_uint_eq(w[0] | w[1], 0u);
+}
+END_TEST
+
+// (2^96 - 1) * 10^9 - 38 цифр, обратно точно с масштабом 0
+START_TEST(arrow_38_digits_roundtrip) {
+  s21_decimal max = {{-1, -1, -1, 0}}, back;
+  unsigned char raw[16];
+  ck_assert_int_eq(s21_to_arrow_decimal128(&max, 1, 9, raw), 0);
+  ck_assert_int_eq(s21_from_arrow_decimal128(raw, 1, 9, &back), 0);
+  ck_assert_int_eq(s21_get_scale(&back), 0);
+  ck_assert_mem_eq(&back, &max, sizeof(back));
+}
+END_TEST
+
+START_TEST(arrow_from_negative) {
+  unsigned char raw[16];
+  s21_decimal back;
+  put128(-5, raw);
+  ck_assert_int_eq(s21_from_arrow_decimal128(raw, 1, 0, &back), 0);
+  ck_assert_int_eq(back.bits[0], 5);
+  ck_assert_int_eq(s21_get_sign(&back), 1);
+}
+END_TEST
+
+START_TEST(arrow_values_in_place) {
+  s21_decimal src[2] = {{{1999, 0, 0, (int)(S21_SIGN_MASK | (2u << 16))}},
+                        {{25, 0, 0, 4 << 16}}};
+  s21_decimal column[2] = {src[0], src[1]};
+  ck_assert_int_eq(s21_to_arrow_decimal128(column, 2, 4, column), 0);
+  ck_assert_int_eq(s21_from_arrow_decimal128(column, 2, 4, column), 0);
+  ck_assert_int_eq(s21_is_equal(column[0], src[0]), 1);
+  ck_assert_mem_eq(&column[1], &src[1], sizeof(column[1]));
+}
+END_TEST
+
+START_TEST(arrow_values_bad_args) {
+  s21_decimal v = {{1, 0, 0, 0}};
+  unsigned char raw[16];
+  ck_assert_int_eq(s21_to_arrow_decimal128(NULL, 1, 4, raw), 1);
+  ck_assert_int_eq(s21_to_arrow_decimal128(&v, 1, 39, raw), 1);
+}
+END_TEST
+
+// копия: формат со старшим масштабом столбца, столбец не меняется
+START_TEST(arrow_export_copy) {
+  s21_decimal column[3] = {{{15, 0, 0, 1 << 16}},
+                           {{7, 0, 0, (int)S21_SIGN_MASK}},
+                           {{123, 0, 0, 3 << 16}}};
+  s21_decimal saved[3];
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  memcpy(saved, column, sizeof(column));
+  ck_assert_int_eq(
+      s21_arrow_export_decimal128(column, 3, -1, 0, &schema, &array), 0);
+  ck_assert_str_eq(schema.format, "d:38,3");
+  ck_assert_int_eq((int)array.length, 3);
+  ck_assert_int_eq((int)array.null_count, 0);
+  ck_assert_int_eq((int)array.n_buffers, 2);
+  ck_assert_ptr_null(array.buffers[0]);
+  ck_assert_ptr_ne(array.buffers[1], column);
+  ck_assert_mem_eq(column, saved, sizeof(column));
+  schema.release(&schema);
+  array.release(&array);
+}
+END_TEST
+
+START_TEST(arrow_export_release) {
+  s21_decimal column[1] = {{{15, 0, 0, 1 << 16}}};
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  s21_arrow_export_decimal128(column, 1, -1, 0, &schema, &array);
+  schema.release(&schema);
+  array.release(&array);
+  ck_assert_ptr_null(schema.release);
+  ck_assert_ptr_null(array.release);
+}
+END_TEST
+
+START_TEST(arrow_export_import_roundtrip) {
+  s21_decimal column[3] = {{{15, 0, 0, 1 << 16}},
+                           {{7, 0, 0, (int)S21_SIGN_MASK}},
+                           {{123, 0, 0, 3 << 16}}};
+  s21_decimal back[3];
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  s21_arrow_export_decimal128(column, 3, -1, 0, &schema, &array);
+  ck_assert_int_eq(s21_arrow_import_decimal128(&schema, &array, back), 0);
+  for (int i = 0; i < 3; i++)
+    ck_assert_int_eq(s21_is_equal(back[i], column[i]), 1);
+  ck_assert_int_eq(s21_get_scale(&back[1]), 3);
+  schema.release(&schema);
+  array.release(&array);
+}
+END_TEST
+
+// на месте: массив ссылается на столбец, 0.123 -> 0.1 при масштабе 1
+START_TEST(arrow_export_in_place) {
+  s21_decimal column[3] = {{{15, 0, 0, 1 << 16}},
+                           {{7, 0, 0, (int)S21_SIGN_MASK}},
+                           {{123, 0, 0, 3 << 16}}};
+  s21_decimal first = column[0];
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  ck_assert_int_eq(
+      s21_arrow_export_decimal128(column, 3, 1, 1, &schema, &array), 0);
+  ck_assert_ptr_eq(array.buffers[1], column);
+  ck_assert_str_eq(schema.format, "d:38,1");
+  ck_assert_int_eq(s21_arrow_import_decimal128(&schema, &array, column), 0);
+  ck_assert_int_eq(s21_is_equal(column[0], first), 1);
+  ck_assert_int_eq(column[2].bits[0], 1);
+  schema.release(&schema);
+  array.release(&array);
+}
+END_TEST
+
+START_TEST(arrow_export_null) {
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  ck_assert_int_eq(
+      s21_arrow_export_decimal128(NULL, 3, 1, 1, &schema, &array), 1);
+}
+END_TEST
+
+// битовая карта 1101 1 со смещением 1: элемент 2 массива - null
+START_TEST(arrow_import_validity_offset) {
+  unsigned char raw[5 * 16];
+  unsigned char valid[1] = {0x1B};
+  const void *buffers[2] = {valid, raw};
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  s21_decimal dst[4];
+  for (int i = 0; i < 5; i++) put128(-100 * i - 1, raw + 16 * i);
+  foreign_array("d:10,2,128", buffers, 4, 1, &schema, &array);
+  ck_assert_int_eq(s21_arrow_import_decimal128(&schema, &array, dst), 0);
+  ck_assert_int_eq(dst[0].bits[0], 101);
+  ck_assert_int_eq(s21_get_scale(&dst[0]), 2);
+  ck_assert_int_eq(s21_get_sign(&dst[0]), 1);
+  ck_assert_int_eq(s21_is_zero(&dst[1]), 1);
+  ck_assert_int_eq(dst[2].bits[0], 301);
+  ck_assert_int_eq(dst[3].bits[0], 401);
+}
+END_TEST
+
+// 10^30 при масштабе 0 больше 96 бит: элемент получает 0, код 2
+START_TEST(arrow_import_value_too_large) {
+  unsigned char raw[2 * 16];
+  uint64_t big[2] = {UINT64_C(0x4674EDEA40000000), UINT64_C(0xC9F2C9CD0)};
+  const void *buffers[2] = {NULL, raw};
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  s21_decimal dst[2];
+  memcpy(raw, big, sizeof(big));
+  put128(401, raw + 16);
+  foreign_array("d:31,0", buffers, 2, 0, &schema, &array);
+  ck_assert_int_eq(s21_arrow_import_decimal128(&schema, &array, dst), 2);
+  ck_assert_int_eq(s21_is_zero(&dst[0]), 1);
+  ck_assert_int_eq(dst[1].bits[0], 401);
+  ck_assert_int_eq(s21_get_scale(&dst[1]), 0);
+}
+END_TEST
+
+// decimal256, точность больше 38, без масштаба, другой тип, мусор
+START_TEST(arrow_import_bad_format) {
+  unsigned char raw[16];
+  const void *buffers[2] = {NULL, raw};
+  const char *bad[] = {"d:38,2,256", "d:39,2", "d:10", "i", "d:10,2x"};
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  s21_decimal dst[1];
+  put128(1, raw);
+  for (int i = 0; i < 5; i++) {
+    foreign_array(bad[i], buffers, 1, 0, &schema, &array);
+    ck_assert_int_eq(s21_arrow_import_decimal128(&schema, &array, dst), 1);
+  }
+}
+END_TEST
+
+START_TEST(arrow_import_missing_buffer) {
+  unsigned char raw[16];
+  const void *buffers[2] = {NULL, raw};
+  struct ArrowSchema schema;
+  struct ArrowArray array;
+  s21_decimal dst[1];
+  foreign_array("d:10,2", buffers, 1, 0, &schema, &array);
+  array.n_buffers = 1;
+  ck_assert_int_eq(s21_arrow_import_decimal128(&schema, &array, dst), 1);
+}
+END_TEST
+
+Suite *test_arrow(void) {
+  Suite *s = suite_create("s21_arrow");
+  TCase *tc = tcase_create("arrow");
+
+  tcase_add_test(tc, arrow_negative_twos_complement);
+  tcase_add_test(tc, arrow_larger_scale_half_even);
+  tcase_add_test(tc, arrow_over_38_digits);
+  tcase_add_test(tc, arrow_38_digits_roundtrip);
+  tcase_add_test(tc, arrow_from_negative);
+  tcase_add_test(tc, arrow_values_in_place);
+  tcase_add_test(tc, arrow_values_bad_args);
+  tcase_add_test(tc, arrow_export_copy);
+  tcase_add_test(tc, arrow_export_release);
+  tcase_add_test(tc, arrow_export_import_roundtrip);
+  tcase_add_test(tc, arrow_export_in_place);
+  tcase_add_test(tc, arrow_export_null);
+  tcase_add_test(tc, arrow_import_validity_offset);
+  tcase_add_test(tc, arrow_import_value_too_large);
+  tcase_add_test(tc, arrow_import_bad_format);
+  tcase_add_test(tc, arrow_import_missing_buffer);
+
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -0,0 +1,279 @@
+/**
+ * @file tests_bigdecimal.c
+ * @brief Тесты числа произвольной длины (s21_bigdecimal_*)
+ * @details Содержит юнит-тесты перевода в s21_decimal и обратно, точной
+ *          арифметики больше 256 бит, пула разрядов потока и сравнения
+ */
+
+#include "tests.h"
+
+// compare(a, b) с кодом 0
+static int big_compare(const s21_decimal *a, const s21_decimal *b) {
+  size_t mark = s21_bigdecimal_mark();
+  s21_bigdecimal x, y;
+  int result = 5;
+  s21_bigdecimal_from_decimal(a, &x);
+  s21_bigdecimal_from_decimal(b, &y);
+  ck_assert_int_eq(s21_bigdecimal_compare(&x, &y, &result), 0);
+  s21_bigdecimal_release(mark);
+  return result;
+}
+
+START_TEST(bigdecimal_decimal_roundtrip) {
+  size_t mark = s21_bigdecimal_mark();
+  s21_decimal max = {{-1, -1, -1, (int)(S21_SIGN_MASK | (5u << 16))}};
+  s21_bigdecimal w;
+  s21_decimal d;
+  ck_assert_int_eq(s21_bigdecimal_from_decimal(&max, &w), 0);
+  ck_assert_int_eq(w.len, 3);
+  ck_assert_int_eq(w.scale, 5);
+  ck_assert_int_eq(w.sign, 1);
+  ck_assert_int_eq(s21_bigdecimal_to_decimal(&w, &d), 0);
+  ck_assert_mem_eq(&d, &max, sizeof(d));
+  s21_bigdecimal_release(mark);
+}
+END_TEST
+
+// (1 + 10^-28)^2 = 1 + 2e + e^2 точно при масштабе 56
+START_TEST(bigdecimal_mul_exact_scale_56) {
+  size_t mark = s21_bigdecimal_mark();
+  s21_context *ctx = s21_context_get();
+  s21_decimal one_eps = {{0x10000001, 0x3E250261, 0x204FCE5E, 28 << 16}};
+  s21_bigdecimal x;
+  s21_context_init(ctx);
+  s21_bigdecimal_from_decimal(&one_eps, &x);
+  ck_assert_int_eq(s21_bigdecimal_mul(&x, &x, &x), 0);
+  ck_assert_int_eq(x.scale, 56);
+  ck_assert_uint_eq(ctx->flags, 0u);
+  s21_bigdecimal_release(mark);
+}
+END_TEST
+
+// 1 + 2e + e^2 -> 1 + 2e одним округлением
+START_TEST(bigdecimal_to_decimal_rounds_once) {
+  size_t mark = s21_bigdecimal_mark();
+  s21_context *ctx = s21_context_get();
+  s21_decimal one_eps = {{0x10000001, 0x3E250261, 0x204FCE5E, 28 << 16}};
+  s21_decimal expected = one_eps, d;
+  s21_bigdecimal x;
+  expected.bits[0]++;
+  s21_bigdecimal_from_decimal(&one_eps, &x);
+  s21_bigdecimal_mul(&x, &x, &x);
+  s21_context_init(ctx);
+  ck_assert_int_eq(s21_bigdecimal_to_decimal(&x, &d), 0);
+  ck_assert_mem_eq(&d, &expected, sizeof(d));
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_ROUNDED | S21_FLAG_INEXACT);
+  s21_context_init(ctx);
+  s21_bigdecimal_release(mark);
+}
+END_TEST
+
+// max * max при масштабе 0 не помещается, со знаком минус - код 2
+START_TEST(bigdecimal_to_decimal_overflow) {
+  size_t mark = s21_bigdecimal_mark();
+  s21_context *ctx = s21_context_get();
+  s21_decimal int_max = {{-1, -1, -1, 0}}, d = {{7, 0, 0, 0}};
+  s21_decimal minus_one = mk_dec(1, 0, 1);
+  s21_bigdecimal x, neg;
+  s21_bigdecimal_from_decimal(&int_max, &x);
+  s21_bigdecimal_from_decimal(&minus_one, &neg);
+  ck_assert_int_eq(s21_bigdecimal_mul(&x, &x, &x), 0);
+  s21_context_init(ctx);
+  ck_assert_int_eq(s21_bigdecimal_to_decimal(&x, &d), 1);
+  ck_assert_int_eq(s21_bigdecimal_mul(&x, &neg, &x), 0);
+  ck_assert_int_eq(s21_bigdecimal_to_decimal(&x, &d), 2);
+  ck_assert_int_eq(d.bits[0], 7);
+  ck_assert_uint_eq(ctx->flags & S21_FLAG_OVERFLOW, S21_FLAG_OVERFLOW);
+  s21_context_init(ctx);
+  s21_bigdecimal_release(mark);
+}
+END_TEST
+
+START_TEST(bigdecimal_convert_null) {
+  s21_decimal max = {{-1, -1, -1, 0}}, d;
+  ck_assert_int_eq(s21_bigdecimal_to_decimal(NULL, &d), 1);
+  ck_assert_int_eq(s21_bigdecimal_from_decimal(&max, NULL), 1);
+}
+END_TEST
+
+// (2^96 - 1)^3 * 10^-84: 288 бит, масштаб 84
+START_TEST(bigdecimal_mul_over_256_bits) {
+  size_t mark = s21_bigdecimal_mark();
+  s21_decimal max = {{-1, -1, -1, 0}}, eps = mk_dec(1, 28, 0);
+  s21_bigdecimal m, e, cube;
+  s21_bigdecimal_from_decimal(&max, &m);
+  s21_bigdecimal_from_decimal(&eps, &e);
+  s21_bigdecimal_init(&cube);
+  ck_assert_int_eq(s21_bigdecimal_mul(&m, &m, &cube), 0);
+  ck_assert_int_eq(s21_bigdecimal_mul(&cube, &m, &cube), 0);
+  for (int i = 0; i < 3; i++)
+    ck_assert_int_eq(s21_bigdecimal_mul(&cube, &e, &cube), 0);
+  ck_assert_int_eq(cube.len, 9);
+  ck_assert_int_eq(cube.scale, 84);
+  s21_bigdecimal_release(mark);
+}
+END_TEST
+
+// e + 100 * cube - 100 * cube = e точно, пул растет только с мантиссой
+START_TEST(bigdecimal_accumulator_reuses_limbs) {
+  size_t mark = s21_bigdecimal_mark();
+  s21_decimal max = {{-1, -1, -1, 0}}, eps = mk_dec(1, 28, 0), d;
+  s21_bigdecimal m, e, acc, cube;
+  s21_bigdecimal_from_decimal(&max, &m);
+  s21_bigdecimal_from_decimal(&eps, &e);
+  s21_bigdecimal_init(&cube);
+  s21_bigdecimal_mul(&m, &m, &cube);
+  s21_bigdecimal_mul(&cube, &m, &cube);
+  s21_bigdecimal_mul(&cube, &e, &cube);
+
+  s21_bigdecimal_init(&acc);
+  ck_assert_int_eq(s21_bigdecimal_add(&acc, &e, &acc), 0);
+  size_t after_first = s21_bigdecimal_mark();
+  for (int i = 0; i < 100; i++)
+    ck_assert_int_eq(s21_bigdecimal_add(&acc, &cube, &acc), 0);
+  for (int i = 0; i < 100; i++)
+    ck_assert_int_eq(s21_bigdecimal_sub(&acc, &cube, &acc), 0);
+  ck_assert_int_le((int)(s21_bigdecimal_mark() - after_first), 64);
+  ck_assert_int_eq(s21_bigdecimal_to_decimal(&acc, &d), 0);
+  ck_assert_mem_eq(&d, &eps, sizeof(d));
+  s21_bigdecimal_release(mark);
+}
+END_TEST
+
+// возведение в квадрат до нехватки пула: код 1, m и пул не меняются
+START_TEST(bigdecimal_pool_exhausted) {
+  size_t mark = s21_bigdecimal_mark();
+  s21_decimal max = {{-1, -1, -1, 0}};
+  s21_bigdecimal m;
+  int code = 0, steps = 0;
+  s21_bigdecimal_from_decimal(&max, &m);
+  while (code == 0 && steps < 32) {
+    code = s21_bigdecimal_mul(&m, &m, &m);
+    steps++;
+  }
+  ck_assert_int_eq(code, 1);
+  ck_assert_int_gt(steps, 8);
+  size_t full = s21_bigdecimal_mark();
+  int len = m.len;
+  ck_assert_int_eq(s21_bigdecimal_add(&m, &m, &m), 1);
+  ck_assert_int_eq(m.len, len);
+  ck_assert_uint_eq(s21_bigdecimal_mark(), full);
+  s21_bigdecimal_release(mark);
+}
+END_TEST
+
+START_TEST(bigdecimal_release_returns_limbs) {
+  size_t mark = s21_bigdecimal_mark();
+  s21_decimal max = {{-1, -1, -1, 0}};
+  s21_bigdecimal m;
+  s21_bigdecimal_from_decimal(&max, &m);
+  s21_bigdecimal_mul(&m, &m, &m);
+  ck_assert_int_gt((int)(s21_bigdecimal_mark() - mark), 0);
+  s21_bigdecimal_release(mark);
+  ck_assert_uint_eq(s21_bigdecimal_mark(), mark);
+}
+END_TEST
+
+START_TEST(bigdecimal_arithmetic_null) {
+  s21_bigdecimal e;
+  s21_bigdecimal_init(&e);
+  ck_assert_int_eq(s21_bigdecimal_add(NULL, &e, &e), 1);
+  ck_assert_int_eq(s21_bigdecimal_sub(&e, NULL, &e), 1);
+  ck_assert_int_eq(s21_bigdecimal_mul(&e, &e, NULL), 1);
+}
+END_TEST
+
+// масштаб 40000 + 40000 больше S21_BIGDECIMAL_SCALE_MAX
+START_TEST(bigdecimal_mul_scale_overflow) {
+  size_t mark = s21_bigdecimal_mark();
+  s21_decimal seven = mk_dec(7, 0, 0);
+  s21_bigdecimal x, r;
+  s21_context *ctx = s21_context_get();
+  s21_context_init(ctx);
+  s21_bigdecimal_from_decimal(&seven, &x);
+  s21_bigdecimal_from_decimal(&seven, &r);
+  x.scale = 40000;
+  ck_assert_int_eq(s21_bigdecimal_mul(&x, &x, &r), 1);
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_OVERFLOW);
+  ck_assert_int_eq(r.scale, 0);
+  ck_assert_uint_eq(r.limbs[0], 7u);
+  s21_context_init(ctx);
+  s21_bigdecimal_release(mark);
+}
+END_TEST
+
+START_TEST(bigdecimal_mul_large_scale) {
+  size_t mark = s21_bigdecimal_mark();
+  s21_decimal seven = mk_dec(7, 0, 0);
+  s21_bigdecimal x, r;
+  s21_context *ctx = s21_context_get();
+  s21_context_init(ctx);
+  s21_bigdecimal_from_decimal(&seven, &x);
+  s21_bigdecimal_init(&r);
+  x.scale = 30000;
+  ck_assert_int_eq(s21_bigdecimal_mul(&x, &x, &r), 0);
+  ck_assert_int_eq(r.scale, 60000);
+  ck_assert_uint_eq(r.limbs[0], 49u);
+  ck_assert_uint_eq(ctx->flags, 0u);
+  s21_bigdecimal_release(mark);
+}
+END_TEST
+
+START_TEST(bigdecimal_compare_scales) {
+  s21_decimal a = mk_dec(10, 1, 0), b = mk_dec(100, 2, 0);
+  s21_decimal eps = mk_dec(1, 28, 0);
+  ck_assert_int_eq(big_compare(&a, &b), 0);
+  ck_assert_int_eq(big_compare(&a, &eps), 1);
+  ck_assert_int_eq(big_compare(&eps, &a), -1);
+}
+END_TEST
+
+START_TEST(bigdecimal_compare_zero_sign) {
+  s21_decimal zero = mk_dec(0, 0, 0), neg_zero = mk_dec(0, 5, 1);
+  s21_decimal eps = mk_dec(1, 28, 0), neg = mk_dec(15, 1, 1);
+  ck_assert_int_eq(big_compare(&zero, &neg_zero), 0);
+  ck_assert_int_eq(big_compare(&eps, &neg_zero), 1);
+  ck_assert_int_eq(big_compare(&neg, &zero), -1);
+}
+END_TEST
+
+// -1.5 - 1.0 < -1.5
+START_TEST(bigdecimal_compare_negative) {
+  size_t mark = s21_bigdecimal_mark();
+  s21_decimal a = mk_dec(15, 1, 1), b = mk_dec(10, 1, 0);
+  s21_bigdecimal x, y, diff;
+  int result = 5;
+  s21_bigdecimal_from_decimal(&a, &x);
+  s21_bigdecimal_from_decimal(&b, &y);
+  s21_bigdecimal_init(&diff);
+  ck_assert_int_eq(s21_bigdecimal_sub(&x, &y, &diff), 0);
+  ck_assert_int_eq(s21_bigdecimal_compare(&diff, &x, &result), 0);
+  ck_assert_int_eq(result, -1);
+  ck_assert_int_eq(s21_bigdecimal_compare(&x, NULL, &result), 1);
+  s21_bigdecimal_release(mark);
+}
+END_TEST
+
+Suite *test_bigdecimal(void) {
+  Suite *s = suite_create("s21_bigdecimal");
+  TCase *tc = tcase_create("bigdecimal");
+
+  tcase_add_test(tc, bigdecimal_decimal_roundtrip);
+  tcase_add_test(tc, bigdecimal_mul_exact_scale_56);
+  tcase_add_test(tc, bigdecimal_to_decimal_rounds_once);
+  tcase_add_test(tc, bigdecimal_to_decimal_overflow);
+  tcase_add_test(tc, bigdecimal_convert_null);
+  tcase_add_test(tc, bigdecimal_mul_over_256_bits);
+  tcase_add_test(tc, bigdecimal_accumulator_reuses_limbs);
+  tcase_add_test(tc, bigdecimal_pool_exhausted);
+  tcase_add_test(tc, bigdecimal_release_returns_limbs);
+  tcase_add_test(tc, bigdecimal_arithmetic_null);
+  tcase_add_test(tc, bigdecimal_mul_scale_overflow);
+  tcase_add_test(tc, bigdecimal_mul_large_scale);
+  tcase_add_test(tc, bigdecimal_compare_scales);
+  tcase_add_test(tc, bigdecimal_compare_zero_sign);
+  tcase_add_test(tc, bigdecimal_compare_negative);
+
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -0,0 +1,255 @@
+/**
+ * @file tests_bitpack.c
+ * @brief Тесты сжатия столбца (frame of reference + упаковка бит)
+ * @details Содержит юнит-тесты формата блока, сжатия и распаковки
+ *          столбцов decimal и int64 с неполным последним блоком, отказа
+ *          для значений с потерями и неверных данных
+ */
+
+#include <string.h>
+
+#include "tests.h"
+
+enum { COLUMN_N = 1500 };
+
+// столбец цен с масштабом 4, элемент 7 - 1.2 с масштабом 1
+static void price_column(s21_decimal *column) {
+  for (int i = 0; i < COLUMN_N; i++) {
+    s21_from_scaled_int64_to_decimal(1000000 + (i * 7919) % 5000, 4,
+                                     &column[i]);
+  }
+  column[7].bits[0] = 12;
+  column[7].bits[3] = 1 << 16;
+}
+
+// два значения с масштабом столбца 1 по блокам 128
+static int encode_pair(s21_decimal *column, unsigned char *buf, size_t cap,
+                       size_t *len) {
+  return s21_bitpack_encode(column, 2, 1, S21_BITPACK_BLOCK_SMALL, buf, cap,
+                            len);
+}
+
+// 100, 101, 103: минимум 100, разности 0, 1, 3 по 2 бита
+START_TEST(bitpack_block_format) {
+  int64_t v[3] = {100, 101, 103};
+  unsigned char buf[64];
+  size_t len = 0;
+  const unsigned char expected[] = {
+      3,    0, 0, 0, 0, 0, 0, 0, 128, 0, 2, 0,  // n, блок, масштаб
+      100,  0, 0, 0, 0, 0, 0, 0, 2,             // минимум, ширина
+      0x34, 0, 0, 0, 0, 0, 0, 0};               // 0 | 1 << 2 | 3 << 4
+  ck_assert_int_eq(s21_bitpack_encode_int64(v, 3, 2, S21_BITPACK_BLOCK_SMALL,
+                                            buf, sizeof(buf), &len),
+                   0);
+  ck_assert_int_eq((int)len, (int)sizeof(expected));
+  ck_assert_mem_eq(buf, expected, sizeof(expected));
+}
+END_TEST
+
+START_TEST(bitpack_info) {
+  int64_t v[3] = {100, 101, 103};
+  unsigned char buf[64];
+  size_t len = 0, n = 0;
+  int scale = 0;
+  s21_bitpack_encode_int64(v, 3, 2, S21_BITPACK_BLOCK_SMALL, buf, sizeof(buf),
+                           &len);
+  ck_assert_int_eq(s21_bitpack_info(buf, len, &n, &scale), 0);
+  ck_assert_int_eq((int)n, 3);
+  ck_assert_int_eq(scale, 2);
+}
+END_TEST
+
+// равные значения: ширина 0, блок без слов
+START_TEST(bitpack_width_zero) {
+  int64_t same[200], back[200];
+  unsigned char buf[64];
+  size_t len = 0;
+  for (int i = 0; i < 200; i++) same[i] = -5;
+  ck_assert_int_eq(s21_bitpack_encode_int64(same, 200, 0,
+                                            S21_BITPACK_BLOCK_SMALL, buf,
+                                            sizeof(buf), &len),
+                   0);
+  ck_assert_int_eq((int)len, 12 + 9 + 9);
+  ck_assert_int_eq(s21_bitpack_decode_int64(buf, len, back), 0);
+  ck_assert_mem_eq(back, same, sizeof(same));
+}
+END_TEST
+
+// 1500 = 11 * 128 + 92
+START_TEST(bitpack_roundtrip_small_blocks) {
+  static s21_decimal column[COLUMN_N], back[COLUMN_N];
+  static unsigned char buf[COLUMN_N * 8 + 512];
+  size_t len = 0;
+  price_column(column);
+  ck_assert_int_eq(s21_bitpack_encode(column, COLUMN_N, 4,
+                                      S21_BITPACK_BLOCK_SMALL, buf,
+                                      sizeof(buf), &len),
+                   0);
+  ck_assert_int_le((int)len,
+                   (int)s21_bitpack_bound(COLUMN_N, S21_BITPACK_BLOCK_SMALL));
+  ck_assert_int_lt((int)len, COLUMN_N * 8 / 2);
+  ck_assert_int_eq(s21_bitpack_decode(buf, len, back), 0);
+  for (int i = 0; i < COLUMN_N; i++) {
+    ck_assert_int_eq(s21_is_equal(back[i], column[i]), 1);
+    ck_assert_int_eq(s21_get_scale(&back[i]), 4);
+  }
+}
+END_TEST
+
+// 1500 = 1024 + 476
+START_TEST(bitpack_roundtrip_large_blocks) {
+  static s21_decimal column[COLUMN_N], back[COLUMN_N];
+  static unsigned char buf[COLUMN_N * 8 + 512];
+  size_t len = 0;
+  price_column(column);
+  ck_assert_int_eq(s21_bitpack_encode(column, COLUMN_N, 4,
+                                      S21_BITPACK_BLOCK_LARGE, buf,
+                                      sizeof(buf), &len),
+                   0);
+  ck_assert_int_le((int)len,
+                   (int)s21_bitpack_bound(COLUMN_N, S21_BITPACK_BLOCK_LARGE));
+  ck_assert_int_lt((int)len, COLUMN_N * 8 / 2);
+  ck_assert_int_eq(s21_bitpack_decode(buf, len, back), 0);
+  for (int i = 0; i < COLUMN_N; i++) {
+    ck_assert_int_eq(s21_is_equal(back[i], column[i]), 1);
+    ck_assert_int_eq(s21_get_scale(&back[i]), 4);
+  }
+}
+END_TEST
+
+// INT64_MIN и INT64_MAX в одном блоке: ширина 64, по слову на значение
+START_TEST(bitpack_width_64) {
+  int64_t v[3] = {INT64_MIN, INT64_MAX, 0}, out[3];
+  unsigned char buf[64];
+  size_t len = 0;
+  ck_assert_int_eq(s21_bitpack_encode_int64(v, 3, 0, S21_BITPACK_BLOCK_SMALL,
+                                            buf, sizeof(buf), &len),
+                   0);
+  ck_assert_int_eq(buf[12 + 8], 64);
+  ck_assert_int_eq((int)len, 12 + 9 + 3 * 8);
+  ck_assert_int_eq(s21_bitpack_decode_int64(buf, len, out), 0);
+  ck_assert_mem_eq(out, v, sizeof(v));
+}
+END_TEST
+
+// -2^63 как s21_decimal: модуль 2^63 со знаком
+START_TEST(bitpack_decode_int64_min) {
+  int64_t v[3] = {INT64_MIN, INT64_MAX, 0};
+  s21_decimal back[3];
+  unsigned char buf[64];
+  size_t len = 0;
+  s21_bitpack_encode_int64(v, 3, 0, S21_BITPACK_BLOCK_SMALL, buf, sizeof(buf),
+                           &len);
+  ck_assert_int_eq(s21_bitpack_decode(buf, len, back), 0);
+  ck_assert_int_eq(s21_get_sign(&back[0]), 1);
+  ck_assert_uint_eq((uint32_t)back[0].bits[0], 0u);
+  ck_assert_uint_eq((uint32_t)back[0].bits[1], 0x80000000u);
+}
+END_TEST
+
+// 0.15 при масштабе столбца 1 теряет цифру
+START_TEST(bitpack_larger_scale) {
+  s21_decimal column[2] = {{{5, 0, 0, 1 << 16}}, {{15, 0, 0, 2 << 16}}};
+  unsigned char buf[64];
+  size_t len = 0;
+  ck_assert_int_eq(encode_pair(column, buf, sizeof(buf), &len), 1);
+}
+END_TEST
+
+// 2^64 не помещается в int64
+START_TEST(bitpack_over_int64) {
+  s21_decimal column[2] = {{{5, 0, 0, 1 << 16}}, {{0, 0, 1, 0}}};
+  unsigned char buf[64];
+  size_t len = 0;
+  ck_assert_int_eq(encode_pair(column, buf, sizeof(buf), &len), 1);
+}
+END_TEST
+
+START_TEST(bitpack_bad_block_size) {
+  s21_decimal column[2] = {{{5, 0, 0, 1 << 16}}, {{15, 0, 0, 0}}};
+  unsigned char buf[64];
+  size_t len = 0;
+  ck_assert_int_eq(
+      s21_bitpack_encode(column, 2, 1, 256, buf, sizeof(buf), &len), 1);
+}
+END_TEST
+
+// места только на заголовок и минимум блока
+START_TEST(bitpack_no_space) {
+  s21_decimal column[2] = {{{5, 0, 0, 1 << 16}}, {{15, 0, 0, 0}}};
+  unsigned char buf[64];
+  size_t len = 0;
+  ck_assert_int_eq(encode_pair(column, buf, 12 + 9, &len), 2);
+}
+END_TEST
+
+// меньший масштаб домножается: 15 -> 150
+START_TEST(bitpack_smaller_scale) {
+  s21_decimal column[2] = {{{5, 0, 0, 1 << 16}}, {{15, 0, 0, 0}}};
+  unsigned char buf[64];
+  size_t len = 0;
+  int64_t out[2];
+  ck_assert_int_eq(encode_pair(column, buf, sizeof(buf), &len), 0);
+  ck_assert_int_eq(s21_bitpack_decode_int64(buf, len, out), 0);
+  ck_assert_int_eq((int)out[0], 5);
+  ck_assert_int_eq((int)out[1], 150);
+}
+END_TEST
+
+START_TEST(bitpack_truncated) {
+  s21_decimal column[2] = {{{5, 0, 0, 1 << 16}}, {{15, 0, 0, 0}}};
+  unsigned char buf[64];
+  size_t len = 0;
+  int64_t out[2];
+  encode_pair(column, buf, sizeof(buf), &len);
+  ck_assert_int_eq(s21_bitpack_decode_int64(buf, len - 1, out), 1);
+  ck_assert_int_eq(s21_bitpack_decode_int64(buf, 11, out), 1);
+}
+END_TEST
+
+START_TEST(bitpack_width_over_64) {
+  s21_decimal column[2] = {{{5, 0, 0, 1 << 16}}, {{15, 0, 0, 0}}};
+  unsigned char buf[64];
+  size_t len = 0;
+  int64_t out[2];
+  encode_pair(column, buf, sizeof(buf), &len);
+  buf[12 + 8] = 65;
+  ck_assert_int_eq(s21_bitpack_decode_int64(buf, len, out), 1);
+}
+END_TEST
+
+// размер блока 100 в заголовке
+START_TEST(bitpack_info_bad_block) {
+  s21_decimal column[2] = {{{5, 0, 0, 1 << 16}}, {{15, 0, 0, 0}}};
+  unsigned char buf[64];
+  size_t len = 0, n = 0;
+  int scale = 0;
+  encode_pair(column, buf, sizeof(buf), &len);
+  buf[8] = 100;
+  ck_assert_int_eq(s21_bitpack_info(buf, len, &n, &scale), 1);
+}
+END_TEST
+
+Suite *test_bitpack(void) {
+  Suite *s = suite_create("s21_bitpack");
+  TCase *tc = tcase_create("bitpack");
+
+  tcase_add_test(tc, bitpack_block_format);
+  tcase_add_test(tc, bitpack_info);
+  tcase_add_test(tc, bitpack_width_zero);
+  tcase_add_test(tc, bitpack_roundtrip_small_blocks);
+  tcase_add_test(tc, bitpack_roundtrip_large_blocks);
+  tcase_add_test(tc, bitpack_width_64);
+  tcase_add_test(tc, bitpack_decode_int64_min);
+  tcase_add_test(tc, bitpack_larger_scale);
+  tcase_add_test(tc, bitpack_over_int64);
+  tcase_add_test(tc, bitpack_bad_block_size);
+  tcase_add_test(tc, bitpack_no_space);
+  tcase_add_test(tc, bitpack_smaller_scale);
+  tcase_add_test(tc, bitpack_truncated);
+  tcase_add_test(tc, bitpack_width_over_64);
+  tcase_add_test(tc, bitpack_info_bad_block);
+
+  suite_add_tcase(s, tc);
+  return s;
+}
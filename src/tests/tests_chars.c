@@ -0,0 +1,119 @@
+/**
+ * @file tests_chars.c
+ * @brief Тесты текстового представления decimal
+ * @details Содержит юнит-тесты для s21_to_chars и s21_from_chars:
+ *          сохранение масштаба, ведущие нули дробной части, округление
+ *          лишних цифр и ошибки разбора
+ */
+
+#include <string.h>
+
+#include "tests.h"
+
+// разобрать строку целиком, вернуть код s21_from_chars
+static int parse(const char* s, s21_decimal* d) {
+  const char* end = NULL;
+  int code = s21_from_chars(s, s + strlen(s), d, &end);
+  if (code == 0) ck_assert_ptr_eq(end, s + strlen(s));
+  return code;
+}
+
+// вывести число в buf с завершающим нулем
+static void print(s21_decimal d, char* buf, size_t size) {
+  char* end = NULL;
+  ck_assert_int_eq(s21_to_chars(&d, buf, buf + size - 1, &end), 0);
+  *end = '\0';
+}
+
+/**
+ * @brief Тест вывода
+ * @details Проверяет: 19.99, -0.005, 1.50, 0.00, 2^96 - 1 и нехватку места
+ */
+START_TEST(chars_to_chars) {
+  char buf[40];
+  s21_decimal d;
+
+  s21_from_scaled_int64_to_decimal(1999, 2, &d);
+  print(d, buf, sizeof(buf));
+  ck_assert_str_eq(buf, "19.99");
+
+  s21_from_scaled_int64_to_decimal(-5, 3, &d);
+  print(d, buf, sizeof(buf));
+  ck_assert_str_eq(buf, "-0.005");
+
+  s21_from_scaled_int64_to_decimal(150, 2, &d);
+  print(d, buf, sizeof(buf));
+  ck_assert_str_eq(buf, "1.50");
+
+  s21_from_scaled_int64_to_decimal(0, 2, &d);
+  print(d, buf, sizeof(buf));
+  ck_assert_str_eq(buf, "0.00");
+
+  s21_decimal max = {{-1, -1, -1, 0}};
+  print(max, buf, sizeof(buf));
+  ck_assert_str_eq(buf, "79228162514264337593543950335");
+
+  char* end = NULL;
+  ck_assert_int_eq(s21_to_chars(&max, buf, buf + 28, &end), 1);
+}
+END_TEST
+
+/**
+ * @brief Тест разбора
+ * @details Проверяет: масштаб сохраняется, "-.5", "+7", 30 дробных цифр
+ *          округляются до 28 к четному, округление вверх до 2^96 уменьшает
+ *          масштаб, ошибки и позиция конца
+ */
+START_TEST(chars_from_chars) {
+  char buf[40];
+  s21_decimal d;
+
+  ck_assert_int_eq(parse("19.990", &d), 0);
+  ck_assert_int_eq(s21_get_scale(&d), 3);
+  ck_assert_int_eq(d.bits[0], 19990);
+
+  ck_assert_int_eq(parse("-.5", &d), 0);
+  print(d, buf, sizeof(buf));
+  ck_assert_str_eq(buf, "-0.5");
+
+  ck_assert_int_eq(parse("+7", &d), 0);
+  print(d, buf, sizeof(buf));
+  ck_assert_str_eq(buf, "7");
+
+  ck_assert_int_eq(parse("0.000000000000000000000000000250", &d), 0);
+  print(d, buf, sizeof(buf));
+  ck_assert_str_eq(buf, "0.0000000000000000000000000002");
+
+  ck_assert_int_eq(parse("7922816251426433759354395033.55", &d), 0);
+  print(d, buf, sizeof(buf));
+  ck_assert_str_eq(buf, "7922816251426433759354395034");
+
+  ck_assert_int_eq(parse("79228162514264337593543950335", &d), 0);
+  ck_assert_int_eq(parse("79228162514264337593543950336", &d), 2);
+  ck_assert_int_eq(parse("79228162514264337593543950335.5", &d), 2);
+
+  const char* s = "12.5kg";
+  const char* end = NULL;
+  ck_assert_int_eq(s21_from_chars(s, s + 6, &d, &end), 0);
+  ck_assert_ptr_eq(end, s + 4);
+
+  s = "-x";
+  ck_assert_int_eq(s21_from_chars(s, s + 2, &d, &end), 1);
+  ck_assert_ptr_eq(end, s);
+}
+END_TEST
+
+/**
+ * @brief Создание тестового набора для текстового представления
+ * @return Указатель на созданный Suite
+ */
+Suite* test_chars(void) {
+  Suite* s = suite_create("s21_chars");
+  TCase* tc = tcase_create("chars_TC");
+
+  tcase_add_test(tc, chars_to_chars);    // Вывод
+  tcase_add_test(tc, chars_from_chars);  // Разбор
+
+  suite_add_tcase(s, tc);
+  return s;
+}
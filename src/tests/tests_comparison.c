@@ -74,6 +74,17 @@ START_TEST(is_less_diff_scales_equal_value_fn) {
 }
 END_TEST
 
+// Перенос при умножении мантиссы на 10 может быть четным: масштаб
+// все равно не должен увеличиваться, иначе приведение не завершится
+START_TEST(is_less_scale_up_even_carry_fn) {
+  s21_decimal a = {{0x0049fc59, 0, 0, (int)(0x80020000u)}};
+  s21_decimal b = {{0x0072fa2d, 0, 0, (int)(0x801a0000u)}};
+  ck_assert_int_eq(s21_is_less(a, b), 1);
+  ck_assert_int_eq(s21_is_greater(a, b), 0);
+  ck_assert_int_eq(s21_is_equal(a, b), 0);
+}
+END_TEST
+
 Suite* test_comparison(void) {
   Suite* s = suite_create("s21_comparison");
 
@@ -82,6 +93,7 @@ Suite* test_comparison(void) {
   tcase_add_test(tc, is_less_mixed_signs_fn);
   tcase_add_test(tc, is_less_zero_signed_fn);
   tcase_add_test(tc, is_less_diff_scales_equal_value_fn);
+  tcase_add_test(tc, is_less_scale_up_even_carry_fn);
   suite_add_tcase(s, tc);
   return s;
 }
@@ -0,0 +1,210 @@
+/**
+ * @file tests_context.c
+ * @brief Тесты контекста вычислений и пакетных операций
+ * @details Содержит юнит-тесты для липких флагов контекста потока,
+ *          ограничения масштаба результата с режимом округления и
+ *          пакетных операций s21_*_batch
+ */
+
+#include "tests.h"
+
+/**
+ * @brief Тест флагов базовых операций
+ * @details Проверяет: точное сложение не ставит флагов, 1/3 ставит
+ *          INEXACT | ROUNDED, деление на 0 - DIV_BY_ZERO, переполнение
+ *          умножения - OVERFLOW. Флаги накапливаются до сброса
+ */
+START_TEST(context_sticky_flags) {
+  s21_context* ctx = s21_context_get();
+  s21_context_init(ctx);
+
+  s21_decimal one = {{1, 0, 0, 0}};
+  s21_decimal three = {{3, 0, 0, 0}};
+  s21_decimal zero = {{0, 0, 0, 0}};
+  s21_decimal max = {{0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0}};
+  s21_decimal r;
+
+  ck_assert_int_eq(s21_add(one, three, &r), 0);
+  ck_assert_uint_eq(ctx->flags, 0u);
+
+  ck_assert_int_eq(s21_div(one, three, &r), 0);
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_INEXACT | S21_FLAG_ROUNDED);
+
+  ck_assert_int_eq(s21_div(one, zero, &r), 3);
+  ck_assert_int_eq(s21_mul(max, max, &r), 1);
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_INEXACT | S21_FLAG_ROUNDED |
+                                    S21_FLAG_DIV_BY_ZERO | S21_FLAG_OVERFLOW);
+
+  s21_context_init(ctx);
+  ck_assert_uint_eq(ctx->flags, 0u);
+}
+END_TEST
+
+/**
+ * @brief Тест ограничения масштаба результата
+ * @details Проверяет: 1.005 * 1 при max_scale 2 дает 1.00 (HALF_EVEN)
+ *          и 1.01 (CEILING), флаги INEXACT | ROUNDED
+ */
+START_TEST(context_max_scale) {
+  s21_context ctx;
+  s21_context_init(&ctx);
+  ctx.max_scale = 2;
+
+  s21_decimal a = {{1005, 0, 0, 3 << 16}};  // 1.005
+  s21_decimal one = {{1, 0, 0, 0}};
+  s21_decimal r;
+
+  ck_assert_int_eq(s21_mul_ctx(a, one, &r, &ctx), 0);
+  ck_assert_int_eq(r.bits[0], 100);
+  ck_assert_int_eq(s21_get_scale(&r), 2);
+  ck_assert_uint_eq(ctx.flags, S21_FLAG_INEXACT | S21_FLAG_ROUNDED);
+
+  ctx.round = S21_ROUND_CEILING;
+  ctx.flags = 0u;
+  ck_assert_int_eq(s21_add_ctx(a, one, &r, &ctx), 0);
+  ck_assert_int_eq(r.bits[0], 201);  // 2.005 → 2.01
+
+  // флаги явного контекста не попадают в контекст потока
+  s21_context_init(s21_context_get());
+  ck_assert_int_eq(s21_sub_ctx(a, one, &r, &ctx), 0);
+  ck_assert_uint_eq(s21_context_get()->flags, 0u);
+  ck_assert_int_eq(s21_div_ctx(a, one, NULL, &ctx), 1);
+}
+END_TEST
+
+/**
+ * @brief Тест пакетных операций
+ * @details Проверяет: ошибочные элементы обнуляются, остальные считаются,
+ *          возвращаются флаги только этого вызова
+ */
+START_TEST(context_batches) {
+  s21_context_init(s21_context_get());
+
+  s21_decimal a[3] = {{{10, 0, 0, 0}}, {{7, 0, 0, 0}}, {{1, 0, 0, 0}}};
+  s21_decimal b[3] = {{{2, 0, 0, 0}}, {{0, 0, 0, 0}}, {{4, 0, 0, 0}}};
+  s21_decimal out[3];
+
+  unsigned flags = s21_div_batch(a, b, out, 3, NULL);
+  ck_assert_uint_eq(flags, S21_FLAG_DIV_BY_ZERO);
+  ck_assert_int_eq(out[0].bits[0], 5);
+  ck_assert_int_eq(s21_is_zero(&out[1]), 1);
+  ck_assert_int_eq(out[2].bits[0], 25);  // 0.25
+  ck_assert_int_eq(s21_get_scale(&out[2]), 2);
+
+  ck_assert_uint_eq(s21_add_batch(a, b, out, 3, NULL), 0u);
+  ck_assert_int_eq(out[1].bits[0], 7);
+  ck_assert_uint_eq(s21_sub_batch(a, b, out, 3, NULL), 0u);
+  ck_assert_int_eq(out[0].bits[0], 8);
+  ck_assert_uint_eq(s21_mul_batch(a, b, out, 3, NULL), 0u);
+  ck_assert_int_eq(out[2].bits[0], 4);
+
+  // флаги накоплены в контексте потока
+  ck_assert_uint_eq(s21_context_get()->flags, S21_FLAG_DIV_BY_ZERO);
+  ck_assert_uint_eq(s21_add_batch(NULL, b, out, 3, NULL), 0u);
+  s21_context_init(s21_context_get());
+}
+END_TEST
+
+/**
+ * @brief Тест счетчиков медленных путей
+ * @details В сборке с S21_STATS: 1/3 генерирует 28 цифр, сложение с
+ *          разными масштабами и переполнением мантиссы проходит ветку
+ *          округления и цикл переноса. Без S21_STATS снимок нулевой
+ */
+START_TEST(context_stats) {
+  s21_decimal one = {{1, 0, 0, 0}};
+  s21_decimal three = {{3, 0, 0, 0}};
+  s21_decimal big = {{0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0}};
+  s21_decimal tiny = {{6, 0, 0, 1 << 16}};  // 0.6
+  s21_decimal half = {{5, 0, 0, 1 << 16}};  // 0.5
+  s21_decimal r;
+  s21_stats st;
+
+  s21_stats_reset();
+  ck_assert_int_eq(s21_div(one, three, &r), 0);
+  ck_assert_int_eq(s21_add(big, tiny, &r), 1);   // 0.6 округляется до 1
+  ck_assert_int_eq(s21_add(half, half, &r), 0);  // 1.0
+  s21_stats_snapshot(&st);
+
+  if (s21_stats_enabled()) {
+    ck_assert_uint_eq(st.div_calls, 1);
+    ck_assert_uint_eq(st.div_digits, 28);
+    ck_assert_uint_eq(st.add_calls, 2);
+    ck_assert_uint_eq(st.add_align_round, 1);
+    ck_assert_uint_eq(st.mul_calls, 0);
+  } else {
+    ck_assert_uint_eq(st.div_calls + st.div_digits + st.add_calls, 0);
+  }
+
+  s21_stats_reset();
+  s21_stats_snapshot(&st);
+  ck_assert_uint_eq(st.add_calls + st.div_calls + st.div_digits, 0);
+  s21_stats_snapshot(NULL);
+}
+END_TEST
+
+/**
+ * @brief Тест одного округления в режиме контекста
+ * @details Проверяет: 2/3 и 1/3 с ROUND_UP дают ...6667 и ...3334, с
+ *          HALF_EVEN 2/3 = ...6667 (s21_div отбрасывает: ...6666),
+ *          (2^96 - 1) + 0.6 с ROUND_DOWN помещается, а с HALF_EVEN -
+ *          переполнение
+ */
+START_TEST(context_round_once) {
+  s21_context ctx;
+  s21_context_init(&ctx);
+  ctx.round = S21_ROUND_UP;
+
+  s21_decimal one = {{1, 0, 0, 0}};
+  s21_decimal two = {{2, 0, 0, 0}};
+  s21_decimal three = {{3, 0, 0, 0}};
+  s21_decimal r;
+
+  // 0.6666666666666666666666666667
+  ck_assert_int_eq(s21_div_ctx(two, three, &r, &ctx), 0);
+  ck_assert_uint_eq((uint32_t)r.bits[0], 0x0AAAAAABu);
+  ck_assert_uint_eq((uint32_t)r.bits[1], 0x296E0196u);
+  ck_assert_uint_eq((uint32_t)r.bits[2], 0x158A8994u);
+  ck_assert_int_eq(s21_get_scale(&r), 28);
+  ck_assert_uint_eq(ctx.flags, S21_FLAG_INEXACT | S21_FLAG_ROUNDED);
+
+  // 0.3333333333333333333333333334
+  ck_assert_int_eq(s21_div_ctx(one, three, &r, &ctx), 0);
+  ck_assert_uint_eq((uint32_t)r.bits[0], 0x05555556u);
+
+  ctx.round = S21_ROUND_HALF_EVEN;
+  ck_assert_int_eq(s21_div_ctx(two, three, &r, &ctx), 0);
+  ck_assert_uint_eq((uint32_t)r.bits[0], 0x0AAAAAABu);
+  ck_assert_int_eq(s21_div(two, three, &r), 0);
+  ck_assert_uint_eq((uint32_t)r.bits[0], 0x0AAAAAAAu);
+
+  s21_decimal max = {{-1, -1, -1, 0}};
+  s21_decimal tiny = {{6, 0, 0, 1 << 16}};  // 0.6
+  ck_assert_int_eq(s21_add_ctx(max, tiny, &r, &ctx), 1);
+  ck_assert_uint_eq(ctx.flags & S21_FLAG_OVERFLOW, S21_FLAG_OVERFLOW);
+  ctx.round = S21_ROUND_DOWN;
+  ctx.flags = 0u;
+  ck_assert_int_eq(s21_add_ctx(max, tiny, &r, &ctx), 0);
+  ck_assert_int_eq(s21_is_equal(r, max), 1);
+  ck_assert_uint_eq(ctx.flags, S21_FLAG_INEXACT | S21_FLAG_ROUNDED);
+  s21_context_init(s21_context_get());
+}
+END_TEST
+
+/**
+ * @brief Создание тестового набора для контекста вычислений
+ * @return Указатель на созданный Suite
+ */
+Suite* test_context(void) {
+  Suite* s = suite_create("s21_context");
+  TCase* tc = tcase_create("context_TC");
+
+  tcase_add_test(tc, context_sticky_flags);  // Липкие флаги
+  tcase_add_test(tc, context_max_scale);     // Ограничение масштаба
+  tcase_add_test(tc, context_batches);       // Пакетные операции
+  tcase_add_test(tc, context_stats);         // Счетчики медленных путей
+  tcase_add_test(tc, context_round_once);    // Одно округление
+
+  suite_add_tcase(s, tc);
+  return s;
+}
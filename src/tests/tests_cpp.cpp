@@ -0,0 +1,30 @@
+/**
+ * @file tests_cpp.cpp
+ * @brief Главный файл тестов C++ слоя (make test_cpp)
+ * @details Запускает наборы для s21_decimal.hpp, s21_fixed.hpp и
+ *          s21_expr.hpp
+ */
+
+#include "tests.h"
+
+int main(void) {
+  int fail = 0;
+
+  Suite *suites[] = {
+      test_decimal_hpp(),  // Обертка s21::Decimal
+      test_fixed(),        // Фиксированный масштаб s21::Fixed<Scale>
+      test_expr(),         // Шаблоны выражений с одним округлением
+      NULL                 // Маркер конца массива
+  };
+
+  for (int i = 0; suites[i]; i++) {
+    SRunner *sr = srunner_create(suites[i]);
+    srunner_set_fork_status(sr, CK_NOFORK);
+    srunner_run_all(sr, CK_NORMAL);
+    fail += srunner_ntests_failed(sr);
+    srunner_free(sr);
+  }
+
+  printf("FAILED TESTS: %d\n", fail);
+  return fail ? 1 : 0;
+}
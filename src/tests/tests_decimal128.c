@@ -0,0 +1,269 @@
+/**
+ * @file tests_decimal128.c
+ * @brief Тесты конвертации IEEE 754-2008 decimal128 (BID и DPD)
+ * @details Содержит юнит-тесты кодирования известных значений, округления
+ *          мантиссы больше 96 бит и масштаба больше 28, специальных и
+ *          неканонических значений, пакетных версий
+ */
+
+#include "tests.h"
+
+static s21_decimal128 mk128(uint64_t hi, uint64_t lo) {
+  s21_decimal128 d = {{lo, hi}};
+  return d;
+}
+
+// BID с порядком exp (без смещения) и мантиссой меньше 2^64
+static s21_decimal128 bid(int exp, uint64_t coef) {
+  return mk128((uint64_t)(exp + S21_DECIMAL128_BIAS) << 49, coef);
+}
+
+static int from_bid(s21_decimal128 x, s21_decimal *d) {
+  return s21_from_decimal128_to_decimal(x, S21_DECIMAL128_BID, d);
+}
+
+START_TEST(decimal128_bid_one) {
+  s21_decimal one = {{1, 0, 0, 0}};
+  s21_decimal128 x;
+  ck_assert_int_eq(
+      s21_from_decimal_to_decimal128(&one, S21_DECIMAL128_BID, &x), 0);
+  ck_assert_uint_eq(x.w[1], UINT64_C(0x3040000000000000));
+  ck_assert_uint_eq(x.w[0], 1u);
+}
+END_TEST
+
+START_TEST(decimal128_bid_max_roundtrip) {
+  s21_decimal max = {{-1, -1, -1, (int)(S21_SIGN_MASK | (28u << 16))}}, d;
+  s21_decimal128 x;
+  s21_from_decimal_to_decimal128(&max, S21_DECIMAL128_BID, &x);
+  ck_assert_int_eq(from_bid(x, &d), 0);
+  ck_assert_mem_eq(&d, &max, sizeof(d));
+}
+END_TEST
+
+// 2^96 * 10^-1 -> 7922816251426433759354395034
+START_TEST(decimal128_pow2_96_rounds_up) {
+  s21_context *ctx = s21_context_get();
+  s21_decimal d;
+  s21_context_init(ctx);
+  ck_assert_int_eq(from_bid(mk128(bid(-1, 0).w[1] | UINT64_C(1) << 32, 0), &d),
+                   0);
+  ck_assert_uint_eq((uint32_t)d.bits[0], 0x9999999Au);
+  ck_assert_uint_eq((uint32_t)d.bits[2], 0x19999999u);
+  ck_assert_int_eq(s21_get_scale(&d), 0);
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_ROUNDED | S21_FLAG_INEXACT);
+  s21_context_init(ctx);
+}
+END_TEST
+
+// мантисса 10^34 больше 34 цифр - ноль
+START_TEST(decimal128_bid_non_canonical) {
+  s21_decimal d = {{7, 0, 0, 0}};
+  s21_decimal128 x = mk128(UINT64_C(0x3040000000000000) |
+                               UINT64_C(0x1ED09BEAD87C0),
+                           UINT64_C(0x378D8E6400000000));
+  ck_assert_int_eq(from_bid(x, &d), 0);
+  ck_assert_int_eq(s21_is_zero(&d), 1);
+}
+END_TEST
+
+// форма с битами 11: мантисса не меньше 2^113 > 10^34 - ноль
+START_TEST(decimal128_bid_large_form) {
+  s21_decimal d = {{7, 0, 0, 0}};
+  ck_assert_int_eq(from_bid(mk128(UINT64_C(0x6000000000000000), 5u), &d), 0);
+  ck_assert_int_eq(s21_is_zero(&d), 1);
+}
+END_TEST
+
+START_TEST(decimal128_infinity) {
+  s21_decimal d;
+  s21_decimal128 inf = mk128(UINT64_C(0x7800000000000000), 0u);
+  ck_assert_int_eq(from_bid(inf, &d), 1);
+  ck_assert_int_eq(s21_from_decimal128_to_decimal(inf, S21_DECIMAL128_DPD, &d),
+                   1);
+}
+END_TEST
+
+START_TEST(decimal128_nan) {
+  s21_decimal d;
+  s21_decimal128 nan = mk128(UINT64_C(0xFC00000000000000), 0u);  // -NaN
+  ck_assert_int_eq(from_bid(nan, &d), 1);
+  ck_assert_int_eq(s21_from_decimal128_to_decimal(nan, S21_DECIMAL128_DPD, &d),
+                   1);
+}
+END_TEST
+
+// 1E+28 помещается, 1E+29 нет
+START_TEST(decimal128_positive_exponent) {
+  s21_decimal d;
+  ck_assert_int_eq(from_bid(bid(28, 1), &d), 0);
+  ck_assert_uint_eq((uint32_t)d.bits[2], 0x204FCE5Eu);
+  ck_assert_int_eq(s21_get_scale(&d), 0);
+  ck_assert_int_eq(from_bid(bid(29, 1), &d), 1);
+  s21_context_init(s21_context_get());
+}
+END_TEST
+
+// 15E-29 -> 2E-28
+START_TEST(decimal128_scale_over_28_half_even) {
+  s21_decimal d;
+  ck_assert_int_eq(from_bid(bid(-29, 15), &d), 0);
+  ck_assert_int_eq(d.bits[0], 2);
+  ck_assert_int_eq(s21_get_scale(&d), 28);
+  s21_context_init(s21_context_get());
+}
+END_TEST
+
+// 1E-100 -> 0E-28
+START_TEST(decimal128_tiny_to_zero) {
+  s21_decimal d;
+  ck_assert_int_eq(from_bid(bid(-100, 1), &d), 0);
+  ck_assert_int_eq(s21_is_zero(&d), 1);
+  ck_assert_int_eq(s21_get_scale(&d), 28);
+  s21_context_init(s21_context_get());
+}
+END_TEST
+
+// 2^96 с порядком 0 - ошибка с OVERFLOW, а не обрезка до 96 бит
+START_TEST(decimal128_coef_over_96_bits) {
+  s21_context *ctx = s21_context_get();
+  s21_decimal d = {{7, 0, 0, 0}};
+  s21_context_init(ctx);
+  ck_assert_int_eq(from_bid(mk128(bid(0, 0).w[1] | UINT64_C(1) << 32, 0), &d),
+                   1);
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_OVERFLOW);
+  ck_assert_int_eq(d.bits[0], 7);
+  s21_context_init(ctx);
+}
+END_TEST
+
+// 10^34 - 1 с порядком 0
+START_TEST(decimal128_max_coef_overflow) {
+  s21_decimal d;
+  s21_decimal128 x = mk128(bid(0, 0).w[1] | UINT64_C(0x1ED09BEAD87C0),
+                           UINT64_C(0x378D8E63FFFFFFFF));
+  ck_assert_int_eq(from_bid(x, &d), 1);
+  s21_context_init(s21_context_get());
+}
+END_TEST
+
+START_TEST(decimal128_dpd_one) {
+  s21_decimal one = {{1, 0, 0, 0}};
+  s21_decimal128 x;
+  ck_assert_int_eq(
+      s21_from_decimal_to_decimal128(&one, S21_DECIMAL128_DPD, &x), 0);
+  ck_assert_uint_eq(x.w[1], UINT64_C(0x2208000000000000));
+  ck_assert_uint_eq(x.w[0], 1u);
+}
+END_TEST
+
+START_TEST(decimal128_dpd_max) {
+  s21_decimal max = {{-1, -1, -1, (int)(S21_SIGN_MASK | (28u << 16))}}, d;
+  s21_decimal128 x;
+  s21_from_decimal_to_decimal128(&max, S21_DECIMAL128_DPD, &x);
+  ck_assert_uint_eq(x.w[1], UINT64_C(0xA2010001E52838A9));
+  ck_assert_uint_eq(x.w[0], UINT64_C(0x4591B7AEEC3371B5));
+  ck_assert_int_eq(s21_from_decimal128_to_decimal(x, S21_DECIMAL128_DPD, &d),
+                   0);
+  ck_assert_mem_eq(&d, &max, sizeof(d));
+}
+END_TEST
+
+// 1234567890123456789012345678901234E-10: 34 цифры, округление до 29
+START_TEST(decimal128_dpd_34_digits) {
+  s21_context *ctx = s21_context_get();
+  s21_decimal128 x =
+      mk128(UINT64_C(0x2605934B9C1E28E5), UINT64_C(0x6F3C127177823534));
+  s21_decimal d, expected;
+  const char text[] = "123456789012345678901234.56789";
+  s21_from_chars(text, text + sizeof(text) - 1, &expected, NULL);
+  s21_context_init(ctx);
+  ck_assert_int_eq(s21_from_decimal128_to_decimal(x, S21_DECIMAL128_DPD, &d),
+                   0);
+  ck_assert_mem_eq(&d, &expected, sizeof(d));
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_ROUNDED | S21_FLAG_INEXACT);
+  s21_context_init(ctx);
+}
+END_TEST
+
+// i * (10^6 + 10^3 + 1): значение i в трех декадах
+START_TEST(decimal128_dpd_all_declets) {
+  for (unsigned i = 0; i < 1000u; i++) {
+    s21_decimal v = {{(int)(i * 1001001u), 0, 0, 5 << 16}}, back;
+    s21_decimal128 x;
+    s21_from_decimal_to_decimal128(&v, S21_DECIMAL128_DPD, &x);
+    s21_from_decimal128_to_decimal(x, S21_DECIMAL128_DPD, &back);
+    ck_assert_mem_eq(&back, &v, sizeof(v));
+  }
+}
+END_TEST
+
+START_TEST(decimal128_batch_roundtrip) {
+  s21_decimal src[3] = {{{1999, 0, 0, 2 << 16}},
+                        {{-1, -1, -1, (int)S21_SIGN_MASK}},
+                        {{7, 0, 0, 0}}};
+  s21_decimal back[3];
+  s21_decimal128 packed[3];
+  for (int e = S21_DECIMAL128_BID; e <= S21_DECIMAL128_DPD; e++) {
+    s21_decimal128_encoding enc = (s21_decimal128_encoding)e;
+    ck_assert_int_eq(s21_from_decimal_to_decimal128_batch(src, enc, packed, 3),
+                     0);
+    ck_assert_int_eq(s21_from_decimal128_to_decimal_batch(packed, enc, back, 3),
+                     0);
+    ck_assert_mem_eq(back, src, sizeof(src));
+  }
+}
+END_TEST
+
+// NaN в середине: элемент получает 0, остальные переводятся
+START_TEST(decimal128_batch_error_zero) {
+  s21_decimal src[3] = {
+      {{1999, 0, 0, 2 << 16}}, {{5, 0, 0, 0}}, {{7, 0, 0, 0}}};
+  s21_decimal back[3];
+  s21_decimal128 packed[3];
+  s21_from_decimal_to_decimal128_batch(src, S21_DECIMAL128_DPD, packed, 3);
+  packed[1] = mk128(UINT64_C(0x7C00000000000000), 0u);
+  ck_assert_int_eq(
+      s21_from_decimal128_to_decimal_batch(packed, S21_DECIMAL128_DPD, back, 3),
+      1);
+  ck_assert_mem_eq(&back[0], &src[0], sizeof(back[0]));
+  ck_assert_int_eq(s21_is_zero(&back[1]), 1);
+  ck_assert_mem_eq(&back[2], &src[2], sizeof(back[2]));
+}
+END_TEST
+
+START_TEST(decimal128_batch_null) {
+  s21_decimal128 packed[1];
+  ck_assert_int_eq(
+      s21_from_decimal_to_decimal128_batch(NULL, S21_DECIMAL128_BID, packed, 1),
+      1);
+}
+END_TEST
+
+Suite *test_decimal128(void) {
+  Suite *s = suite_create("s21_decimal128");
+  TCase *tc = tcase_create("decimal128");
+
+  tcase_add_test(tc, decimal128_bid_one);
+  tcase_add_test(tc, decimal128_bid_max_roundtrip);
+  tcase_add_test(tc, decimal128_pow2_96_rounds_up);
+  tcase_add_test(tc, decimal128_bid_non_canonical);
+  tcase_add_test(tc, decimal128_bid_large_form);
+  tcase_add_test(tc, decimal128_infinity);
+  tcase_add_test(tc, decimal128_nan);
+  tcase_add_test(tc, decimal128_positive_exponent);
+  tcase_add_test(tc, decimal128_scale_over_28_half_even);
+  tcase_add_test(tc, decimal128_tiny_to_zero);
+  tcase_add_test(tc, decimal128_coef_over_96_bits);
+  tcase_add_test(tc, decimal128_max_coef_overflow);
+  tcase_add_test(tc, decimal128_dpd_one);
+  tcase_add_test(tc, decimal128_dpd_max);
+  tcase_add_test(tc, decimal128_dpd_34_digits);
+  tcase_add_test(tc, decimal128_dpd_all_declets);
+  tcase_add_test(tc, decimal128_batch_roundtrip);
+  tcase_add_test(tc, decimal128_batch_error_zero);
+  tcase_add_test(tc, decimal128_batch_null);
+
+  suite_add_tcase(s, tc);
+  return s;
+}
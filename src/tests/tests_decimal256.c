@@ -0,0 +1,209 @@
+/**
+ * @file tests_decimal256.c
+ * @brief Тесты числа с 256 бит мантиссой (s21_decimal256_*)
+ * @details Содержит юнит-тесты перевода в s21_decimal и обратно,
+ *          сложения, умножения с одним округлением и сравнения
+ */
+
+#include "tests.h"
+
+static s21_decimal256 mk256(unsigned lo, int scale, int sign) {
+  s21_decimal256 d = {{lo, 0, 0, 0, 0, 0, 0, 0}, scale, sign};
+  return d;
+}
+
+// 2^96 при заданном масштабе
+static s21_decimal256 pow2_96(int scale, int sign) {
+  s21_decimal256 d = mk256(0, scale, sign);
+  d.bits[3] = 1u;
+  return d;
+}
+
+START_TEST(decimal256_decimal_roundtrip) {
+  s21_decimal max = {{-1, -1, -1, (int)(S21_SIGN_MASK | (5u << 16))}};
+  s21_decimal256 w;
+  s21_decimal d;
+  ck_assert_int_eq(s21_decimal256_from_decimal(&max, &w), 0);
+  ck_assert_int_eq(w.scale, 5);
+  ck_assert_int_eq(w.sign, 1);
+  ck_assert_int_eq(s21_decimal256_to_decimal(&w, &d), 0);
+  ck_assert_mem_eq(&d, &max, sizeof(d));
+}
+END_TEST
+
+// 2^96 / 10 = 7922816251426433759354395033.6 -> ...034
+START_TEST(decimal256_pow2_96_rounds_up) {
+  s21_context *ctx = s21_context_get();
+  s21_decimal256 big = pow2_96(1, 0);
+  s21_decimal d;
+  s21_context_init(ctx);
+  ck_assert_int_eq(s21_decimal256_to_decimal(&big, &d), 0);
+  ck_assert_int_eq(s21_get_scale(&d), 0);
+  ck_assert_uint_eq((uint32_t)d.bits[0], 0x9999999Au);
+  ck_assert_uint_eq((uint32_t)d.bits[1], 0x99999999u);
+  ck_assert_uint_eq((uint32_t)d.bits[2], 0x19999999u);
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_ROUNDED | S21_FLAG_INEXACT);
+  s21_context_init(ctx);
+}
+END_TEST
+
+START_TEST(decimal256_to_decimal_too_large) {
+  s21_decimal256 big = pow2_96(0, 0);
+  s21_decimal d = {{7, 0, 0, 0}};
+  ck_assert_int_eq(s21_decimal256_to_decimal(&big, &d), 1);
+  ck_assert_int_eq(d.bits[0], 7);
+  big.sign = 1;
+  ck_assert_int_eq(s21_decimal256_to_decimal(&big, &d), 2);
+  ck_assert_int_eq(d.bits[0], 7);
+  s21_context_init(s21_context_get());
+}
+END_TEST
+
+// 2.5 * 10^-28 -> 2 * 10^-28, 3.5 * 10^-28 -> 4 * 10^-28
+START_TEST(decimal256_scale_over_28_half_even) {
+  s21_decimal256 tiny = mk256(25, 29, 0);
+  s21_decimal d;
+  ck_assert_int_eq(s21_decimal256_to_decimal(&tiny, &d), 0);
+  ck_assert_int_eq(d.bits[0], 2);
+  ck_assert_int_eq(s21_get_scale(&d), 28);
+  tiny = mk256(350, 30, 0);
+  ck_assert_int_eq(s21_decimal256_to_decimal(&tiny, &d), 0);
+  ck_assert_int_eq(d.bits[0], 4);
+  ck_assert_int_eq(s21_get_scale(&d), 28);
+  s21_context_init(s21_context_get());
+}
+END_TEST
+
+START_TEST(decimal256_convert_null) {
+  s21_decimal max = {{-1, -1, -1, 0}};
+  s21_decimal d;
+  ck_assert_int_eq(s21_decimal256_to_decimal(NULL, &d), 1);
+  ck_assert_int_eq(s21_decimal256_from_decimal(&max, NULL), 1);
+  ck_assert_int_eq(s21_decimal256_from_decimal(NULL, NULL), 1);
+}
+END_TEST
+
+// (2^96 - 1)^2 = 2^192 - 2^97 + 1
+START_TEST(decimal256_mul_max_decimal_exact) {
+  s21_decimal max = {{-1, -1, -1, 0}};
+  s21_decimal256 m, p;
+  uint32_t expected[8] = {1u, 0u, 0u, 0xFFFFFFFEu, ~0u, ~0u, 0u, 0u};
+  s21_decimal256_from_decimal(&max, &m);
+  ck_assert_int_eq(s21_decimal256_mul(&m, &m, &p), 0);
+  ck_assert_mem_eq(p.bits, expected, sizeof(expected));
+  ck_assert_int_eq(p.scale, 0);
+}
+END_TEST
+
+START_TEST(decimal256_accumulate_over_96_bits) {
+  s21_decimal max = {{-1, -1, -1, 0}};
+  s21_decimal256 m, p, acc = mk256(0, 0, 0);
+  s21_decimal256_from_decimal(&max, &m);
+  s21_decimal256_mul(&m, &m, &p);
+  for (int i = 0; i < 3; i++)
+    ck_assert_int_eq(s21_decimal256_add(&acc, &p, &acc), 0);
+  for (int i = 0; i < 3; i++)
+    ck_assert_int_eq(s21_decimal256_sub(&acc, &p, &acc), 0);
+  ck_assert_int_eq(uN_len(acc.bits, 8), 0);
+  ck_assert_int_eq(acc.sign, 0);
+}
+END_TEST
+
+// 1 + 10^-76: мантисса 10^76 + 1, масштаб 76, без округления
+START_TEST(decimal256_add_aligns_to_scale_76) {
+  s21_context *ctx = s21_context_get();
+  s21_decimal256 one = mk256(1, 0, 0), eps = mk256(1, 76, 0), x;
+  s21_context_init(ctx);
+  ck_assert_int_eq(s21_decimal256_add(&one, &eps, &x), 0);
+  ck_assert_int_eq(x.scale, 76);
+  ck_assert_uint_eq(ctx->flags, 0u);
+}
+END_TEST
+
+// (1 + e)^2 = 1 + 2e + e^2 -> 1 + 2e
+START_TEST(decimal256_mul_rounds_once) {
+  s21_context *ctx = s21_context_get();
+  s21_decimal256 one = mk256(1, 0, 0), eps = mk256(1, 76, 0), x, y, z;
+  s21_decimal256_add(&one, &eps, &x);
+  s21_decimal256_add(&x, &eps, &z);
+  s21_context_init(ctx);
+  ck_assert_int_eq(s21_decimal256_mul(&x, &x, &y), 0);
+  ck_assert_int_eq(y.scale, 76);
+  ck_assert_int_eq(s21_decimal256_compare(&y, &z), 0);
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_ROUNDED | S21_FLAG_INEXACT);
+  s21_context_init(ctx);
+}
+END_TEST
+
+// -2^255 * 2 и -2^255 + -2^255 не помещаются ни при каком масштабе
+START_TEST(decimal256_overflow) {
+  s21_context *ctx = s21_context_get();
+  s21_decimal256 top = mk256(0, 0, 1), two = mk256(2, 0, 0), z;
+  top.bits[7] = 0x80000000u;
+  s21_context_init(ctx);
+  ck_assert_int_eq(s21_decimal256_mul(&top, &two, &z), 2);
+  ck_assert_int_eq(s21_decimal256_add(&top, &top, &z), 2);
+  ck_assert_uint_eq(ctx->flags & S21_FLAG_OVERFLOW, S21_FLAG_OVERFLOW);
+  ck_assert_int_eq(s21_decimal256_sub(&top, &top, &z), 0);
+  ck_assert_int_eq(uN_len(z.bits, 8), 0);
+  s21_context_init(ctx);
+}
+END_TEST
+
+START_TEST(decimal256_arithmetic_null) {
+  s21_decimal256 one = mk256(1, 0, 0), z;
+  ck_assert_int_eq(s21_decimal256_add(NULL, &one, &z), 1);
+  ck_assert_int_eq(s21_decimal256_sub(&one, NULL, &z), 1);
+  ck_assert_int_eq(s21_decimal256_mul(&one, &one, NULL), 1);
+}
+END_TEST
+
+START_TEST(decimal256_compare_scales) {
+  s21_decimal256 a = mk256(10, 1, 0), b = mk256(100, 2, 0);
+  s21_decimal256 small = mk256(1, 76, 0);
+  ck_assert_int_eq(s21_decimal256_compare(&a, &b), 0);
+  ck_assert_int_eq(s21_decimal256_compare(&a, &small), 1);
+  ck_assert_int_eq(s21_decimal256_compare(&small, &a), -1);
+}
+END_TEST
+
+START_TEST(decimal256_compare_zero_sign) {
+  s21_decimal256 zero = mk256(0, 0, 0), neg_zero = mk256(0, 5, 1);
+  s21_decimal256 small = mk256(1, 76, 0), neg = mk256(15, 1, 1);
+  ck_assert_int_eq(s21_decimal256_compare(&zero, &neg_zero), 0);
+  ck_assert_int_eq(s21_decimal256_compare(&small, &neg_zero), 1);
+  ck_assert_int_eq(s21_decimal256_compare(&neg, &neg_zero), -1);
+}
+END_TEST
+
+START_TEST(decimal256_compare_negative) {
+  s21_decimal256 neg = mk256(15, 1, 1), minus_two = mk256(2, 0, 1);
+  s21_decimal256 one = mk256(1, 0, 0);
+  ck_assert_int_eq(s21_decimal256_compare(&minus_two, &neg), -1);
+  ck_assert_int_eq(s21_decimal256_compare(&neg, &minus_two), 1);
+  ck_assert_int_eq(s21_decimal256_compare(&neg, &one), -1);
+}
+END_TEST
+
+Suite *test_decimal256(void) {
+  Suite *s = suite_create("s21_decimal256");
+  TCase *tc = tcase_create("decimal256");
+
+  tcase_add_test(tc, decimal256_decimal_roundtrip);
+  tcase_add_test(tc, decimal256_pow2_96_rounds_up);
+  tcase_add_test(tc, decimal256_to_decimal_too_large);
+  tcase_add_test(tc, decimal256_scale_over_28_half_even);
+  tcase_add_test(tc, decimal256_convert_null);
+  tcase_add_test(tc, decimal256_mul_max_decimal_exact);
+  tcase_add_test(tc, decimal256_accumulate_over_96_bits);
+  tcase_add_test(tc, decimal256_add_aligns_to_scale_76);
+  tcase_add_test(tc, decimal256_mul_rounds_once);
+  tcase_add_test(tc, decimal256_overflow);
+  tcase_add_test(tc, decimal256_arithmetic_null);
+  tcase_add_test(tc, decimal256_compare_scales);
+  tcase_add_test(tc, decimal256_compare_zero_sign);
+  tcase_add_test(tc, decimal256_compare_negative);
+
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -0,0 +1,249 @@
+/**
+ * @file tests_decimal64.c
+ * @brief Тесты компактного числа 8 байт (s21_decimal64_*)
+ * @details Содержит юнит-тесты перевода в s21_decimal и обратно,
+ *          арифметики на быстром пути и с переходом в s21_decimal,
+ *          сравнения
+ */
+
+#include "tests.h"
+
+static s21_decimal64 mk64(uint64_t coef, int scale, int sign) {
+  s21_decimal64 d;
+  s21_decimal64_from_scaled_int64(sign ? -(int64_t)coef : (int64_t)coef,
+                                  scale, &d);
+  if (sign && coef == 0u) d.bits |= S21_DECIMAL64_SIGN_MASK;
+  return d;
+}
+
+// наибольшая мантисса 2^56 - 1
+static s21_decimal64 max64(int scale, int sign) {
+  return mk64(S21_DECIMAL64_COEF_MAX, scale, sign);
+}
+
+START_TEST(decimal64_field_layout) {
+  s21_decimal64 d;
+  ck_assert_int_eq(s21_decimal64_from_scaled_int64(-1999, 2, &d), 0);
+  ck_assert_uint_eq(d.bits, S21_DECIMAL64_SIGN_MASK |
+                                ((uint64_t)2 << S21_DECIMAL64_SCALE_SHIFT) |
+                                1999u);
+}
+END_TEST
+
+START_TEST(decimal64_to_decimal) {
+  s21_decimal x;
+  ck_assert_int_eq(s21_decimal64_to_decimal(mk64(1999, 2, 1), &x), 0);
+  ck_assert_int_eq(x.bits[0], 1999);
+  ck_assert_int_eq(x.bits[1], 0);
+  ck_assert_int_eq(s21_get_scale(&x), 2);
+  ck_assert_int_eq(s21_get_sign(&x), 1);
+}
+END_TEST
+
+// (2^56 - 1) * 10^-28 - наибольшая мантисса и масштаб
+START_TEST(decimal64_max_roundtrip) {
+  s21_decimal max = {{-1, 0x00FFFFFF, 0, 28 << 16}}, back;
+  s21_decimal64 d;
+  ck_assert_int_eq(s21_decimal64_from_decimal(&max, &d), 0);
+  ck_assert_uint_eq(d.bits & S21_DECIMAL64_COEF_MAX, S21_DECIMAL64_COEF_MAX);
+  ck_assert_int_eq(s21_decimal64_to_decimal(d, &back), 0);
+  ck_assert_mem_eq(&back, &max, sizeof(back));
+}
+END_TEST
+
+START_TEST(decimal64_coef_over_56_bits) {
+  s21_decimal pow56 = {{0, 0x01000000, 0, 0}};
+  s21_decimal64 d = mk64(7, 0, 0);
+  ck_assert_int_eq(s21_decimal64_from_decimal(&pow56, &d), 1);
+  ck_assert_uint_eq(d.bits, mk64(7, 0, 0).bits);
+  ck_assert_int_eq(s21_decimal64_from_scaled_int64(INT64_MIN, 0, &d), 1);
+  ck_assert_int_eq(s21_decimal64_from_scaled_int64(1ll << 56, 0, &d), 1);
+}
+END_TEST
+
+START_TEST(decimal64_bad_scale) {
+  s21_decimal64 d;
+  s21_decimal bad = {{1, 0, 0, 29 << 16}};
+  ck_assert_int_eq(s21_decimal64_from_scaled_int64(1, 29, &d), 1);
+  ck_assert_int_eq(s21_decimal64_from_scaled_int64(1, -1, &d), 1);
+  ck_assert_int_eq(s21_decimal64_from_decimal(&bad, &d), 1);
+}
+END_TEST
+
+START_TEST(decimal64_convert_null) {
+  s21_decimal64 d = mk64(1, 0, 0);
+  ck_assert_int_eq(s21_decimal64_from_decimal(NULL, &d), 1);
+  ck_assert_int_eq(s21_decimal64_to_decimal(d, NULL), 1);
+}
+END_TEST
+
+// элемент больше 56 бит получает 0, остальные переводятся
+START_TEST(decimal64_batch) {
+  s21_decimal src[3] = {
+      {{5, 0, 0, 1 << 16}}, {{0, 0x01000000, 0, 0}}, {{7, 0, 0, 0}}};
+  s21_decimal64 packed[3];
+  s21_decimal out[3];
+  ck_assert_int_eq(s21_decimal64_from_decimal_batch(src, packed, 3), 1);
+  ck_assert_uint_eq(packed[1].bits, 0u);
+  ck_assert_int_eq(s21_decimal64_to_decimal_batch(packed, out, 3), 0);
+  ck_assert_mem_eq(&out[0], &src[0], sizeof(out[0]));
+  ck_assert_int_eq(s21_is_zero(&out[1]), 1);
+  ck_assert_mem_eq(&out[2], &src[2], sizeof(out[2]));
+}
+END_TEST
+
+// 19.99 + 0.0001 = 19.9901
+START_TEST(decimal64_add_larger_scale) {
+  s21_decimal64 r;
+  s21_decimal wide;
+  ck_assert_int_eq(
+      s21_decimal64_add(mk64(1999, 2, 0), mk64(1, 4, 0), &r, &wide), 0);
+  ck_assert_uint_eq(r.bits, mk64(199901, 4, 0).bits);
+}
+END_TEST
+
+// -1.0 + 1.00 = 0.00 без знака
+START_TEST(decimal64_add_zero_unsigned) {
+  s21_decimal64 r;
+  s21_decimal wide;
+  ck_assert_int_eq(
+      s21_decimal64_add(mk64(10, 1, 1), mk64(100, 2, 0), &r, &wide), 0);
+  ck_assert_uint_eq(r.bits, mk64(0, 2, 0).bits);
+}
+END_TEST
+
+// 0.5 - 7 = -6.5
+START_TEST(decimal64_sub) {
+  s21_decimal64 r;
+  s21_decimal wide;
+  ck_assert_int_eq(
+      s21_decimal64_sub(mk64(5, 1, 0), mk64(7, 0, 0), &r, &wide), 0);
+  ck_assert_uint_eq(r.bits, mk64(65, 1, 1).bits);
+}
+END_TEST
+
+// 1.5 * -2.0 = -3.00
+START_TEST(decimal64_mul_scale_sum) {
+  s21_decimal64 r;
+  s21_decimal wide;
+  ck_assert_int_eq(
+      s21_decimal64_mul(mk64(15, 1, 0), mk64(20, 1, 1), &r, &wide), 0);
+  ck_assert_uint_eq(r.bits, mk64(300, 2, 1).bits);
+}
+END_TEST
+
+// (2^56 - 1) + 1 = 2^56 только в s21_decimal
+START_TEST(decimal64_add_promoted) {
+  s21_decimal64 r;
+  s21_decimal wide, expected = {{0, 0x01000000, 0, 0}};
+  ck_assert_int_eq(s21_decimal64_add(max64(0, 0), mk64(1, 0, 0), &r, &wide),
+                   S21_DECIMAL64_PROMOTED);
+  ck_assert_mem_eq(&wide, &expected, sizeof(wide));
+}
+END_TEST
+
+// 0 + 10^-28: выравнивание на 28 знаков, результат помещается
+START_TEST(decimal64_add_slow_path_fits) {
+  s21_decimal64 r;
+  s21_decimal wide;
+  ck_assert_int_eq(
+      s21_decimal64_add(mk64(0, 0, 0), mk64(1, 28, 0), &r, &wide), 0);
+  ck_assert_uint_eq(r.bits, mk64(1, 28, 0).bits);
+}
+END_TEST
+
+// 10^-20 * 10^-20: масштаб 40 округляется к 0 с масштабом 28
+START_TEST(decimal64_mul_scale_over_28) {
+  s21_context *ctx = s21_context_get();
+  s21_decimal64 r;
+  s21_decimal wide;
+  s21_context_init(ctx);
+  ck_assert_int_eq(
+      s21_decimal64_mul(mk64(1, 20, 0), mk64(1, 20, 0), &r, &wide),
+      S21_DECIMAL64_PROMOTED);
+  ck_assert_int_eq(s21_is_zero(&wide), 1);
+  ck_assert_int_eq(s21_get_scale(&wide), 28);
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_ROUNDED | S21_FLAG_INEXACT);
+  s21_context_init(ctx);
+}
+END_TEST
+
+// (2^56 - 1)^2 = 2^112 - 2^57 + 1 не помещается и в s21_decimal
+START_TEST(decimal64_mul_overflow) {
+  s21_context *ctx = s21_context_get();
+  s21_decimal64 r, neg_max = max64(0, 1);
+  s21_decimal wide;
+  s21_context_init(ctx);
+  ck_assert_int_eq(s21_decimal64_mul(max64(0, 0), max64(0, 0), &r, &wide), 1);
+  ck_assert_int_eq(s21_decimal64_mul(max64(0, 0), neg_max, &r, &wide), 2);
+  ck_assert_uint_eq(ctx->flags & S21_FLAG_OVERFLOW, S21_FLAG_OVERFLOW);
+  s21_context_init(ctx);
+}
+END_TEST
+
+START_TEST(decimal64_arithmetic_null) {
+  s21_decimal64 r;
+  s21_decimal wide;
+  ck_assert_int_eq(s21_decimal64_add(max64(0, 0), max64(0, 0), NULL, &wide),
+                   1);
+  ck_assert_int_eq(s21_decimal64_mul(max64(0, 0), max64(0, 0), &r, NULL), 1);
+}
+END_TEST
+
+START_TEST(decimal64_compare_scales) {
+  ck_assert_int_eq(s21_decimal64_compare(mk64(10, 1, 0), mk64(100, 2, 0)), 0);
+  ck_assert_int_eq(s21_decimal64_compare(mk64(10, 1, 0), mk64(1, 28, 0)), 1);
+  ck_assert_int_eq(s21_decimal64_compare(mk64(1, 28, 0), mk64(10, 1, 0)), -1);
+}
+END_TEST
+
+START_TEST(decimal64_compare_zero_sign) {
+  s21_decimal64 zero = mk64(0, 0, 0), neg_zero = mk64(0, 5, 1);
+  ck_assert_int_eq(s21_decimal64_compare(zero, neg_zero), 0);
+  ck_assert_int_eq(s21_decimal64_compare(mk64(15, 1, 1), zero), -1);
+  ck_assert_int_eq(s21_decimal64_compare(mk64(1, 28, 0), neg_zero), 1);
+}
+END_TEST
+
+START_TEST(decimal64_compare_negative) {
+  ck_assert_int_eq(s21_decimal64_compare(mk64(2, 0, 1), mk64(15, 1, 1)), -1);
+  ck_assert_int_eq(s21_decimal64_compare(mk64(15, 1, 1), mk64(2, 0, 1)), 1);
+}
+END_TEST
+
+// разница масштабов больше 19: выравнивание не помещается в 64 бита
+START_TEST(decimal64_compare_far_scales) {
+  ck_assert_int_eq(s21_decimal64_compare(mk64(1, 28, 0), max64(0, 0)), -1);
+  ck_assert_int_eq(s21_decimal64_compare(max64(28, 0), mk64(1, 0, 0)), -1);
+  ck_assert_int_eq(s21_decimal64_compare(max64(0, 0), max64(1, 0)), 1);
+}
+END_TEST
+
+Suite *test_decimal64(void) {
+  Suite *s = suite_create("s21_decimal64");
+  TCase *tc = tcase_create("decimal64");
+
+  tcase_add_test(tc, decimal64_field_layout);
+  tcase_add_test(tc, decimal64_to_decimal);
+  tcase_add_test(tc, decimal64_max_roundtrip);
+  tcase_add_test(tc, decimal64_coef_over_56_bits);
+  tcase_add_test(tc, decimal64_bad_scale);
+  tcase_add_test(tc, decimal64_convert_null);
+  tcase_add_test(tc, decimal64_batch);
+  tcase_add_test(tc, decimal64_add_larger_scale);
+  tcase_add_test(tc, decimal64_add_zero_unsigned);
+  tcase_add_test(tc, decimal64_sub);
+  tcase_add_test(tc, decimal64_mul_scale_sum);
+  tcase_add_test(tc, decimal64_add_promoted);
+  tcase_add_test(tc, decimal64_add_slow_path_fits);
+  tcase_add_test(tc, decimal64_mul_scale_over_28);
+  tcase_add_test(tc, decimal64_mul_overflow);
+  tcase_add_test(tc, decimal64_arithmetic_null);
+  tcase_add_test(tc, decimal64_compare_scales);
+  tcase_add_test(tc, decimal64_compare_zero_sign);
+  tcase_add_test(tc, decimal64_compare_negative);
+  tcase_add_test(tc, decimal64_compare_far_scales);
+
+  suite_add_tcase(s, tc);
+  return s;
+}
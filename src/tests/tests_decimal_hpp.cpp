@@ -0,0 +1,219 @@
+/**
+ * @file tests_decimal_hpp.cpp
+ * @brief Тесты C++ обертки s21::Decimal
+ * @details Собирается отдельно (make test_cpp): операторы, сравнение
+ *          чисел с разным масштабом, std::hash, std::numeric_limits,
+ *          to_chars / from_chars и работа с алгоритмами STL
+ */
+
+#include "../s21_decimal.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <unordered_set>
+#include <vector>
+
+#include "tests.h"
+
+using s21::Decimal;
+
+// число из строки (без проверки ошибок)
+static Decimal dec(const char *s) {
+  Decimal d;
+  s21::from_chars(s, s + std::strlen(s), d);
+  return d;
+}
+
+/**
+ * @brief Тест арифметических операторов
+ * @details Проверяет: 19.99 * 3 + 0.03 = 60.00, 1 / 4 = 0.25, -x,
+ *          деление на 0 дает 0 и флаг DIV_BY_ZERO
+ */
+START_TEST(hpp_operators) {
+  Decimal price = Decimal::from_scaled(1999, 2);
+  Decimal total = price * 3 + dec("0.03");
+
+  ck_assert(total == 60);
+  ck_assert(s21::to_string(total) == "60");
+  ck_assert(Decimal(1) / Decimal(4) == dec("0.25"));
+  ck_assert(-price == Decimal::from_scaled(-1999, 2));
+  ck_assert(-(-price) == price);
+
+  Decimal acc;
+  acc += price;
+  acc -= dec("0.99");
+  ck_assert(acc == 19);
+
+  s21_context *ctx = s21_context_get();
+  s21_context_init(ctx);
+  ck_assert(Decimal(5) / Decimal() == Decimal());
+  ck_assert_uint_eq(ctx->flags & S21_FLAG_DIV_BY_ZERO, S21_FLAG_DIV_BY_ZERO);
+  s21_context_init(ctx);
+
+  Decimal out;
+  ck_assert_int_eq(s21::div(Decimal(1), Decimal(), out), 3);
+  ck_assert_int_eq(s21::mul(std::numeric_limits<Decimal>::max(), 2, out), 1);
+}
+END_TEST
+
+/**
+ * @brief Тест сравнений и хеша
+ * @details Проверяет: 1.0 == 1.00, 0 == -0, -0.5 < 0.25 < 1, одинаковый
+ *          хеш у равных чисел с разным масштабом
+ */
+START_TEST(hpp_compare_hash) {
+  ck_assert(dec("1.0") == dec("1.00"));
+  ck_assert(dec("0") == dec("-0.000"));
+  ck_assert(dec("-0.5") < dec("0.25"));
+  ck_assert(dec("0.25") < 1);
+  ck_assert(dec("2.50") > dec("2.499"));
+  ck_assert(dec("-2.50") <= dec("-2.5"));
+  ck_assert_int_eq(compare(dec("-3"), dec("-2")), -1);
+
+  std::hash<Decimal> h;
+  ck_assert(h(dec("1.0")) == h(dec("1.00")));
+  ck_assert(h(dec("0")) == h(dec("-0.0")));
+
+  std::unordered_set<Decimal> set = {dec("1.5"), dec("1.50"), dec("2")};
+  ck_assert_uint_eq(set.size(), 2);
+}
+END_TEST
+
+/**
+ * @brief Тест numeric_limits и текстового представления
+ * @details Проверяет: max = 2^96 - 1, lowest = -max, min = 1e-28,
+ *          ошибки from_chars
+ */
+START_TEST(hpp_limits_chars) {
+  using lim = std::numeric_limits<Decimal>;
+  ck_assert(lim::is_specialized && lim::is_exact && lim::radix == 10);
+  ck_assert(s21::to_string(lim::max()) == "79228162514264337593543950335");
+  ck_assert(lim::lowest() == -lim::max());
+  ck_assert(s21::to_string(lim::min()) == "0.0000000000000000000000000001");
+
+  char buf[8];
+  auto r = s21::to_chars(buf, buf + sizeof(buf), lim::max());
+  ck_assert(r.ec == std::errc::value_too_large);
+
+  Decimal d;
+  const char *s = "99999999999999999999999999999";
+  auto p = s21::from_chars(s, s + std::strlen(s), d);
+  ck_assert(p.ec == std::errc::result_out_of_range);
+  s = "abc";
+  p = s21::from_chars(s, s + 3, d);
+  ck_assert(p.ec == std::errc::invalid_argument && p.ptr == s);
+}
+END_TEST
+
+/**
+ * @brief Тест совместимости с массивами C и алгоритмами STL
+ * @details Проверяет: массив s21_decimal виден как массив Decimal,
+ *          std::accumulate и std::sort работают без явных вызовов s21_*
+ */
+START_TEST(hpp_arrays_stl) {
+  s21_decimal raw[4];
+  s21_from_scaled_int64_to_decimal(250, 2, &raw[0]);
+  s21_from_scaled_int64_to_decimal(-1, 0, &raw[1]);
+  s21_from_scaled_int64_to_decimal(125, 1, &raw[2]);
+  s21_from_scaled_int64_to_decimal(0, 0, &raw[3]);
+
+  Decimal *view = s21::as_decimal(raw);
+  Decimal sum = std::accumulate(view, view + 4, Decimal());
+  ck_assert(sum == dec("14"));
+
+  std::sort(view, view + 4);
+  ck_assert(view[0] == -1 && view[3] == dec("12.5"));
+  ck_assert_int_eq(raw[1].bits[0], 0);
+  ck_assert(s21::as_raw(view) == raw);
+
+  std::vector<Decimal> prices = {dec("10.10"), dec("0.01"), dec("5")};
+  ck_assert(*std::max_element(prices.begin(), prices.end()) == dec("10.1"));
+}
+END_TEST
+
+using namespace s21::literals;
+
+// константы при компиляции: литералы и constexpr +, -, *, сравнения
+constexpr Decimal kPrice = "19.99"_dec;
+static_assert(kPrice * 3 + 0.03_dec == 60, "19.99 * 3 + 0.03 = 60");
+static_assert(kPrice.scale() == 2 && (kPrice - kPrice).scale() == 0,
+              "масштаб как у библиотеки");
+static_assert("-0.5"_dec < 0.25_dec && 1.0_dec == 1.00_dec, "сравнения");
+static_assert("0.00000000000000000000000000015"_dec ==
+                  Decimal::from_scaled(2, 28),
+              "лишние цифры округляются к четному");
+
+/**
+ * @brief Тест совпадения constexpr операций с библиотекой
+ * @details Для всех пар из набора граничных значений сложение,
+ *          вычитание, умножение и сравнение в s21::detail дают те же
+ *          биты и коды ошибок, что s21_add_p / s21_sub_p / s21_mul_p
+ */
+START_TEST(hpp_constexpr_matches_library) {
+  const char *values[] = {"0",
+                          "-0.000",
+                          "1",
+                          "-1.5",
+                          "0.0000000000000000000000000001",
+                          "1.0000000000000000000000000005",
+                          "7922816251426433759354395033.5",
+                          "79228162514264337593543950335",
+                          "-79228162514264337593543950335",
+                          "1000000000000000.5",
+                          "12345.6789",
+                          "0.149"};
+  const int n = sizeof(values) / sizeof(values[0]);
+
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      Decimal a = dec(values[i]), b = dec(values[j]);
+      s21_decimal lib = {{0, 0, 0, 0}}, ce = {{0, 0, 0, 0}};
+
+      int lib_code = s21_add_p(&a.raw(), &b.raw(), &lib);
+      ck_assert_int_eq(s21::detail::ce_add_sub(a.raw(), b.raw(), false, ce),
+                       lib_code);
+      if (lib_code == 0) ck_assert_mem_eq(&ce, &lib, sizeof(lib));
+
+      lib_code = s21_sub_p(&a.raw(), &b.raw(), &lib);
+      ck_assert_int_eq(s21::detail::ce_add_sub(a.raw(), b.raw(), true, ce),
+                       lib_code);
+      if (lib_code == 0) ck_assert_mem_eq(&ce, &lib, sizeof(lib));
+
+      lib_code = s21_mul_p(&a.raw(), &b.raw(), &lib);
+      ck_assert_int_eq(s21::detail::ce_mul(a.raw(), b.raw(), ce) != 0,
+                       lib_code != 0);
+      if (lib_code == 0) ck_assert_mem_eq(&ce, &lib, sizeof(lib));
+
+      int cmp = s21_is_less(a.raw(), b.raw()) ? -1
+                : s21_is_equal(a.raw(), b.raw()) ? 0
+                                                 : 1;
+      ck_assert_int_eq(s21::detail::ce_compare(a.raw(), b.raw()), cmp);
+    }
+  }
+
+  // литерал во время выполнения совпадает с from_chars
+  Decimal lit = "1.23456789012345678901234567895"_dec;
+  Decimal parsed = dec("1.23456789012345678901234567895");
+  ck_assert_mem_eq(&lit.raw(), &parsed.raw(), sizeof(s21_decimal));
+  ck_assert("1x"_dec == 0);
+}
+END_TEST
+
+/**
+ * @brief Создание тестового набора для C++ обертки
+ * @return Указатель на созданный Suite
+ */
+Suite *test_decimal_hpp(void) {
+  Suite *s = suite_create("s21_decimal_hpp");
+  TCase *tc = tcase_create("decimal_hpp_TC");
+
+  tcase_add_test(tc, hpp_operators);     // Операторы
+  tcase_add_test(tc, hpp_compare_hash);  // Сравнения и хеш
+  tcase_add_test(tc, hpp_limits_chars);  // Пределы и текст
+  tcase_add_test(tc, hpp_arrays_stl);    // Массивы и STL
+  tcase_add_test(tc, hpp_constexpr_matches_library);  // constexpr операции
+
+  suite_add_tcase(s, tc);
+  return s;
+}
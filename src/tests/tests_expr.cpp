@@ -0,0 +1,127 @@
+/**
+ * @file tests_expr.cpp
+ * @brief Тесты шаблонов выражений s21_expr.hpp
+ * @details Собирается отдельно (make test_cpp): одно округление в конце
+ *          вместо округления каждого шага, точные промежуточные значения
+ *          больше 96 бит, перенос при округлении, переполнение и флаги,
+ *          constexpr вычисление
+ */
+
+#include "../s21_expr.hpp"
+
+#include <cstring>
+#include <limits>
+
+#include "tests.h"
+
+using s21::Decimal;
+using s21::fused;
+using namespace s21::literals;
+
+// число из строки (без проверки ошибок)
+static Decimal dec(const char *s) {
+  Decimal d;
+  s21::from_chars(s, s + std::strlen(s), d);
+  return d;
+}
+
+// вычисления на этапе компиляции
+static_assert((fused(2) * 3 + 1).value() == 7, "2 * 3 + 1");
+static_assert((fused(19.99_dec) * 3 + 0.03_dec).value().scale() == 2,
+              "масштаб точного значения: 60.00");
+static_assert((fused(1.5_dec) * 2 - fused(4) * 0.75_dec).value().is_zero(),
+              "3.0 - 3.00 = 0");
+static_assert((-(fused(1) - 3)).value() == 2, "-(1 - 3)");
+static_assert(decltype(fused(1) * 1 + fused(1) * 1 - 1)::node_type::limbs ==
+                  17,
+              "худший случай: 6 + 6 + 1, затем + 3 + 1");
+
+/**
+ * @brief Тест одного округления
+ * @details Проверяет: результат совпадает с точным значением,
+ *          округленным один раз, и не зависит от порядка операций,
+ *          промежуточное произведение больше 96 бит не переполняется
+ */
+START_TEST(expr_single_rounding) {
+  Decimal max = std::numeric_limits<Decimal>::max();
+  Decimal half = dec("0.5");
+  Decimal big = dec("39614081257132168796771975167");
+
+  // цепочка: max * 0.5 округляется до ...168, затем - ...167 = 1
+  ck_assert(max * half - big == 1);
+  ck_assert(Decimal(fused(max) * half - big) == half);
+  ck_assert(Decimal(-fused(big) + max * fused(half)) == half);
+
+  // (max * max) - (max * max): 192 бита без переполнения
+  Decimal zero = fused(max) * max - fused(max) * max;
+  ck_assert(zero.is_zero());
+  ck_assert(!zero.is_negative());
+
+  Decimal a = dec("0.1234567890123456789012345678");
+  Decimal b = dec("9.876543210987654321098765432");
+  Decimal c = dec("-3.1415926535897932384626433832");
+  Decimal d = dec("2.7182818284590452353602874713");
+  Decimal e = dec("1.0000000000000000000000000001");
+
+  // точное значение -8.3204079113033491132017005428300... (56 знаков)
+  Decimal r = fused(a) * b + fused(c) * d - e;
+  ck_assert(s21::to_string(r) == "-8.320407911303349113201700543");
+  ck_assert(Decimal(-e + fused(d) * c + fused(b) * a) == r);
+  ck_assert(Decimal(fused(a) * b) == a * b);
+
+  // 1/3 * 3 без округления: масштаб 28
+  Decimal third = dec("0.3333333333333333333333333333");
+  Decimal one = fused(third) * 3;
+  ck_assert(s21::to_string(one) == "0.9999999999999999999999999999");
+}
+END_TEST
+
+/**
+ * @brief Тест округления, переполнения и флагов
+ * @details Проверяет: 2^96 после округления теряет еще одну цифру,
+ *          код и знак переполнения, флаги ROUNDED / INEXACT, точный
+ *          результат не поднимает флагов
+ */
+START_TEST(expr_rounding_overflow) {
+  s21_context *ctx = s21_context_get();
+  s21_context_init(ctx);
+
+  Decimal max = std::numeric_limits<Decimal>::max();
+  ck_assert(Decimal(fused(dec("19.99")) * 3 + dec("0.03")) == 60);
+  ck_assert_uint_eq(ctx->flags, 0u);
+
+  // ...033.55 -> ...0336 (2^96) -> ...034
+  Decimal tenth = dec("7922816251426433759354395033.5");
+  Decimal r = fused(tenth) + dec("0.05");
+  ck_assert(s21::to_string(r) == "7922816251426433759354395034");
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_ROUNDED | S21_FLAG_INEXACT);
+
+  s21_context_init(ctx);
+  ck_assert(Decimal(fused(max) + dec("0.4")) == max);
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_ROUNDED | S21_FLAG_INEXACT);
+
+  s21_context_init(ctx);
+  Decimal out = 5;
+  ck_assert_int_eq((fused(max) + dec("0.5")).eval(out), 1);
+  ck_assert(out == 5);
+  ck_assert_int_eq((-fused(max) * 2).eval(out), 2);
+  ck_assert((fused(max) * max).value().is_zero());
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_OVERFLOW);
+  s21_context_init(ctx);
+}
+END_TEST
+
+/**
+ * @brief Создание тестового набора для s21_expr.hpp
+ * @return Указатель на созданный Suite
+ */
+Suite *test_expr(void) {
+  Suite *s = suite_create("s21_expr");
+  TCase *tc = tcase_create("expr_TC");
+
+  tcase_add_test(tc, expr_single_rounding);    // Одно округление
+  tcase_add_test(tc, expr_rounding_overflow);  // Округление и ошибки
+
+  suite_add_tcase(s, tc);
+  return s;
+}
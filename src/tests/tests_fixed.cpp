@@ -0,0 +1,178 @@
+/**
+ * @file tests_fixed.cpp
+ * @brief Тесты s21::Fixed<Scale>
+ * @details Собирается отдельно (make test_cpp): арифметика в одном и в
+ *          разных масштабах, constexpr вычисления, перевод в s21_decimal
+ *          и обратно, округление и переполнение
+ */
+
+#include "../s21_fixed.hpp"
+
+#include <cstring>
+
+#include "tests.h"
+
+using s21::Decimal;
+using s21::Fixed;
+
+using Cents = Fixed<2>;
+using Bps = Fixed<4>;
+
+// число из строки (без проверки ошибок)
+static Decimal dec(const char *s) {
+  Decimal d;
+  s21::from_chars(s, s + std::strlen(s), d);
+  return d;
+}
+
+// вычисления на этапе компиляции
+static_assert(Cents::from_units(1999) * 3 + Cents(1) ==
+                  Cents::from_units(6097),
+              "19.99 * 3 + 1 = 60.97");
+static_assert(Cents::from_units(150) + Bps::from_units(25) ==
+                  Bps::from_units(15025),
+              "1.50 + 0.0025 = 1.5025");
+static_assert(Cents::from_units(-5) < Cents(0), "-0.05 < 0");
+static_assert(Cents(2) * Cents(3) == Fixed<4>(6), "масштаб складывается");
+static_assert(Bps::from_units(12345).rescale<2>() == Cents::from_units(123),
+              "1.2345 -> 1.23");
+static_assert(sizeof(Cents) == 16, "мантисса и знак");
+
+/**
+ * @brief Тест арифметики одного и разных масштабов
+ * @details Проверяет: знаки при сложении, разность в большем масштабе,
+ *          -0 не отличается от 0, mul<R> и деление с округлением
+ */
+START_TEST(fixed_arithmetic) {
+  Cents a = Cents::from_units(1050);   // 10.50
+  Cents b = Cents::from_units(-1275);  // -12.75
+
+  ck_assert(a + b == Cents::from_units(-225));
+  ck_assert(b - b == Cents());
+  ck_assert(!(-Cents()).is_negative());
+  ck_assert(a - Bps::from_units(1) == Bps::from_units(104999));
+
+  // 10.50 * 0.0725 = 0.761250 -> 0.76
+  ck_assert(s21::mul<2>(a, Bps::from_units(725)) == Cents::from_units(76));
+  // 0.125 -> 0.12 (к четному), -0.135 -> -0.14
+  ck_assert(s21::mul<2>(Fixed<3>::from_units(125), Fixed<0>(1)) ==
+            Cents::from_units(12));
+  ck_assert(s21::mul<2>(Fixed<3>::from_units(-135), Fixed<0>(1)) ==
+            Cents::from_units(-14));
+
+  // 10 / 3 = 3.33, 2 / 3 = 0.67, 1.00 / 8 = 0.125 -> 0.12
+  ck_assert(Cents(10) / Cents(3) == Cents::from_units(333));
+  ck_assert(Cents(2) / Cents(3) == Cents::from_units(67));
+  ck_assert(Cents(1) / Cents(8) == Cents::from_units(12));
+  ck_assert(s21::div<4>(Cents(-1), Fixed<0>(8)) == Bps::from_units(-1250));
+  ck_assert(s21::div<0>(Bps::from_units(1), Cents(1)) == Fixed<0>());
+
+  Cents acc;
+  for (int i = 0; i < 100; i++) acc += Cents::from_units(1);
+  ck_assert(acc == Cents(1));
+  ck_assert_int_eq(compare(Cents(1), Bps::from_units(9999)), 1);
+  ck_assert(Cents(1) == Fixed<28>(1));
+}
+END_TEST
+
+/**
+ * @brief Тест перевода в s21_decimal и обратно
+ * @details Проверяет: масштаб результата равен Scale, меньший масштаб
+ *          домножается, больший округляется к четному с флагом
+ */
+START_TEST(fixed_decimal) {
+  Cents price = Cents::from_units(-1999);
+  s21_decimal d = price.to_decimal();
+  ck_assert_int_eq(s21_get_scale(&d), 2);
+  ck_assert(Decimal(d) == dec("-19.99"));
+  ck_assert(s21::to_string(price) == "-19.99");
+  ck_assert(s21::to_string(Bps(3)) == "3.0000");
+
+  Cents c;
+  ck_assert_int_eq(Cents::from_decimal(dec("7.5").raw(), c), 0);
+  ck_assert(c == Cents::from_units(750));
+
+  s21_context *ctx = s21_context_get();
+  s21_context_init(ctx);
+  ck_assert_int_eq(Cents::from_decimal(dec("2.345").raw(), c), 0);
+  ck_assert(c == Cents::from_units(234));
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_ROUNDED | S21_FLAG_INEXACT);
+  ck_assert(Cents(dec("-2.355")) == Cents::from_units(-236));
+
+  // 7 * 10^28 помещается в 96 бит, 8 * 10^28 - нет
+  Fixed<28> fine;
+  ck_assert_int_eq(Fixed<28>::from_decimal(dec("7").raw(), fine), 0);
+  ck_assert_int_eq(Fixed<28>::from_decimal(dec("8").raw(), fine), 1);
+  s21_context_init(ctx);
+}
+END_TEST
+
+/**
+ * @brief Тест переполнения и деления на ноль
+ * @details Проверяет: результат 0 и флаги OVERFLOW / DIV_BY_ZERO,
+ *          from_decimal не меняет out при переполнении
+ */
+START_TEST(fixed_overflow) {
+  s21_context *ctx = s21_context_get();
+  s21_context_init(ctx);
+
+  Fixed<0> max = Fixed<0>::from_magnitude({{~0u, ~0u, ~0u}}, false);
+  ck_assert((max + Fixed<0>(1)).is_zero());
+  ck_assert_uint_eq(ctx->flags & S21_FLAG_OVERFLOW, S21_FLAG_OVERFLOW);
+  ck_assert(max - max == Fixed<0>());
+  ck_assert((max * 2).is_zero());
+  ck_assert(max.rescale<1>().is_zero());
+
+  Cents c = Cents(5);
+  s21_decimal big = std::numeric_limits<Decimal>::max().raw();
+  ck_assert_int_eq(Cents::from_decimal(big, c), 1);
+  ck_assert(c == Cents(5));
+
+  s21_context_init(ctx);
+  ck_assert((Cents(1) / Cents()).is_zero());
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_DIV_BY_ZERO);
+  s21_context_init(ctx);
+}
+END_TEST
+
+/**
+ * @brief Тест флагов при смене масштаба
+ * @details Проверяет: 1.50 + 0.0001 = 1.5001 без флагов (больший масштаб
+ *          точен), 1.2345 -> 1.23 дает ROUNDED и INEXACT, 1.2300 -> 1.23
+ *          только ROUNDED
+ */
+START_TEST(fixed_rescale_flags) {
+  s21_context *ctx = s21_context_get();
+  s21_context_init(ctx);
+
+  ck_assert(Cents::from_units(150) + Bps::from_units(1) ==
+            Bps::from_units(15001));
+  ck_assert(Cents::from_units(150).rescale<4>() == Bps::from_units(15000));
+  ck_assert_uint_eq(ctx->flags, 0u);
+
+  ck_assert(Bps::from_units(12345).rescale<2>() == Cents::from_units(123));
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_ROUNDED | S21_FLAG_INEXACT);
+
+  s21_context_init(ctx);
+  ck_assert(Bps::from_units(12300).rescale<2>() == Cents::from_units(123));
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_ROUNDED);
+  s21_context_init(ctx);
+}
+END_TEST
+
+/**
+ * @brief Создание тестового набора для s21::Fixed
+ * @return Указатель на созданный Suite
+ */
+Suite *test_fixed(void) {
+  Suite *s = suite_create("s21_fixed");
+  TCase *tc = tcase_create("fixed_TC");
+
+  tcase_add_test(tc, fixed_arithmetic);     // Арифметика
+  tcase_add_test(tc, fixed_decimal);        // Перевод в s21_decimal
+  tcase_add_test(tc, fixed_overflow);       // Ошибки
+  tcase_add_test(tc, fixed_rescale_flags);  // Флаги смены масштаба
+
+  suite_add_tcase(s, tc);
+  return s;
+}
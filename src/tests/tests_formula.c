@@ -0,0 +1,266 @@
+/**
+ * @file tests_formula.c
+ * @brief Тесты формул над столбцами (s21_formula_*)
+ * @details Содержит юнит-тесты компиляции в байткод, ошибок разбора и
+ *          лимитов, вычисления по столбцам блоками
+ */
+
+#include <string.h>
+
+#include "tests.h"
+
+// (a+a)*((a+a)*(...a...)) из levels уровней: каждый держит регистр
+static void nested_formula(char *buf, int levels) {
+  strcpy(buf, "a");
+  for (int level = 0; level < levels; level++) {
+    char tmp[256];
+    strcpy(tmp, "(a+a)*(");
+    strcat(tmp, buf);
+    strcat(tmp, ")");
+    strcpy(buf, tmp);
+  }
+}
+
+START_TEST(formula_vars_in_order) {
+  s21_formula f;
+  size_t pos = 99;
+  ck_assert_int_eq(
+      s21_formula_compile("qty * price * (1 - disc) + fee", &f, &pos), 0);
+  ck_assert_uint_eq(pos, 0);
+  ck_assert_int_eq(f.n_vars, 4);
+  ck_assert_int_eq(s21_formula_var(&f, "qty"), 0);
+  ck_assert_int_eq(s21_formula_var(&f, "price"), 1);
+  ck_assert_int_eq(s21_formula_var(&f, "disc"), 2);
+  ck_assert_int_eq(s21_formula_var(&f, "fee"), 3);
+  ck_assert_int_eq(s21_formula_var(&f, "tax"), -1);
+}
+END_TEST
+
+// r0 = qty * price, r1 = 1 - disc, r0 = r0 * r1, r0 = r0 + fee
+START_TEST(formula_stack_registers) {
+  s21_formula f;
+  ck_assert_int_eq(
+      s21_formula_compile("qty * price * (1 - disc) + fee", &f, NULL), 0);
+  ck_assert_int_eq(f.n_code, 4);
+  ck_assert_int_eq(f.n_regs, 2);
+  ck_assert_uint_eq(f.code[1].op, S21_FORMULA_SUB);
+  ck_assert_uint_eq(f.code[1].dst, 1);
+  ck_assert_uint_eq(f.code[1].a, S21_FORMULA_ARG_CONST | 0u);
+  ck_assert_uint_eq(f.code[1].b, S21_FORMULA_ARG_VAR | 2u);
+  ck_assert_uint_eq(f.code[2].a, S21_FORMULA_ARG_REG | 0u);
+  ck_assert_uint_eq(f.code[2].b, S21_FORMULA_ARG_REG | 1u);
+  ck_assert_uint_eq(f.code[3].dst, 0);
+}
+END_TEST
+
+START_TEST(formula_equal_consts_stored_once) {
+  s21_formula f;
+  ck_assert_int_eq(s21_formula_compile("x * 1.5 + y * 1.5", &f, NULL), 0);
+  ck_assert_int_eq(f.n_consts, 1);
+  ck_assert_uint_eq(f.code[0].b, S21_FORMULA_ARG_CONST | 0u);
+  ck_assert_uint_eq(f.code[1].b, S21_FORMULA_ARG_CONST | 0u);
+}
+END_TEST
+
+// (2 * 3 - 1.5) * x: константа 4.5 и одна инструкция
+START_TEST(formula_const_folding) {
+  s21_formula f;
+  s21_decimal c = mk_dec(45, 1, 0);
+  ck_assert_int_eq(s21_formula_compile("(2 * 3 - 1.5) * x", &f, NULL), 0);
+  ck_assert_int_eq(f.n_code, 1);
+  ck_assert_int_eq(f.n_consts, 1);
+  ck_assert_mem_eq(&f.consts[0], &c, sizeof(c));
+}
+END_TEST
+
+START_TEST(formula_single_var_mov) {
+  s21_formula f;
+  ck_assert_int_eq(s21_formula_compile(" x ", &f, NULL), 0);
+  ck_assert_int_eq(f.n_code, 1);
+  ck_assert_uint_eq(f.code[0].op, S21_FORMULA_MOV);
+  ck_assert_uint_eq(f.code[0].a, S21_FORMULA_ARG_VAR | 0u);
+}
+END_TEST
+
+START_TEST(formula_negated_const_mov) {
+  s21_formula f;
+  s21_decimal c = mk_dec(3, 0, 1);
+  ck_assert_int_eq(s21_formula_compile("-(1 + 2)", &f, NULL), 0);
+  ck_assert_int_eq(f.n_consts, 1);
+  ck_assert_uint_eq(f.code[0].op, S21_FORMULA_MOV);
+  ck_assert_uint_eq(f.code[0].a, S21_FORMULA_ARG_CONST | 0u);
+  ck_assert_mem_eq(&f.consts[0], &c, sizeof(c));
+}
+END_TEST
+
+START_TEST(formula_syntax_error_pos) {
+  s21_formula f;
+  size_t pos = 0;
+  ck_assert_int_eq(s21_formula_compile("", &f, &pos), 1);
+  ck_assert_int_eq(s21_formula_compile("a +", &f, &pos), 1);
+  ck_assert_uint_eq(pos, 3);
+  ck_assert_int_eq(s21_formula_compile("(a * b", &f, &pos), 1);
+  ck_assert_uint_eq(pos, 6);
+  ck_assert_int_eq(s21_formula_compile("2x + 1", &f, &pos), 1);
+  ck_assert_uint_eq(pos, 1);
+  ck_assert_int_eq(s21_formula_compile("a b", &f, &pos), 1);
+  ck_assert_uint_eq(pos, 2);
+}
+END_TEST
+
+START_TEST(formula_error_clears_formula) {
+  s21_formula f;
+  ck_assert_int_eq(s21_formula_compile("a * b", &f, NULL), 0);
+  ck_assert_int_eq(s21_formula_compile("a b", &f, NULL), 1);
+  ck_assert_int_eq(f.n_vars, 0);
+  ck_assert_int_eq(f.n_code, 0);
+}
+END_TEST
+
+START_TEST(formula_unknown_operator) {
+  s21_formula f;
+  ck_assert_int_eq(s21_formula_compile("a % b", &f, NULL), 1);
+  ck_assert_int_eq(s21_formula_compile(NULL, &f, NULL), 1);
+}
+END_TEST
+
+START_TEST(formula_long_name) {
+  s21_formula f;
+  ck_assert_int_eq(s21_formula_compile("a_very_long_name_x + 1", &f, NULL), 2);
+}
+END_TEST
+
+START_TEST(formula_const_div_by_zero) {
+  s21_formula f;
+  ck_assert_int_eq(s21_formula_compile("x + 1 / (2 - 2)", &f, NULL), 2);
+}
+END_TEST
+
+// 2^96 не помещается в децималь
+START_TEST(formula_const_too_large) {
+  s21_formula f;
+  ck_assert_int_eq(
+      s21_formula_compile("79228162514264337593543950336 + x", &f, NULL), 2);
+}
+END_TEST
+
+START_TEST(formula_register_limit) {
+  s21_formula f;
+  char text[256];
+  nested_formula(text, S21_FORMULA_MAX_REGS);
+  ck_assert_int_eq(s21_formula_compile(text, &f, NULL), 0);
+  ck_assert_int_eq(f.n_regs, S21_FORMULA_MAX_REGS);
+  nested_formula(text, S21_FORMULA_MAX_REGS + 1);
+  ck_assert_int_eq(s21_formula_compile(text, &f, NULL), 2);
+}
+END_TEST
+
+START_TEST(formula_nesting_limit) {
+  s21_formula f;
+  char deep[200];
+  memset(deep, '(', 100);
+  strcpy(deep + 100, "x");
+  memset(deep + 101, ')', 98);
+  deep[199] = '\0';
+  ck_assert_int_eq(s21_formula_compile(deep, &f, NULL), 2);
+}
+END_TEST
+
+// несколько блоков и неполный последний блок
+START_TEST(formula_eval_matches_rows) {
+  enum { kRows = 2 * S21_FORMULA_BLOCK + 5 };
+  s21_decimal qty[kRows], price[kRows], disc[kRows], out[kRows];
+  s21_decimal fee = mk_dec(5, 1, 0);
+  s21_decimal one = mk_dec(1, 0, 0);
+  s21_formula f;
+
+  for (int i = 0; i < kRows; i++) {
+    qty[i] = mk_dec((unsigned)i + 1u, 0, 0);
+    price[i] = mk_dec(1999u + (unsigned)i * 7u, 2, i % 3 == 0);
+    disc[i] = mk_dec((unsigned)(i % 20), 2, 0);
+  }
+
+  ck_assert_int_eq(
+      s21_formula_compile("qty * price * (1 - disc) + 0.5", &f, NULL), 0);
+  const s21_decimal *columns[] = {qty, price, disc};
+  ck_assert_uint_eq(s21_formula_eval(&f, columns, out, kRows, NULL), 0u);
+
+  for (int i = 0; i < kRows; i++) {
+    s21_decimal x, y;
+    s21_mul_p(&qty[i], &price[i], &x);
+    s21_sub_p(&one, &disc[i], &y);
+    s21_mul_p(&x, &y, &x);
+    s21_add_p(&x, &fee, &x);
+    ck_assert_mem_eq(&out[i], &x, sizeof(x));
+  }
+}
+END_TEST
+
+// qty = -qty / disc на месте
+START_TEST(formula_eval_in_place) {
+  s21_decimal qty[3] = {mk_dec(1, 0, 0), mk_dec(2, 0, 0), mk_dec(3, 0, 0)};
+  s21_decimal disc[3] = {mk_dec(1, 2, 0), mk_dec(1, 2, 0), mk_dec(3, 1, 0)};
+  s21_formula f;
+  ck_assert_int_eq(s21_formula_compile("-qty / disc", &f, NULL), 0);
+  const s21_decimal *columns[] = {qty, disc};
+  ck_assert_uint_eq(s21_formula_eval(&f, columns, qty, 3, NULL), 0u);
+  ck_assert_int_eq(s21_is_equal(qty[0], mk_dec(100, 0, 1)), 1);
+  ck_assert_int_eq(s21_is_equal(qty[1], mk_dec(200, 0, 1)), 1);
+  ck_assert_int_eq(s21_is_equal(qty[2], mk_dec(10, 0, 1)), 1);
+}
+END_TEST
+
+START_TEST(formula_eval_error_row_zero) {
+  s21_decimal qty[2] = {mk_dec(1, 0, 0), mk_dec(2, 0, 0)};
+  s21_decimal disc[2] = {mk_dec(0, 0, 0), mk_dec(1, 2, 0)};
+  s21_decimal out[2], zero = {{0, 0, 0, 0}};
+  s21_formula f;
+  s21_context ctx;
+  s21_context_init(&ctx);
+  ck_assert_int_eq(s21_formula_compile("qty / disc", &f, NULL), 0);
+  const s21_decimal *columns[] = {qty, disc};
+  unsigned flags = s21_formula_eval(&f, columns, out, 2, &ctx);
+  ck_assert_uint_eq(flags & S21_FLAG_DIV_BY_ZERO, S21_FLAG_DIV_BY_ZERO);
+  ck_assert_uint_eq(ctx.flags & S21_FLAG_DIV_BY_ZERO, S21_FLAG_DIV_BY_ZERO);
+  ck_assert_mem_eq(&out[0], &zero, sizeof(zero));
+  ck_assert_int_eq(s21_is_equal(out[1], mk_dec(200, 0, 0)), 1);
+}
+END_TEST
+
+START_TEST(formula_eval_null_args) {
+  s21_decimal x[1] = {mk_dec(1, 0, 0)}, out[1];
+  s21_formula f;
+  ck_assert_int_eq(s21_formula_compile("x + y", &f, NULL), 0);
+  const s21_decimal *columns[] = {x, x};
+  const s21_decimal *missing[] = {x, NULL};
+  ck_assert_uint_eq(s21_formula_eval(NULL, columns, out, 1, NULL), 0u);
+  ck_assert_uint_eq(s21_formula_eval(&f, missing, out, 1, NULL), 0u);
+}
+END_TEST
+
+Suite *test_formula(void) {
+  Suite *s = suite_create("s21_formula");
+  TCase *tc = tcase_create("formula");
+
+  tcase_add_test(tc, formula_vars_in_order);
+  tcase_add_test(tc, formula_stack_registers);
+  tcase_add_test(tc, formula_equal_consts_stored_once);
+  tcase_add_test(tc, formula_const_folding);
+  tcase_add_test(tc, formula_single_var_mov);
+  tcase_add_test(tc, formula_negated_const_mov);
+  tcase_add_test(tc, formula_syntax_error_pos);
+  tcase_add_test(tc, formula_error_clears_formula);
+  tcase_add_test(tc, formula_unknown_operator);
+  tcase_add_test(tc, formula_long_name);
+  tcase_add_test(tc, formula_const_div_by_zero);
+  tcase_add_test(tc, formula_const_too_large);
+  tcase_add_test(tc, formula_register_limit);
+  tcase_add_test(tc, formula_nesting_limit);
+  tcase_add_test(tc, formula_eval_matches_rows);
+  tcase_add_test(tc, formula_eval_in_place);
+  tcase_add_test(tc, formula_eval_error_row_zero);
+  tcase_add_test(tc, formula_eval_null_args);
+
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -0,0 +1,186 @@
+/**
+ * @file tests_from_decimal_to_double.c
+ * @brief Тесты конвертации decimal в double и пакетных конвертаций
+ * @details Содержит юнит-тесты для s21_from_decimal_to_double и пакетных
+ *          функций s21_from_decimal_to_float_batch /
+ *          s21_from_decimal_to_double_batch, включая случаи, где требуется
+ *          корректное округление (ties-to-even)
+ */
+
+#include "tests.h"
+
+/**
+ * @brief Тест конвертации дробного числа с масштабом
+ * @details Проверяет: decimal(123.456) → double(123.456)
+ *          Быстрый путь: мантисса < 2^53, масштаб <= 22
+ */
+START_TEST(to_double_1) {
+  s21_decimal d = {{123456, 0, 0, 3 << 16}};  // decimal = 123.456
+  double result = 0.0;
+  ck_assert_int_eq(s21_from_decimal_to_double(d, &result), 0);
+  ck_assert_double_eq(result, 123.456);  // Результат совпадает бит в бит
+}
+END_TEST
+
+/**
+ * @brief Тест конвертации отрицательного числа с масштабом 28
+ * @details Проверяет: decimal(-1e-28) → double(-1e-28)
+ *          Масштаб больше 22 - путь через целочисленное деление
+ */
+START_TEST(to_double_2) {
+  s21_decimal d = {{1, 0, 0, (28 << 16) | 0x80000000}};  // decimal = -1e-28
+  double result = 0.0;
+  ck_assert_int_eq(s21_from_decimal_to_double(d, &result), 0);
+  ck_assert_double_eq(result, -1e-28);
+}
+END_TEST
+
+/**
+ * @brief Тест конвертации максимального decimal
+ * @details Проверяет: decimal(2^96 - 1) → double(2^96)
+ *          96 бит мантиссы округляются вверх до степени двойки
+ */
+START_TEST(to_double_3) {
+  s21_decimal d = {{0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0}};
+  double result = 0.0;
+  ck_assert_int_eq(s21_from_decimal_to_double(d, &result), 0);
+  ck_assert_double_eq(result, 79228162514264337593543950336.0);
+}
+END_TEST
+
+/**
+ * @brief Тест округления к четному при равноудаленном значении
+ * @details Проверяет: decimal(2^53 + 1) → double(2^53)
+ *          Значение ровно посередине между двумя double - к четной мантиссе
+ */
+START_TEST(to_double_4) {
+  s21_decimal d = {{1, 0x00200000, 0, 0}};  // decimal = 2^53 + 1
+  double result = 0.0;
+  ck_assert_int_eq(s21_from_decimal_to_double(d, &result), 0);
+  ck_assert_double_eq(result, 9007199254740992.0);
+
+  d.bits[0] = 3;  // decimal = 2^53 + 3 → 2^53 + 4
+  ck_assert_int_eq(s21_from_decimal_to_double(d, &result), 0);
+  ck_assert_double_eq(result, 9007199254740996.0);
+}
+END_TEST
+
+/**
+ * @brief Тест длинной дробной мантиссы
+ * @details Проверяет: decimal(7.9228162514264337593543950335) → double
+ *          Результат совпадает с корректно округленным литералом
+ */
+START_TEST(to_double_5) {
+  s21_decimal d = {{0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 28 << 16}};
+  double result = 0.0;
+  ck_assert_int_eq(s21_from_decimal_to_double(d, &result), 0);
+  ck_assert_double_eq(result, 7.9228162514264337593543950335);
+}
+END_TEST
+
+/**
+ * @brief Тест обработки ошибок
+ * @details Проверяет NULL указатель и некорректный масштаб (> 28)
+ */
+START_TEST(to_double_6) {
+  s21_decimal d = {{100, 0, 0, 0}};
+  double result = 0.0;
+  ck_assert_int_eq(s21_from_decimal_to_double(d, NULL), 1);
+
+  d.bits[3] = 29 << 16;  // Масштаб вне диапазона
+  ck_assert_int_eq(s21_from_decimal_to_double(d, &result), 1);
+}
+END_TEST
+
+/**
+ * @brief Тест корректного округления во float
+ * @details Проверяет: decimal(2^24 + 1) → float(2^24) и
+ *          decimal(0.3) → float(0.3f) без двойного округления через double
+ */
+START_TEST(to_float_rounding) {
+  s21_decimal d = {{16777217, 0, 0, 0}};  // decimal = 2^24 + 1
+  float result = 0.0f;
+  ck_assert_int_eq(s21_from_decimal_to_float(d, &result), 0);
+  ck_assert_float_eq(result, 16777216.0f);
+
+  s21_decimal big = {{0x10000001, 0x3E250261, 0x204FCE5E, 28 << 16}};
+  ck_assert_int_eq(s21_from_decimal_to_float(big, &result), 0);
+  ck_assert_float_eq(result, 1.0f);  // 1.0000000000000000000000000001
+}
+END_TEST
+
+/**
+ * @brief Тест середины между соседними числами при масштабе больше 0
+ * @details Проверяет: decimal(4503599627370496.5) → double(2^52) и
+ *          decimal(4503599627370497.5) → double(2^52 + 2), float для
+ *          decimal(8388608.5). Умножения на обратное 10^scale не хватает,
+ *          чтобы выбрать направление, результат дает точное деление
+ */
+START_TEST(to_double_tie_scaled) {
+  s21_decimal d = {{5, 0x00A00000, 0, 1 << 16}};  // (2^53 + 1) * 5 / 10
+  double result = 0.0;
+  ck_assert_int_eq(s21_from_decimal_to_double(d, &result), 0);
+  ck_assert_double_eq(result, 4503599627370496.0);
+
+  d.bits[0] = 15;  // (2^53 + 3) * 5 / 10
+  ck_assert_int_eq(s21_from_decimal_to_double(d, &result), 0);
+  ck_assert_double_eq(result, 4503599627370498.0);
+
+  s21_decimal f = {{83886085, 0, 0, 1 << 16}};  // (2^24 + 1) * 5 / 10
+  float fresult = 0.0f;
+  ck_assert_int_eq(s21_from_decimal_to_float(f, &fresult), 0);
+  ck_assert_float_eq(fresult, 8388608.0f);
+}
+END_TEST
+
+/**
+ * @brief Тест пакетной конвертации
+ * @details Проверяет, что пакетные функции дают тот же результат,
+ *          что и поэлементные, и сообщают об ошибке в любом элементе
+ */
+START_TEST(to_double_batch) {
+  s21_decimal src[4] = {{{5, 0, 0, 1 << 16}},
+                        {{7, 0, 0, 0x80000000}},
+                        {{0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 20 << 16}},
+                        {{0, 0, 0, 0}}};
+  double dd[4];
+  float ff[4];
+  ck_assert_int_eq(s21_from_decimal_to_double_batch(src, dd, 4), 0);
+  ck_assert_int_eq(s21_from_decimal_to_float_batch(src, ff, 4), 0);
+
+  for (int i = 0; i < 4; i++) {
+    double d1 = 0.0;
+    float f1 = 0.0f;
+    s21_from_decimal_to_double(src[i], &d1);
+    s21_from_decimal_to_float(src[i], &f1);
+    ck_assert_double_eq(dd[i], d1);
+    ck_assert_float_eq(ff[i], f1);
+  }
+
+  src[2].bits[3] = 30 << 16;  // Некорректный элемент
+  ck_assert_int_eq(s21_from_decimal_to_double_batch(src, dd, 4), 1);
+  ck_assert_int_eq(s21_from_decimal_to_double_batch(NULL, dd, 4), 1);
+}
+END_TEST
+
+/**
+ * @brief Создание тестового набора для конвертации decimal → double
+ * @return Указатель на созданный Suite
+ */
+Suite* test_to_double(void) {
+  Suite* s = suite_create("s21_to_double");
+  TCase* tc = tcase_create("to_double_TC");
+
+  tcase_add_test(tc, to_double_1);        // Быстрый путь
+  tcase_add_test(tc, to_double_2);        // Масштаб 28
+  tcase_add_test(tc, to_double_3);        // Максимальное число
+  tcase_add_test(tc, to_double_4);        // Округление к четному
+  tcase_add_test(tc, to_double_5);        // Длинная мантисса
+  tcase_add_test(tc, to_double_6);        // Обработка ошибок
+  tcase_add_test(tc, to_float_rounding);  // Корректное округление float
+  tcase_add_test(tc, to_double_tie_scaled);  // Середина при масштабе
+  tcase_add_test(tc, to_double_batch);    // Пакетная конвертация
+
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -0,0 +1,192 @@
+/**
+ * @file tests_int64.c
+ * @brief Тесты конвертаций decimal в 64/128 бит целые и обратно
+ * @details Содержит юнит-тесты для int64, uint64, __int128 и
+ *          масштабированных int64 конвертаций, включая пакетные версии
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "tests.h"
+
+/**
+ * @brief Тест конвертации int64 → decimal → int64
+ * @details Проверяет граничные значения INT64_MIN, INT64_MAX и 0
+ */
+START_TEST(int64_round_trip) {
+  int64_t values[] = {0, 1, -1, INT64_MAX, INT64_MIN, 1234567890123LL};
+  for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+    s21_decimal d;
+    int64_t back = 0;
+    ck_assert_int_eq(s21_from_int64_to_decimal(values[i], &d), 0);
+    ck_assert_int_eq(s21_from_decimal_to_int64(d, &back), 0);
+    ck_assert(back == values[i]);
+  }
+}
+END_TEST
+
+/**
+ * @brief Тест отбрасывания дробной части и выхода за диапазон
+ * @details Проверяет: -123.987 → -123, 2^64 → ошибка, NULL → ошибка
+ */
+START_TEST(int64_truncate_and_range) {
+  s21_decimal d = {{123987, 0, 0, (3 << 16) | 0x80000000}};  // -123.987
+  int64_t v = 0;
+  ck_assert_int_eq(s21_from_decimal_to_int64(d, &v), 0);
+  ck_assert(v == -123);
+
+  s21_decimal big = {{0, 0, 1, 0}};  // 2^64
+  ck_assert_int_eq(s21_from_decimal_to_int64(big, &v), 1);
+  ck_assert_int_eq(s21_from_decimal_to_int64(d, NULL), 1);
+
+  // 2^64 с масштабом 1 помещается после деления на 10
+  big.bits[3] = 1 << 16;
+  ck_assert_int_eq(s21_from_decimal_to_int64(big, &v), 0);
+  ck_assert(v == 1844674407370955161LL);
+}
+END_TEST
+
+/**
+ * @brief Тест конвертаций uint64
+ * @details Проверяет UINT64_MAX, отрицательные значения и -0.5 → 0
+ */
+START_TEST(uint64_cases) {
+  s21_decimal d;
+  uint64_t v = 0;
+  ck_assert_int_eq(s21_from_uint64_to_decimal(UINT64_MAX, &d), 0);
+  ck_assert_int_eq(s21_from_decimal_to_uint64(d, &v), 0);
+  ck_assert(v == UINT64_MAX);
+
+  s21_decimal neg = {{5, 0, 0, 0x80000000}};  // -5
+  ck_assert_int_eq(s21_from_decimal_to_uint64(neg, &v), 1);
+
+  s21_decimal half = {{5, 0, 0, (1 << 16) | 0x80000000}};  // -0.5
+  ck_assert_int_eq(s21_from_decimal_to_uint64(half, &v), 0);
+  ck_assert(v == 0);
+}
+END_TEST
+
+/**
+ * @brief Тест масштабированных конвертаций
+ * @details Проверяет: 19.99 → 1999 центов, 1.005 → 100 (к четному),
+ *          1.015 → 102, 7 → 700 и обратную конвертацию 1999 → 19.99
+ */
+START_TEST(scaled_int64_cases) {
+  s21_decimal d = {{1999, 0, 0, 2 << 16}};  // 19.99
+  int64_t cents = 0;
+  ck_assert_int_eq(s21_from_decimal_to_scaled_int64(d, 2, &cents), 0);
+  ck_assert(cents == 1999);
+
+  s21_decimal tie_even = {{1005, 0, 0, 3 << 16}};  // 1.005
+  ck_assert_int_eq(s21_from_decimal_to_scaled_int64(tie_even, 2, &cents), 0);
+  ck_assert(cents == 100);
+
+  s21_decimal tie_odd = {{1015, 0, 0, 3 << 16}};  // 1.015
+  ck_assert_int_eq(s21_from_decimal_to_scaled_int64(tie_odd, 2, &cents), 0);
+  ck_assert(cents == 102);
+
+  s21_decimal seven = {{7, 0, 0, 0x80000000}};  // -7
+  ck_assert_int_eq(s21_from_decimal_to_scaled_int64(seven, 2, &cents), 0);
+  ck_assert(cents == -700);
+
+  s21_decimal back;
+  ck_assert_int_eq(s21_from_scaled_int64_to_decimal(1999, 2, &back), 0);
+  ck_assert_int_eq(s21_is_equal(back, d), 1);
+  ck_assert_int_eq(s21_from_scaled_int64_to_decimal(1, 29, &back), 1);
+
+  s21_decimal huge = {{0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0}};
+  ck_assert_int_eq(s21_from_decimal_to_scaled_int64(huge, 2, &cents), 1);
+}
+END_TEST
+
+/**
+ * @brief Тест конвертаций __int128
+ * @details Проверяет максимальную мантиссу 2^96 - 1 и выход за 96 бит
+ */
+START_TEST(int128_cases) {
+#ifdef __SIZEOF_INT128__
+  __int128 max96 = ((__int128)1 << 96) - 1;
+  s21_decimal d;
+  __int128 back = 0;
+  ck_assert_int_eq(s21_from_int128_to_decimal(-max96, &d), 0);
+  ck_assert_int_eq(s21_from_decimal_to_int128(d, &back), 0);
+  ck_assert(back == -max96);
+  ck_assert_int_eq(s21_from_int128_to_decimal(max96 + 1, &d), 1);
+#endif
+}
+END_TEST
+
+/**
+ * @brief Тест пакетных конвертаций
+ * @details Проверяет совпадение с поэлементными функциями, обработку
+ *          смешанных масштабов и обнуление ошибочных элементов
+ */
+START_TEST(int64_batches) {
+  int64_t src[5] = {5, -5, INT64_MIN, INT64_MAX, 0};
+  s21_decimal dec[5];
+  int64_t back[5];
+  ck_assert_int_eq(s21_from_int64_to_decimal_batch(src, dec, 5), 0);
+  ck_assert_int_eq(s21_from_decimal_to_int64_batch(dec, back, 5), 0);
+  for (int i = 0; i < 5; i++) ck_assert(back[i] == src[i]);
+
+  ck_assert_int_eq(s21_from_scaled_int64_to_decimal_batch(src, 4, dec, 2), 0);
+  s21_set_scale(&dec[1], 5);                 // -0.00005 → -0 (к четному)
+  dec[2] = (s21_decimal){{0, 0, 1, 0}};      // 2^64 - не помещается
+  ck_assert_int_eq(s21_from_decimal_to_scaled_int64_batch(dec, 4, back, 3), 1);
+  ck_assert(back[0] == 5);
+  ck_assert(back[1] == 0);
+  ck_assert(back[2] == 0);
+
+  uint64_t usrc[2] = {UINT64_MAX, 7};
+  uint64_t uback[2];
+  ck_assert_int_eq(s21_from_uint64_to_decimal_batch(usrc, dec, 2), 0);
+  ck_assert_int_eq(s21_from_decimal_to_uint64_batch(dec, uback, 2), 0);
+  ck_assert(uback[0] == UINT64_MAX && uback[1] == 7);
+  ck_assert_int_eq(s21_from_decimal_to_int64_batch(NULL, back, 1), 1);
+}
+END_TEST
+
+// константы без вызова функций
+static const s21_decimal literal_price = S21_DECIMAL_LITERAL(1999, 2);
+static const s21_decimal literal_min = S21_DECIMAL_LITERAL(INT64_MIN, 0);
+
+/**
+ * @brief Тест макросов S21_DECIMAL_LITERAL и S21_DECIMAL_INIT
+ * @details Проверяет: static константы совпадают побитно с результатом
+ *          s21_from_scaled_int64_to_decimal, знак и масштаб S21_DECIMAL_INIT
+ */
+START_TEST(decimal_literal_macro) {
+  s21_decimal d;
+  ck_assert_int_eq(s21_from_scaled_int64_to_decimal(1999, 2, &d), 0);
+  ck_assert_int_eq(memcmp(&d, &literal_price, sizeof(d)), 0);
+  ck_assert_int_eq(s21_from_int64_to_decimal(INT64_MIN, &d), 0);
+  ck_assert_int_eq(memcmp(&d, &literal_min, sizeof(d)), 0);
+
+  s21_decimal lowest =
+      S21_DECIMAL_INIT(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 28, 1);
+  ck_assert_int_eq(s21_get_scale(&lowest), 28);
+  ck_assert_int_eq(s21_get_sign(&lowest), 1);
+  ck_assert_int_eq(lowest.bits[2], -1);
+}
+END_TEST
+
+/**
+ * @brief Создание тестового набора для 64/128 бит конвертаций
+ * @return Указатель на созданный Suite
+ */
+Suite* test_int64(void) {
+  Suite* s = suite_create("s21_int64_int128");
+  TCase* tc = tcase_create("int64_TC");
+
+  tcase_add_test(tc, int64_round_trip);          // int64 туда и обратно
+  tcase_add_test(tc, int64_truncate_and_range);  // Отбрасывание и диапазон
+  tcase_add_test(tc, uint64_cases);              // uint64
+  tcase_add_test(tc, scaled_int64_cases);        // Масштабированные int64
+  tcase_add_test(tc, int128_cases);              // __int128
+  tcase_add_test(tc, int64_batches);             // Пакетные версии
+  tcase_add_test(tc, decimal_literal_macro);     // Константы-макросы
+
+  suite_add_tcase(s, tc);
+  return s;
+}
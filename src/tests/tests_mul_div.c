@@ -119,12 +119,38 @@ START_TEST(mul_reduce_when_S_gt_28) {
 }
 END_TEST
 
+/**
+ * @brief Тест сокращения произведения, не помещающегося в 96 бит
+ * @details Проверяет: 7922816251426433759354395033.5 * 10 = 2^96 - 1
+ *          с масштабом 0, 1000000000000000.5^2 - переполнение,
+ *          1e-28 * 1.49 = 1e-28 (одно округление, а не 149 -> 15 -> 2)
+ */
+START_TEST(mul_reduce_scale_single_round) {
+  s21_decimal a = mk(0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 1, 0);
+  s21_decimal r = {{0}};
+
+  ck_assert_int_eq(s21_mul(a, mk(10, 0, 0, 0, 0), &r), 0);
+  ck_assert_int_eq(s21_get_scale(&r), 0);
+  ck_assert_int_eq(r.bits[0] & r.bits[1] & r.bits[2], -1);
+
+  s21_decimal big = mk(0x6FC10005u, 0x002386F2u, 0, 1, 0);  // 1e15 + 0.5
+  ck_assert_int_eq(s21_mul(big, big, &r), 1);
+
+  ck_assert_int_eq(s21_mul(mk(1, 0, 0, 28, 0), mk(149, 0, 0, 2, 0), &r), 0);
+  ck_assert_int_eq(s21_is_equal(r, mk(1, 0, 0, 28, 0)), 1);
+}
+END_TEST
+
 START_TEST(mul_u192_shrink_branch) {
-  s21_decimal a = mk(0, 0, 0x80000000u, 10, 0);
-  s21_decimal b = mk(0, 0, 0x80000000u, 10, 0);
+  s21_decimal a = mk(0, 0, 0x80000000u, 15, 0);
+  s21_decimal b = mk(0, 0, 0x80000000u, 15, 0);
   s21_decimal r = {{0}};
   ck_assert_int_eq(s21_mul(a, b, &r), 0);
   ck_assert_int_le(s21_get_scale(&r), 28);
+
+  // (2^95 / 10^10)^2 ~ 1.6e37 не помещается в 96 бит
+  a = mk(0, 0, 0x80000000u, 10, 0);
+  ck_assert_int_eq(s21_mul(a, a, &r), 1);
 }
 END_TEST
 
@@ -138,6 +164,7 @@ Suite* test_mul_div(void) {
   tcase_add_test(tc, mul_overflow_no_scale);
   tcase_add_test(tc, mul_reduce_when_S_gt_28);
   tcase_add_test(tc, mul_u192_shrink_branch);
+  tcase_add_test(tc, mul_reduce_scale_single_round);
   tcase_add_test(tc, mul_r5_even_fn);
   tcase_add_test(tc, mul_r5_odd_fn);
   suite_add_tcase(s, tc);
@@ -0,0 +1,250 @@
+/**
+ * @file tests_pg_numeric.c
+ * @brief Тесты двоичного формата PostgreSQL NUMERIC
+ * @details Содержит юнит-тесты кодирования известных значений, чтения
+ *          с dscale, округления длинных значений, отказа для NaN и
+ *          неверного формата, пакетных версий с полями COPY BINARY
+ */
+
+#include <string.h>
+
+#include "tests.h"
+
+// 19.99, -(2^96 - 1), 7E-28 - поля COPY BINARY по 16, 28 и 14 байт
+static const s21_decimal batch_src[3] = {{{1999, 0, 0, 2 << 16}},
+                                         {{-1, -1, -1, (int)S21_SIGN_MASK}},
+                                         {{7, 0, 0, 28 << 16}}};
+
+// 12345.678: weight 1, цифры 1 2345 6780
+START_TEST(pg_numeric_groups_aligned) {
+  unsigned char buf[S21_PG_NUMERIC_MAX_SIZE];
+  size_t len = 0;
+  s21_decimal a = {{12345678, 0, 0, 3 << 16}};
+  const unsigned char a_bin[] = {0, 3, 0, 1,    0,    0,    0,   3,
+                                 0, 1, 9, 0x29, 0x1A, 0x7C};
+  ck_assert_int_eq(s21_to_pg_numeric(&a, buf, sizeof(buf), &len), 0);
+  ck_assert_int_eq((int)len, (int)sizeof(a_bin));
+  ck_assert_mem_eq(buf, a_bin, sizeof(a_bin));
+}
+END_TEST
+
+// -0.0001: weight -1
+START_TEST(pg_numeric_negative_fraction) {
+  unsigned char buf[S21_PG_NUMERIC_MAX_SIZE];
+  size_t len = 0;
+  s21_decimal b = {{1, 0, 0, (int)(S21_SIGN_MASK | (4u << 16))}};
+  const unsigned char b_bin[] = {0, 1, 0xFF, 0xFF, 0x40, 0, 0, 4, 0, 1};
+  ck_assert_int_eq(s21_to_pg_numeric(&b, buf, sizeof(buf), &len), 0);
+  ck_assert_int_eq((int)len, (int)sizeof(b_bin));
+  ck_assert_mem_eq(buf, b_bin, sizeof(b_bin));
+}
+END_TEST
+
+// 1000000: группа 0000 не передается
+START_TEST(pg_numeric_trailing_zero_group) {
+  unsigned char buf[S21_PG_NUMERIC_MAX_SIZE];
+  size_t len = 0;
+  s21_decimal c = {{1000000, 0, 0, 0}};
+  const unsigned char c_bin[] = {0, 1, 0, 1, 0, 0, 0, 0, 0, 100};
+  ck_assert_int_eq(s21_to_pg_numeric(&c, buf, sizeof(buf), &len), 0);
+  ck_assert_int_eq((int)len, (int)sizeof(c_bin));
+  ck_assert_mem_eq(buf, c_bin, sizeof(c_bin));
+}
+END_TEST
+
+// -0.00: без цифр и без знака, dscale 2
+START_TEST(pg_numeric_negative_zero) {
+  unsigned char buf[S21_PG_NUMERIC_MAX_SIZE];
+  size_t len = 0;
+  s21_decimal zero = {{0, 0, 0, (int)(S21_SIGN_MASK | (2u << 16))}};
+  const unsigned char zero_bin[] = {0, 0, 0, 0, 0, 0, 0, 2};
+  ck_assert_int_eq(s21_to_pg_numeric(&zero, buf, sizeof(buf), &len), 0);
+  ck_assert_int_eq((int)len, 8);
+  ck_assert_mem_eq(buf, zero_bin, sizeof(zero_bin));
+}
+END_TEST
+
+// 7.9228162514264337593543950335: 1 + 7 групп
+START_TEST(pg_numeric_max_size) {
+  unsigned char buf[S21_PG_NUMERIC_MAX_SIZE];
+  size_t len = 0;
+  s21_decimal max = {{-1, -1, -1, 1 << 16}};
+  ck_assert_int_eq(s21_to_pg_numeric(&max, buf, sizeof(buf), &len), 0);
+  ck_assert_int_eq((int)len, S21_PG_NUMERIC_MAX_SIZE);
+  ck_assert_int_eq(s21_to_pg_numeric(&max, buf, sizeof(buf) - 1, &len), 1);
+}
+END_TEST
+
+START_TEST(pg_numeric_encode_bad_args) {
+  unsigned char buf[S21_PG_NUMERIC_MAX_SIZE];
+  size_t len = 0;
+  s21_decimal bad = {{1, 0, 0, 29 << 16}};
+  ck_assert_int_eq(s21_to_pg_numeric(&bad, buf, sizeof(buf), &len), 1);
+  ck_assert_int_eq(s21_to_pg_numeric(NULL, buf, sizeof(buf), &len), 1);
+}
+END_TEST
+
+// 1.5 с dscale 3 -> 1.500
+START_TEST(pg_numeric_dscale) {
+  const unsigned char a_bin[] = {0, 2, 0, 0, 0, 0, 0, 3, 0, 1, 0x13, 0x88};
+  s21_decimal d;
+  ck_assert_int_eq(s21_from_pg_numeric(a_bin, sizeof(a_bin), &d), 0);
+  ck_assert_int_eq(d.bits[0], 1500);
+  ck_assert_int_eq(s21_get_scale(&d), 3);
+}
+END_TEST
+
+// 1 + 5E-29 + 1E-40 -> 1.0000000000000000000000000001: отброшенные
+// цифры учитываются в одном округлении
+START_TEST(pg_numeric_rounds_once) {
+  s21_context *ctx = s21_context_get();
+  unsigned char b_bin[8 + 2 * 11] = {0, 11, 0, 0, 0, 0, 0, 40, 0, 1};
+  const char text[] = "1.0000000000000000000000000001";
+  s21_decimal d, expected;
+  b_bin[8 + 2 * 8] = 0x13;
+  b_bin[8 + 2 * 8 + 1] = 0x88;
+  b_bin[8 + 2 * 10 + 1] = 1;
+  s21_from_chars(text, text + sizeof(text) - 1, &expected, NULL);
+  s21_context_init(ctx);
+  ck_assert_int_eq(s21_from_pg_numeric(b_bin, sizeof(b_bin), &d), 0);
+  ck_assert_mem_eq(&d, &expected, sizeof(d));
+  ck_assert_uint_eq(ctx->flags, S21_FLAG_ROUNDED | S21_FLAG_INEXACT);
+  s21_context_init(ctx);
+}
+END_TEST
+
+// цифры за dscale 0 (не от PostgreSQL): 0.5 -> 0, 0.50000001 -> 1,
+// 1E-80 -> 0
+START_TEST(pg_numeric_digits_past_dscale) {
+  const unsigned char half[] = {0, 1, 0xFF, 0xFF, 0, 0, 0, 0, 0x13, 0x88};
+  const unsigned char above[] = {0,    2,    0xFF, 0xFF, 0, 0,
+                                 0,    0,    0x13, 0x88, 0, 1};
+  const unsigned char tiny[] = {0, 1, 0xFF, 0xEC, 0, 0, 0, 0, 0, 1};
+  s21_decimal d;
+  ck_assert_int_eq(s21_from_pg_numeric(half, sizeof(half), &d), 0);
+  ck_assert_int_eq(s21_is_zero(&d), 1);
+  ck_assert_int_eq(s21_from_pg_numeric(above, sizeof(above), &d), 0);
+  ck_assert_int_eq(d.bits[0], 1);
+  ck_assert_int_eq(s21_get_scale(&d), 0);
+  ck_assert_int_eq(s21_from_pg_numeric(tiny, sizeof(tiny), &d), 0);
+  ck_assert_int_eq(s21_is_zero(&d), 1);
+  ck_assert_int_eq(s21_get_scale(&d), 0);
+  s21_context_init(s21_context_get());
+}
+END_TEST
+
+// -8E+28 не помещается
+START_TEST(pg_numeric_overflow) {
+  s21_context *ctx = s21_context_get();
+  const unsigned char c_bin[] = {0, 1, 0, 7, 0x40, 0, 0, 0, 0, 8};
+  s21_decimal d;
+  s21_context_init(ctx);
+  ck_assert_int_eq(s21_from_pg_numeric(c_bin, sizeof(c_bin), &d), 1);
+  ck_assert_uint_eq(ctx->flags & S21_FLAG_OVERFLOW, S21_FLAG_OVERFLOW);
+  s21_context_init(ctx);
+}
+END_TEST
+
+START_TEST(pg_numeric_nan) {
+  const unsigned char nan_bin[] = {0, 0, 0, 0, 0xC0, 0, 0, 0};
+  s21_decimal d;
+  ck_assert_int_eq(s21_from_pg_numeric(nan_bin, sizeof(nan_bin), &d), 1);
+}
+END_TEST
+
+START_TEST(pg_numeric_digit_over_nbase) {
+  const unsigned char big_digit[] = {0, 1, 0, 0, 0, 0, 0, 0, 0x27, 0x10};
+  s21_decimal d;
+  ck_assert_int_eq(s21_from_pg_numeric(big_digit, sizeof(big_digit), &d), 1);
+}
+END_TEST
+
+START_TEST(pg_numeric_bad_length) {
+  const unsigned char a_bin[] = {0, 2, 0, 0, 0, 0, 0, 3, 0, 1, 0x13, 0x88};
+  s21_decimal d;
+  ck_assert_int_eq(s21_from_pg_numeric(a_bin, sizeof(a_bin) - 1, &d), 1);
+  ck_assert_int_eq(s21_from_pg_numeric(a_bin, 7, &d), 1);
+  ck_assert_int_eq(s21_from_pg_numeric(NULL, sizeof(a_bin), &d), 1);
+}
+END_TEST
+
+START_TEST(pg_numeric_batch_roundtrip) {
+  unsigned char buf[3 * (4 + S21_PG_NUMERIC_MAX_SIZE)];
+  s21_decimal back[3];
+  size_t written = 0, consumed = 0;
+  ck_assert_int_eq(
+      s21_to_pg_numeric_batch(batch_src, 3, buf, sizeof(buf), &written), 0);
+  ck_assert_int_eq((int)written, 16 + 28 + 14);
+  ck_assert_int_eq(
+      s21_from_pg_numeric_batch(buf, written, back, 3, &consumed), 0);
+  ck_assert_int_eq((int)consumed, (int)written);
+  ck_assert_mem_eq(back, batch_src, sizeof(back));
+}
+END_TEST
+
+// поле NULL (длина -1) получает 0 без ошибки
+START_TEST(pg_numeric_batch_null_field) {
+  unsigned char buf[4 + 3 * (4 + S21_PG_NUMERIC_MAX_SIZE)] = {0xFF, 0xFF,
+                                                              0xFF, 0xFF};
+  s21_decimal back[4];
+  size_t written = 0, consumed = 0;
+  s21_to_pg_numeric_batch(batch_src, 3, buf + 4, sizeof(buf) - 4, &written);
+  ck_assert_int_eq(
+      s21_from_pg_numeric_batch(buf, written + 4, back, 4, &consumed), 0);
+  ck_assert_int_eq((int)consumed, (int)written + 4);
+  ck_assert_int_eq(s21_is_zero(&back[0]), 1);
+  ck_assert_mem_eq(&back[1], batch_src, sizeof(batch_src));
+}
+END_TEST
+
+// обрезанное второе поле: чтение останавливается, третий элемент тоже 0
+START_TEST(pg_numeric_batch_truncated) {
+  unsigned char buf[3 * (4 + S21_PG_NUMERIC_MAX_SIZE)];
+  s21_decimal back[3];
+  size_t written = 0, consumed = 0;
+  s21_to_pg_numeric_batch(batch_src, 3, buf, sizeof(buf), &written);
+  ck_assert_int_eq(s21_from_pg_numeric_batch(buf, 16 + 10, back, 3, &consumed),
+                   1);
+  ck_assert_int_eq((int)consumed, 16);
+  ck_assert_mem_eq(&back[0], &batch_src[0], sizeof(back[0]));
+  ck_assert_int_eq(s21_is_zero(&back[1]), 1);
+  ck_assert_int_eq(s21_is_zero(&back[2]), 1);
+}
+END_TEST
+
+// места только на первое поле: записаны только целые поля
+START_TEST(pg_numeric_batch_no_space) {
+  unsigned char buf[3 * (4 + S21_PG_NUMERIC_MAX_SIZE)];
+  size_t written = 0;
+  ck_assert_int_eq(
+      s21_to_pg_numeric_batch(batch_src, 3, buf, 16 + 20, &written), 1);
+  ck_assert_int_eq((int)written, 16);
+  ck_assert_int_eq(s21_to_pg_numeric_batch(NULL, 3, buf, 8, &written), 1);
+}
+END_TEST
+
+Suite *test_pg_numeric(void) {
+  Suite *s = suite_create("s21_pg_numeric");
+  TCase *tc = tcase_create("pg_numeric");
+
+  tcase_add_test(tc, pg_numeric_groups_aligned);
+  tcase_add_test(tc, pg_numeric_negative_fraction);
+  tcase_add_test(tc, pg_numeric_trailing_zero_group);
+  tcase_add_test(tc, pg_numeric_negative_zero);
+  tcase_add_test(tc, pg_numeric_max_size);
+  tcase_add_test(tc, pg_numeric_encode_bad_args);
+  tcase_add_test(tc, pg_numeric_dscale);
+  tcase_add_test(tc, pg_numeric_rounds_once);
+  tcase_add_test(tc, pg_numeric_digits_past_dscale);
+  tcase_add_test(tc, pg_numeric_overflow);
+  tcase_add_test(tc, pg_numeric_nan);
+  tcase_add_test(tc, pg_numeric_digit_over_nbase);
+  tcase_add_test(tc, pg_numeric_bad_length);
+  tcase_add_test(tc, pg_numeric_batch_roundtrip);
+  tcase_add_test(tc, pg_numeric_batch_null_field);
+  tcase_add_test(tc, pg_numeric_batch_truncated);
+  tcase_add_test(tc, pg_numeric_batch_no_space);
+
+  suite_add_tcase(s, tc);
+  return s;
+}
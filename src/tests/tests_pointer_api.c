@@ -0,0 +1,135 @@
+/**
+ * @file tests_pointer_api.c
+ * @brief Тесты операций по указателям и операций на месте
+ * @details Содержит юнит-тесты для s21_*_p (в том числе при совпадении
+ *          результата с операндами) и s21_*_assign
+ */
+
+#include "tests.h"
+
+/**
+ * @brief Тест совпадения с результатами операций по значению
+ * @details Проверяет: для пар с разными знаками и масштабами s21_*_p
+ *          возвращает те же коды и биты, что s21_add/sub/mul/div
+ */
+START_TEST(pointer_matches_value_api) {
+  s21_decimal xs[4] = {mk_dec(12345, 2, 0), mk_dec(7, 0, 1), mk_dec(1, 28, 0),
+                       mk_dec(250, 1, 1)};
+
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      s21_decimal r1, r2;
+      ck_assert_int_eq(s21_add_p(&xs[i], &xs[j], &r1),
+                       s21_add(xs[i], xs[j], &r2));
+      ck_assert_mem_eq(&r1, &r2, sizeof(s21_decimal));
+      ck_assert_int_eq(s21_sub_p(&xs[i], &xs[j], &r1),
+                       s21_sub(xs[i], xs[j], &r2));
+      ck_assert_mem_eq(&r1, &r2, sizeof(s21_decimal));
+      ck_assert_int_eq(s21_mul_p(&xs[i], &xs[j], &r1),
+                       s21_mul(xs[i], xs[j], &r2));
+      ck_assert_mem_eq(&r1, &r2, sizeof(s21_decimal));
+      ck_assert_int_eq(s21_div_p(&xs[i], &xs[j], &r1),
+                       s21_div(xs[i], xs[j], &r2));
+      ck_assert_mem_eq(&r1, &r2, sizeof(s21_decimal));
+    }
+  }
+
+  ck_assert_int_eq(s21_add_p(NULL, &xs[0], &xs[1]), 1);
+  ck_assert_int_eq(s21_div_p(&xs[0], &xs[1], NULL), 1);
+}
+END_TEST
+
+/**
+ * @brief Тест совпадения результата с операндами
+ * @details Проверяет: 1.5 + 2.25 в a, 1.5 - 2.25 в b, a * a в a
+ *          (1.5^2 = 2.25) и a / a в a (= 1)
+ */
+START_TEST(pointer_aliasing) {
+  s21_decimal a = mk_dec(15, 1, 0);
+  s21_decimal b = mk_dec(225, 2, 0);
+  s21_decimal r;
+
+  ck_assert_int_eq(s21_add_p(&a, &b, &a), 0);
+  ck_assert_int_eq(a.bits[0], 375);
+  ck_assert_int_eq(s21_get_scale(&a), 2);
+
+  a = mk_dec(15, 1, 0);
+  ck_assert_int_eq(s21_sub_p(&a, &b, &b), 0);
+  s21_from_scaled_int64_to_decimal(-75, 2, &r);
+  ck_assert_int_eq(s21_is_equal(b, r), 1);
+
+  ck_assert_int_eq(s21_mul_p(&a, &a, &a), 0);
+  ck_assert_int_eq(s21_is_equal(a, mk_dec(225, 2, 0)), 1);
+
+  ck_assert_int_eq(s21_div_p(&a, &a, &a), 0);
+  ck_assert_int_eq(s21_is_equal(a, mk_dec(1, 0, 0)), 1);
+}
+END_TEST
+
+/**
+ * @brief Тест операций на месте
+ * @details Проверяет: сумма 0.01 * 100 = 1.00, acc + acc, acc / 4;
+ *          при делении на 0 и переполнении acc не меняется
+ */
+START_TEST(assign_accumulate) {
+  s21_decimal acc = mk_dec(0, 0, 0);
+  s21_decimal cent = mk_dec(1, 2, 0);
+
+  for (int i = 0; i < 100; i++)
+    ck_assert_int_eq(s21_add_assign(&acc, &cent), 0);
+  ck_assert_int_eq(s21_is_equal(acc, mk_dec(1, 0, 0)), 1);
+
+  ck_assert_int_eq(s21_add_assign(&acc, &acc), 0);
+  ck_assert_int_eq(s21_is_equal(acc, mk_dec(2, 0, 0)), 1);
+
+  s21_decimal four = mk_dec(4, 0, 0);
+  ck_assert_int_eq(s21_div_assign(&acc, &four), 0);
+  ck_assert_int_eq(s21_is_equal(acc, mk_dec(5, 1, 0)), 1);
+  ck_assert_int_eq(s21_sub_assign(&acc, &four), 0);
+  ck_assert_int_eq(s21_is_equal(acc, mk_dec(35, 1, 1)), 1);
+
+  s21_decimal zero = mk_dec(0, 0, 0);
+  s21_decimal saved = acc;
+  ck_assert_int_eq(s21_div_assign(&acc, &zero), 3);
+  ck_assert_mem_eq(&acc, &saved, sizeof(s21_decimal));
+
+  s21_decimal max = {{-1, -1, -1, 0}};
+  saved = max;
+  ck_assert_int_eq(s21_mul_assign(&max, &four), 1);
+  ck_assert_mem_eq(&max, &saved, sizeof(s21_decimal));
+
+  ck_assert_int_eq(s21_add_assign(NULL, &four), 1);
+}
+END_TEST
+
+/**
+ * @brief Пакетная операция на месте
+ * @details Проверяет: out совпадает с a - a[i] = a[i] * b[i]
+ */
+START_TEST(batch_in_place) {
+  s21_decimal a[3] = {mk_dec(2, 0, 0), mk_dec(15, 1, 1), mk_dec(3, 2, 0)};
+  s21_decimal b[3] = {mk_dec(5, 0, 0), mk_dec(2, 0, 0), mk_dec(100, 0, 0)};
+
+  ck_assert_uint_eq(s21_mul_batch(a, b, a, 3, NULL) & S21_FLAG_OVERFLOW, 0u);
+  ck_assert_int_eq(s21_is_equal(a[0], mk_dec(10, 0, 0)), 1);
+  ck_assert_int_eq(s21_is_equal(a[1], mk_dec(3, 0, 1)), 1);
+  ck_assert_int_eq(s21_is_equal(a[2], mk_dec(3, 0, 0)), 1);
+}
+END_TEST
+
+/**
+ * @brief Создание тестового набора для операций по указателям
+ * @return Указатель на созданный Suite
+ */
+Suite* test_pointer_api(void) {
+  Suite* s = suite_create("s21_pointer_api");
+  TCase* tc = tcase_create("pointer_api_TC");
+
+  tcase_add_test(tc, pointer_matches_value_api);  // Совпадение с API по значению
+  tcase_add_test(tc, pointer_aliasing);           // Результат = операнд
+  tcase_add_test(tc, assign_accumulate);          // Операции на месте
+  tcase_add_test(tc, batch_in_place);             // Пакет на месте
+
+  suite_add_tcase(s, tc);
+  return s;
+}
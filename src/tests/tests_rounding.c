@@ -52,10 +52,167 @@ START_TEST(test_rounding_case) {
 }
 END_TEST
 
+/**
+ * @brief Тест отсутствия двойного округления в s21_round
+ * @details Проверяет: 3.46 → 3 (а не 3.5 → 4), 2.45 → 2, 2.5 → 2,
+ *          3.5 → 4, -2.51 → -3. Решение принимается по всему остатку сразу
+ */
+START_TEST(test_round_single_pass) {
+  s21_decimal res;
+  int i;
+
+  s21_decimal v1 = {{346, 0, 0, 2 << 16}};  // 3.46
+  ck_assert_int_eq(s21_round(v1, &res), 0);
+  s21_from_decimal_to_int(res, &i);
+  ck_assert_int_eq(i, 3);
+
+  s21_decimal v2 = {{245, 0, 0, 2 << 16}};  // 2.45
+  s21_round(v2, &res);
+  s21_from_decimal_to_int(res, &i);
+  ck_assert_int_eq(i, 2);
+
+  s21_decimal v3 = {{25, 0, 0, 1 << 16}};  // 2.5 → 2 (к четному)
+  s21_round(v3, &res);
+  ck_assert_int_eq(res.bits[0], 2);
+
+  s21_decimal v4 = {{35, 0, 0, 1 << 16}};  // 3.5 → 4
+  s21_round(v4, &res);
+  ck_assert_int_eq(res.bits[0], 4);
+
+  s21_decimal v5 = {{251, 0, 0, (2 << 16) | 0x80000000}};  // -2.51
+  s21_round(v5, &res);
+  s21_from_decimal_to_int(res, &i);
+  ck_assert_int_eq(i, -3);
+  ck_assert_int_eq(s21_get_scale(&res), 0);
+}
+END_TEST
+
+/**
+ * @brief Тест округлений для 96 бит мантиссы с масштабом 28
+ * @details Проверяет: 7.9228162514264337593543950335 → 7 / 8 / 7
+ *          и -7.92... → floor -8, truncate -7
+ */
+START_TEST(test_rounding_full_mantissa) {
+  s21_decimal d = {{0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 28 << 16}};
+  s21_decimal res;
+
+  ck_assert_int_eq(s21_truncate(d, &res), 0);
+  ck_assert_int_eq(res.bits[0], 7);
+  ck_assert_int_eq(s21_round(d, &res), 0);
+  ck_assert_int_eq(res.bits[0], 8);
+  ck_assert_int_eq(s21_floor(d, &res), 0);
+  ck_assert_int_eq(res.bits[0], 7);
+
+  s21_set_sign(&d, 1);
+  ck_assert_int_eq(s21_floor(d, &res), 0);
+  ck_assert_int_eq(res.bits[0], 8);
+  ck_assert_int_eq(s21_get_sign(&res), 1);
+  ck_assert_int_eq(s21_truncate(d, &res), 0);
+  ck_assert_int_eq(res.bits[0], 7);
+  ck_assert_int_eq(s21_get_sign(&res), 1);
+}
+END_TEST
+
+/**
+ * @brief Тест ошибок и целых значений
+ * @details Проверяет NULL, масштаб > 28 и floor(-5.0) = -5
+ */
+START_TEST(test_rounding_errors) {
+  s21_decimal d = {{50, 0, 0, (1 << 16) | 0x80000000}};  // -5.0
+  s21_decimal res;
+
+  ck_assert_int_eq(s21_floor(d, &res), 0);
+  ck_assert_int_eq(res.bits[0], 5);
+  ck_assert_int_eq(s21_get_sign(&res), 1);
+
+  ck_assert_int_eq(s21_floor(d, NULL), 1);
+  ck_assert_int_eq(s21_round(d, NULL), 1);
+  ck_assert_int_eq(s21_truncate(d, NULL), 1);
+
+  d.bits[3] = 29 << 16;  // Масштаб вне диапазона
+  ck_assert_int_eq(s21_round(d, &res), 1);
+}
+END_TEST
+
+/**
+ * @brief Тест всех режимов s21_round_to_scale
+ * @details Проверяет округление 1.2345 / 1.2355 / -1.2345 / 1.23451 до
+ *          3 знаков во всех режимах (мантисса результата с масштабом 3)
+ */
+START_TEST(test_round_to_scale_modes) {
+  // мантиссы ожидаемых результатов по режимам: HALF_EVEN, HALF_UP,
+  // HALF_DOWN, DOWN, FLOOR, CEILING, UP
+  const struct {
+    unsigned mantissa;
+    int scale;
+    int sign;
+    int expected[7];
+  } cases[] = {
+      {12345, 4, 0, {1234, 1235, 1234, 1234, 1234, 1235, 1235}},
+      {12355, 4, 0, {1236, 1236, 1235, 1235, 1235, 1236, 1236}},
+      {12345, 4, 1, {1234, 1235, 1234, 1234, 1235, 1234, 1235}},
+      {123451, 5, 0, {1235, 1235, 1235, 1234, 1234, 1235, 1235}},
+      {12340, 4, 1, {1234, 1234, 1234, 1234, 1234, 1234, 1234}},
+  };
+
+  for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+    for (int mode = S21_ROUND_HALF_EVEN; mode <= S21_ROUND_UP; mode++) {
+      s21_decimal v = {{(int)cases[c].mantissa, 0, 0, 0}};
+      s21_set_scale(&v, cases[c].scale);
+      s21_set_sign(&v, cases[c].sign);
+
+      s21_decimal res;
+      ck_assert_int_eq(
+          s21_round_to_scale(v, 3, (s21_rounding_mode)mode, &res), 0);
+      ck_assert_int_eq(res.bits[0], cases[c].expected[mode]);
+      ck_assert_int_eq(s21_get_scale(&res), 3);
+      ck_assert_int_eq(s21_get_sign(&res), cases[c].sign);
+    }
+  }
+}
+END_TEST
+
+/**
+ * @brief Тест граничных случаев s21_round_to_scale
+ * @details Проверяет: меньший масштаб не меняется, 19.995 → 20.00,
+ *          полная 96 бит мантисса до 0 знаков, ошибки параметров
+ */
+START_TEST(test_round_to_scale_edges) {
+  s21_decimal res;
+
+  s21_decimal short_value = {{15, 0, 0, 1 << 16}};  // 1.5 до 2 знаков
+  ck_assert_int_eq(
+      s21_round_to_scale(short_value, 2, S21_ROUND_HALF_EVEN, &res), 0);
+  ck_assert_int_eq(s21_is_equal(res, short_value), 1);
+  ck_assert_int_eq(s21_get_scale(&res), 1);
+
+  s21_decimal price = {{19995, 0, 0, 3 << 16}};  // 19.995
+  ck_assert_int_eq(s21_round_to_scale(price, 2, S21_ROUND_HALF_EVEN, &res), 0);
+  ck_assert_int_eq(res.bits[0], 2000);
+  ck_assert_int_eq(s21_round_to_scale(price, 2, S21_ROUND_DOWN, &res), 0);
+  ck_assert_int_eq(res.bits[0], 1999);
+
+  s21_decimal max = {{0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 1 << 16}};
+  ck_assert_int_eq(s21_round_to_scale(max, 0, S21_ROUND_UP, &res), 0);
+  ck_assert_uint_eq((unsigned)res.bits[0], 0x9999999Au);
+
+  ck_assert_int_eq(s21_round_to_scale(price, 29, S21_ROUND_UP, &res), 1);
+  ck_assert_int_eq(s21_round_to_scale(price, -1, S21_ROUND_UP, &res), 1);
+  ck_assert_int_eq(
+      s21_round_to_scale(price, 2, (s21_rounding_mode)42, &res), 1);
+  ck_assert_int_eq(s21_round_to_scale(price, 2, S21_ROUND_UP, NULL), 1);
+}
+END_TEST
+
 Suite* test_rounding(void) {
   Suite* s = suite_create("s21_round_floor_truncate");
   TCase* tc = tcase_create("round_floor_truncate_TC");
   tcase_add_test(tc, test_rounding_case);
+  tcase_add_test(tc, test_round_single_pass);
+  tcase_add_test(tc, test_rounding_full_mantissa);
+  tcase_add_test(tc, test_rounding_errors);
+  tcase_add_test(tc, test_round_to_scale_modes);
+  tcase_add_test(tc, test_round_to_scale_edges);
   suite_add_tcase(s, tc);
   return s;
 }
@@ -0,0 +1,242 @@
+/**
+ * @file tests_varint.c
+ * @brief Тесты записи переменной длины (s21_encode_varint / decode)
+ * @details Содержит юнит-тесты известных записей, перевода туда и обратно,
+ *          отказа для неверного формата и обрезанных данных, потоковых
+ *          пакетных версий
+ */
+
+#include <string.h>
+
+#include "tests.h"
+
+// 19.99, -(2^96 - 1), 7E-28, 12345.6789 - записи по 3, 15, 2 и 5 байт
+static const s21_decimal batch_src[4] = {{{1999, 0, 0, 2 << 16}},
+                                         {{-1, -1, -1, (int)S21_SIGN_MASK}},
+                                         {{7, 0, 0, 28 << 16}},
+                                         {{123456789, 0, 0, 4 << 16}}};
+
+// 15 байт: заголовок и 14 байт продолжения без значащих битов
+static void long_varint(unsigned char *buf, size_t len) {
+  memset(buf, 0x80, len);
+  buf[0] = 0;
+}
+
+// 19.99: 1999 = 15 * 128 + 79
+START_TEST(varint_header_and_leb128) {
+  unsigned char buf[S21_VARINT_MAX_SIZE];
+  size_t len = 0;
+  s21_decimal a = {{1999, 0, 0, 2 << 16}};
+  const unsigned char a_bin[] = {0x02, 0xCF, 0x0F};
+  ck_assert_int_eq(s21_encode_varint(&a, buf, sizeof(buf), &len), 0);
+  ck_assert_int_eq((int)len, 3);
+  ck_assert_mem_eq(buf, a_bin, sizeof(a_bin));
+}
+END_TEST
+
+START_TEST(varint_negative_zero) {
+  unsigned char buf[S21_VARINT_MAX_SIZE];
+  size_t len = 0, used = 0;
+  s21_decimal neg_zero = {{0, 0, 0, (int)(S21_SIGN_MASK | (5u << 16))}}, back;
+  const unsigned char zero_bin[] = {0x85, 0x00};
+  ck_assert_int_eq(s21_encode_varint(&neg_zero, buf, sizeof(buf), &len), 0);
+  ck_assert_int_eq((int)len, 2);
+  ck_assert_mem_eq(buf, zero_bin, sizeof(zero_bin));
+  ck_assert_int_eq(s21_decode_varint(buf, len, &back, &used), 0);
+  ck_assert_int_eq((int)used, 2);
+  ck_assert_mem_eq(&back, &neg_zero, sizeof(back));
+}
+END_TEST
+
+START_TEST(varint_max_size) {
+  unsigned char buf[S21_VARINT_MAX_SIZE];
+  size_t len = 0, used = 0;
+  s21_decimal max = {{-1, -1, -1, (int)(S21_SIGN_MASK | (28u << 16))}}, back;
+  ck_assert_int_eq(s21_encode_varint(&max, buf, sizeof(buf), &len), 0);
+  ck_assert_int_eq((int)len, S21_VARINT_MAX_SIZE);
+  ck_assert_int_eq(s21_decode_varint(buf, len, &back, &used), 0);
+  ck_assert_int_eq((int)used, S21_VARINT_MAX_SIZE);
+  ck_assert_mem_eq(&back, &max, sizeof(back));
+}
+END_TEST
+
+// 2^(7k) занимает k + 1 байт LEB128
+START_TEST(varint_byte_boundaries) {
+  unsigned char buf[S21_VARINT_MAX_SIZE];
+  size_t len = 0;
+  s21_decimal back;
+  for (int k = 1; k < 14; k++) {
+    s21_decimal v = {{0, 0, 0, 3 << 16}};
+    v.bits[(7 * k) / 32] = (int)(1u << ((7 * k) % 32));
+    ck_assert_int_eq(s21_encode_varint(&v, buf, sizeof(buf), &len), 0);
+    ck_assert_int_eq((int)len, k + 2);
+    ck_assert_int_eq(s21_decode_varint(buf, len, &back, NULL), 0);
+    ck_assert_mem_eq(&back, &v, sizeof(back));
+  }
+}
+END_TEST
+
+START_TEST(varint_encode_no_space) {
+  unsigned char buf[S21_VARINT_MAX_SIZE];
+  size_t len = 0;
+  s21_decimal max = {{-1, -1, -1, 0}};
+  ck_assert_int_eq(s21_encode_varint(&max, buf, sizeof(buf) - 1, &len), 1);
+}
+END_TEST
+
+START_TEST(varint_encode_bad_scale) {
+  unsigned char buf[S21_VARINT_MAX_SIZE];
+  size_t len = 0;
+  s21_decimal bad = {{1, 0, 0, 29 << 16}};
+  ck_assert_int_eq(s21_encode_varint(&bad, buf, sizeof(buf), &len), 1);
+}
+END_TEST
+
+START_TEST(varint_reserved_bits) {
+  const unsigned char reserved[] = {0x20, 0x01};
+  s21_decimal d;
+  ck_assert_int_eq(s21_decode_varint(reserved, sizeof(reserved), &d, NULL),
+                   1);
+}
+END_TEST
+
+START_TEST(varint_decode_bad_scale) {
+  const unsigned char scale[] = {29, 0x01};
+  s21_decimal d;
+  ck_assert_int_eq(s21_decode_varint(scale, sizeof(scale), &d, NULL), 1);
+}
+END_TEST
+
+// последний байт с битом продолжения или пустой ввод - нужны еще данные
+START_TEST(varint_truncated) {
+  const unsigned char cut[] = {0x02, 0xCF};
+  s21_decimal d;
+  ck_assert_int_eq(s21_decode_varint(cut, sizeof(cut), &d, NULL), 2);
+  ck_assert_int_eq(s21_decode_varint(cut, 1, &d, NULL), 2);
+  ck_assert_int_eq(s21_decode_varint(cut, 0, &d, NULL), 2);
+}
+END_TEST
+
+// 16-й байт уже не может быть частью записи
+START_TEST(varint_too_long) {
+  unsigned char long_bin[16];
+  s21_decimal d;
+  long_varint(long_bin, sizeof(long_bin));
+  ck_assert_int_eq(s21_decode_varint(long_bin, sizeof(long_bin), &d, NULL),
+                   1);
+}
+END_TEST
+
+// 14-й байт 0x7F: биты 91..97, два лишних; 0x1F - биты 91..95
+START_TEST(varint_over_96_bits) {
+  unsigned char long_bin[S21_VARINT_MAX_SIZE];
+  s21_decimal d;
+  long_varint(long_bin, sizeof(long_bin));
+  long_bin[14] = 0x7F;
+  ck_assert_int_eq(s21_decode_varint(long_bin, 15, &d, NULL), 1);
+  long_bin[14] = 0x1F;
+  ck_assert_int_eq(s21_decode_varint(long_bin, 15, &d, NULL), 0);
+  ck_assert_uint_eq((uint32_t)d.bits[2], 0xF8000000u);
+}
+END_TEST
+
+START_TEST(varint_decode_null) {
+  s21_decimal d;
+  ck_assert_int_eq(s21_decode_varint(NULL, 15, &d, NULL), 1);
+}
+END_TEST
+
+// буфер 16 байт: 3 + 15 не помещаются, запись продолжается с count
+START_TEST(varint_batch_encode_resume) {
+  unsigned char stream[64];
+  size_t total = 0, count = 0, written = 0;
+  for (size_t done = 0; done < 4; done += count) {
+    unsigned char part[16];
+    int code = s21_encode_varint_batch(batch_src + done, 4 - done, part,
+                                       sizeof(part), &count, &written);
+    ck_assert_int_eq(code, done + count < 4 ? 2 : 0);
+    ck_assert_int_gt((int)count, 0);
+    memcpy(stream + total, part, written);
+    total += written;
+  }
+  ck_assert_int_eq((int)total, 3 + 15 + 2 + 5);
+}
+END_TEST
+
+// чтение кусками по 10 байт: хвост переносится в следующий кусок
+START_TEST(varint_batch_decode_tail) {
+  unsigned char stream[64], window[32];
+  s21_decimal back[4];
+  size_t total = 0, count = 0, have = 0, fed = 0, got = 0, consumed = 0;
+  s21_encode_varint_batch(batch_src, 4, stream, sizeof(stream), &count,
+                          &total);
+  while (got < 4) {
+    size_t add = total - fed < 10 ? total - fed : 10;
+    memcpy(window + have, stream + fed, add);
+    have += add;
+    fed += add;
+    int code = s21_decode_varint_batch(window, have, back + got, 4 - got,
+                                       &count, &consumed);
+    ck_assert_int_eq(code, got + count < 4 ? 2 : 0);
+    got += count;
+    memmove(window, window + consumed, have - consumed);
+    have -= consumed;
+  }
+  ck_assert_mem_eq(back, batch_src, sizeof(back));
+}
+END_TEST
+
+// неверный элемент записывается как 0, остальные пишутся
+START_TEST(varint_batch_encode_bad_element) {
+  s21_decimal src[4];
+  unsigned char stream[64];
+  size_t count = 0, written = 0;
+  memcpy(src, batch_src, sizeof(src));
+  src[1].bits[3] = 30 << 16;
+  ck_assert_int_eq(s21_encode_varint_batch(src, 4, stream, sizeof(stream),
+                                           &count, &written),
+                   1);
+  ck_assert_int_eq((int)count, 4);
+  ck_assert_int_eq((int)written, 3 + 2 + 2 + 5);
+}
+END_TEST
+
+// резервный бит во второй записи: чтение останавливается на ней
+START_TEST(varint_batch_decode_bad_element) {
+  unsigned char stream[64];
+  s21_decimal back[4];
+  size_t count = 0, written = 0;
+  s21_encode_varint_batch(batch_src, 4, stream, sizeof(stream), &count,
+                          &written);
+  stream[3] = 0x40;
+  ck_assert_int_eq(
+      s21_decode_varint_batch(stream, written, back, 4, &count, NULL), 1);
+  ck_assert_int_eq((int)count, 1);
+  ck_assert_mem_eq(&back[0], &batch_src[0], sizeof(back[0]));
+}
+END_TEST
+
+Suite *test_varint(void) {
+  Suite *s = suite_create("s21_varint");
+  TCase *tc = tcase_create("varint");
+
+  tcase_add_test(tc, varint_header_and_leb128);
+  tcase_add_test(tc, varint_negative_zero);
+  tcase_add_test(tc, varint_max_size);
+  tcase_add_test(tc, varint_byte_boundaries);
+  tcase_add_test(tc, varint_encode_no_space);
+  tcase_add_test(tc, varint_encode_bad_scale);
+  tcase_add_test(tc, varint_reserved_bits);
+  tcase_add_test(tc, varint_decode_bad_scale);
+  tcase_add_test(tc, varint_truncated);
+  tcase_add_test(tc, varint_too_long);
+  tcase_add_test(tc, varint_over_96_bits);
+  tcase_add_test(tc, varint_decode_null);
+  tcase_add_test(tc, varint_batch_encode_resume);
+  tcase_add_test(tc, varint_batch_decode_tail);
+  tcase_add_test(tc, varint_batch_encode_bad_element);
+  tcase_add_test(tc, varint_batch_decode_bad_element);
+
+  suite_add_tcase(s, tc);
+  return s;
+}